@@ -20,6 +20,11 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/exec.h"
 #include "arrow/compute/function.h"
 #include "arrow/datum.h"
 #include "arrow/result.h"
@@ -270,5 +275,71 @@ Result<Datum> Quantile(const Datum& value,
                        const QuantileOptions& options = QuantileOptions::Defaults(),
                        ExecContext* ctx = NULLPTR);
 
+namespace internal {
+
+/// \brief Assign integer identifiers to unique combinations of key values.
+///
+/// Consuming a batch of key columns yields a UInt32 array with the group
+/// identifier of each row.  Identifiers are dense and allocated in order of
+/// first appearance, so the number of groups observed so far is always one
+/// more than the largest identifier emitted.
+///
+/// Null keys are grouped together, as in SQL.
+class ARROW_EXPORT Grouper {
+ public:
+  virtual ~Grouper() = default;
+
+  /// \brief Construct a Grouper which receives the specified key types
+  static Result<std::unique_ptr<Grouper>> Make(const std::vector<ValueDescr>& descrs,
+                                               ExecContext* ctx = NULLPTR);
+
+  /// \brief Consume a batch of keys, producing the corresponding group ids as
+  /// a UInt32 array.
+  virtual Result<Datum> Consume(const ExecBatch& batch) = 0;
+
+  /// \brief Look up the group ids of a batch of keys without inserting new
+  /// groups, producing a UInt32 array which is null where a key combination
+  /// has not been seen.
+  virtual Result<Datum> Lookup(const ExecBatch& batch) = 0;
+
+  /// \brief Get the unique key combinations seen so far, one row per group.
+  /// May be called multiple times.
+  virtual Result<ExecBatch> GetUniques() = 0;
+
+  /// \brief Get the current number of groups.
+  virtual uint32_t num_groups() const = 0;
+};
+
+/// \brief Configure a grouped aggregation
+struct ARROW_EXPORT Aggregate {
+  /// the name of the aggregation function, e.g. "hash_sum"
+  std::string function;
+
+  /// options for the aggregation function, or null to use its default options
+  const FunctionOptions* options;
+};
+
+/// \brief Compute grouped aggregates of the arguments, grouped by the keys.
+///
+/// Each argument is aggregated with the corresponding HASH_AGGREGATE
+/// function.  The result is a StructArray with one row per group: a field
+/// for each aggregate (named after its function) followed by a field for
+/// each key ("key_0", "key_1"...).  Groups are emitted in order of first
+/// appearance.
+///
+/// \param[in] arguments the values to aggregate, Array or ChunkedArray
+/// \param[in] keys the grouping keys, Array or ChunkedArray
+/// \param[in] aggregates one aggregation per argument
+/// \param[in] ctx the function execution context, optional
+/// \return resulting datum as a StructArray
+///
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> GroupBy(const std::vector<Datum>& arguments, const std::vector<Datum>& keys,
+                      const std::vector<Aggregate>& aggregates,
+                      ExecContext* ctx = NULLPTR);
+
+}  // namespace internal
+
 }  // namespace compute
 }  // namespace arrow
@@ -69,6 +69,14 @@ Result<std::shared_ptr<Array>> SortIndices(const Datum& datum, const SortOptions
   return result.make_array();
 }
 
+Result<std::shared_ptr<Array>> SelectK(const Datum& datum, int64_t k,
+                                       const SortOptions& options, ExecContext* ctx) {
+  SelectKOptions select_k_options(k, options.sort_keys);
+  ARROW_ASSIGN_OR_RAISE(Datum result,
+                        CallFunction("select_k", {datum}, &select_k_options, ctx));
+  return result.make_array();
+}
+
 Result<std::shared_ptr<Array>> Unique(const Datum& value, ExecContext* ctx) {
   ARROW_ASSIGN_OR_RAISE(Datum result, CallFunction("unique", {value}, ctx));
   return result.make_array();
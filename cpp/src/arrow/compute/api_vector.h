@@ -18,7 +18,11 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
+#include "arrow/compute/exec.h"
 #include "arrow/compute/function.h"
 #include "arrow/datum.h"
 #include "arrow/result.h"
@@ -90,6 +94,19 @@ struct ARROW_EXPORT SortOptions : public FunctionOptions {
   std::vector<SortKey> sort_keys;
 };
 
+/// \brief Options for SelectK
+struct ARROW_EXPORT SelectKOptions : public FunctionOptions {
+  explicit SelectKOptions(int64_t k = -1, std::vector<SortKey> sort_keys = {})
+      : k(k), sort_keys(std::move(sort_keys)) {}
+
+  static SelectKOptions Defaults() { return SelectKOptions{}; }
+
+  /// The number of rows to select.
+  int64_t k;
+  /// The sort keys, as in SortOptions.
+  std::vector<SortKey> sort_keys;
+};
+
 /// \brief Partitioning options for NthToIndices
 struct ARROW_EXPORT PartitionNthOptions : public FunctionOptions {
   explicit PartitionNthOptions(int64_t pivot) : pivot(pivot) {}
@@ -243,6 +260,9 @@ Result<std::shared_ptr<Array>> SortIndices(const ChunkedArray& chunked_array,
 /// {"column2", SortOrder::Descending},
 /// }, the output will be [5, 1, 4, 2, 0, 3].
 ///
+/// If ExecContext::use_threads() is true, large tables are sorted as
+/// several slices in parallel, which are then merged.
+///
 /// \param[in] datum array, chunked array, record batch or table to sort
 /// \param[in] options options
 /// \param[in] ctx the function execution context, optional
@@ -251,6 +271,29 @@ ARROW_EXPORT
 Result<std::shared_ptr<Array>> SortIndices(const Datum& datum, const SortOptions& options,
                                            ExecContext* ctx = NULLPTR);
 
+/// \brief Return the indices of the first k rows of the input, in sorted
+/// order.
+///
+/// The result is the same as the first k indices returned by SortIndices,
+/// but is computed by keeping the best k rows of each slice of the input in
+/// a bounded heap, rather than by sorting the entire input.  If
+/// ExecContext::use_threads() is true, slices are processed in parallel.
+///
+/// If k is greater than the length of the input, all indices are returned.
+///
+/// \param[in] datum array, chunked array, record batch or table to select from
+/// \param[in] k the number of rows to select
+/// \param[in] options the sort keys, interpreted as for SortIndices
+/// \param[in] ctx the function execution context, optional
+/// \return indices of the selected rows
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> SelectK(const Datum& datum, int64_t k,
+                                       const SortOptions& options,
+                                       ExecContext* ctx = NULLPTR);
+
 /// \brief Compute unique elements from an array-like object
 ///
 /// Note if a null occurs in the input it will NOT be included in the output.
@@ -298,6 +341,81 @@ Result<std::shared_ptr<StructArray>> ValueCounts(const Datum& value,
 ARROW_EXPORT
 Result<Datum> DictionaryEncode(const Datum& data, ExecContext* ctx = NULLPTR);
 
+// ----------------------------------------------------------------------
+// Hash join
+
+enum class JoinType {
+  /// Emit a row for each pair of matching probe and build rows
+  INNER,
+  /// Like INNER, but also emit each unmatched probe row with null build values
+  LEFT_OUTER,
+  /// Emit each probe row which has at least one match, once
+  LEFT_SEMI,
+  /// Emit each probe row which has no match
+  LEFT_ANTI,
+};
+
+/// \brief The rows selected by probing a HashJoin, as Take indices
+struct ARROW_EXPORT HashJoinIndices {
+  /// Int64 indices into the probe rows, in increasing order
+  std::shared_ptr<Array> probe_indices;
+  /// Int64 indices into the build rows, null for the unmatched probe rows of
+  /// a LEFT_OUTER join.  Not set for LEFT_SEMI and LEFT_ANTI joins.
+  std::shared_ptr<Array> build_indices;
+};
+
+/// \brief Equi-join streamed probe rows against a hashed build side
+///
+/// The build side is hashed once on its (possibly composite) key when the
+/// HashJoin is made; probing a batch of keys then yields the indices of the
+/// joined rows, which can be materialized with Take.  As in SQL, null keys
+/// never match.
+///
+/// Each probe row's matches are emitted in build row order.
+///
+/// \since 4.0.0
+/// \note API not yet finalized
+class ARROW_EXPORT HashJoin {
+ public:
+  virtual ~HashJoin() = default;
+
+  /// \brief Hash the key columns of the build side
+  ///
+  /// \param[in] join_type the kind of join
+  /// \param[in] build_keys the key columns, Arrays or ChunkedArrays of equal length
+  /// \param[in] ctx the function execution context, optional
+  static Result<std::unique_ptr<HashJoin>> Make(JoinType join_type,
+                                                const std::vector<Datum>& build_keys,
+                                                ExecContext* ctx = NULLPTR);
+
+  /// \brief Hash a Table on the named key columns
+  ///
+  /// The Table's columns are retained, without being copied or concatenated,
+  /// so that Probe() can materialize the joined rows.
+  static Result<std::unique_ptr<HashJoin>> Make(
+      JoinType join_type, const std::shared_ptr<Table>& build,
+      const std::vector<std::string>& build_key_names, ExecContext* ctx = NULLPTR);
+
+  /// \brief Probe with a batch of key columns
+  ///
+  /// The keys must have the same number and types as the build keys.
+  virtual Result<HashJoinIndices> ProbeIndices(const ExecBatch& probe_keys) = 0;
+
+  /// \brief Probe with a RecordBatch, keyed on the named columns, and
+  /// materialize the joined rows
+  ///
+  /// The output has the probe batch's fields followed, for INNER and
+  /// LEFT_OUTER joins, by the build Table's fields.  Only valid if the
+  /// HashJoin was made from a Table.
+  virtual Result<std::shared_ptr<RecordBatch>> Probe(
+      const RecordBatch& probe, const std::vector<std::string>& probe_key_names) = 0;
+
+  virtual JoinType join_type() const = 0;
+
+  /// \brief The number of rows on the build side
+  virtual int64_t num_build_rows() const = 0;
+};
+
 // ----------------------------------------------------------------------
 // Deprecated functions
 
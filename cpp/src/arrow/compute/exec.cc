@@ -20,7 +20,9 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
@@ -36,10 +38,12 @@
 #include "arrow/compute/registry.h"
 #include "arrow/compute/util_internal.h"
 #include "arrow/datum.h"
+#include "arrow/record_batch.h"
 #include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
@@ -53,7 +57,9 @@ namespace arrow {
 using internal::BitmapAnd;
 using internal::checked_cast;
 using internal::CopyBitmap;
+using internal::CountSetBits;
 using internal::CpuInfo;
+using internal::VisitSetBitRunsVoid;
 
 namespace compute {
 
@@ -160,11 +166,55 @@ Result<std::unique_ptr<ExecBatchIterator>> ExecBatchIterator::Make(
       new ExecBatchIterator(std::move(args), length, max_chunksize));
 }
 
+Result<std::unique_ptr<ExecBatchIterator>> ExecBatchIterator::Make(
+    std::vector<Datum> args, std::shared_ptr<SelectionVector> selection,
+    int64_t max_chunksize) {
+  if (selection == nullptr) {
+    return Make(std::move(args), max_chunksize);
+  }
+
+  int64_t values_length = -1;
+  for (const auto& arg : args) {
+    if (arg.is_scalar()) {
+      continue;
+    }
+    if (!arg.is_array()) {
+      return Status::Invalid(
+          "ExecBatchIterator only works with Scalar and Array arguments when "
+          "there is a selection vector");
+    }
+    if (values_length == -1) {
+      values_length = arg.length();
+    } else if (arg.length() != values_length) {
+      return Status::Invalid("Array arguments must all be the same length");
+    }
+  }
+
+  int64_t length = selection->length();
+  max_chunksize = std::min(length, max_chunksize);
+
+  std::unique_ptr<ExecBatchIterator> iterator(
+      new ExecBatchIterator(std::move(args), length, max_chunksize));
+  iterator->selection_ = std::move(selection);
+  return std::move(iterator);
+}
+
 bool ExecBatchIterator::Next(ExecBatch* batch) {
   if (position_ == length_) {
     return false;
   }
 
+  if (selection_ != nullptr) {
+    // The values are passed on whole with the part of the selection covered by
+    // this batch, so that only the selected rows need to be touched
+    int64_t iteration_size = std::min(length_ - position_, max_chunksize_);
+    batch->values = args_;
+    batch->selection_vector = selection_->Slice(position_, iteration_size);
+    batch->length = iteration_size;
+    position_ += iteration_size;
+    return true;
+  }
+
   // Determine how large the common contiguous "slice" of all the arguments is
   int64_t iteration_size = std::min(length_ - position_, max_chunksize_);
 
@@ -194,6 +244,7 @@ bool ExecBatchIterator::Next(ExecBatch* batch) {
 
   // Now, fill the batch
   batch->values.resize(args_.size());
+  batch->selection_vector.reset();
   batch->length = iteration_size;
   for (size_t i = 0; i < args_.size(); ++i) {
     if (args_[i].is_scalar()) {
@@ -460,9 +511,20 @@ class KernelExecutorImpl : public KernelExecutor {
 
  protected:
   // This is overridden by the VectorExecutor
-  virtual Status SetupArgIteration(const std::vector<Datum>& args) {
-    ARROW_ASSIGN_OR_RAISE(
-        batch_iterator_, ExecBatchIterator::Make(args, exec_context()->exec_chunksize()));
+  virtual Status SetupArgIteration(const std::vector<Datum>& args,
+                                   std::shared_ptr<SelectionVector> selection) {
+    ARROW_ASSIGN_OR_RAISE(batch_iterator_,
+                          ExecBatchIterator::Make(args, std::move(selection),
+                                                  exec_context()->exec_chunksize()));
+    return Status::OK();
+  }
+
+  // Kernels execute on contiguous values, so gather the rows selected in a
+  // batch. Only this batch of the function's own arguments is copied.
+  Status GatherSelected(ExecBatch* batch) {
+    if (batch->selection_vector != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(*batch, batch->Materialize(exec_context()));
+    }
     return Status::OK();
   }
 
@@ -508,10 +570,13 @@ class KernelExecutorImpl : public KernelExecutor {
 
 class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
  public:
-  Status Execute(const std::vector<Datum>& args, ExecListener* listener) override {
-    RETURN_NOT_OK(PrepareExecute(args));
+  Status Execute(const std::vector<Datum>& args,
+                 const std::shared_ptr<SelectionVector>& selection,
+                 ExecListener* listener) override {
+    RETURN_NOT_OK(PrepareExecute(args, selection));
     ExecBatch batch;
     while (batch_iterator_->Next(&batch)) {
+      RETURN_NOT_OK(GatherSelected(&batch));
       RETURN_NOT_OK(ExecuteBatch(batch, listener));
     }
     if (preallocate_contiguous_) {
@@ -584,8 +649,9 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
     return Status::OK();
   }
 
-  Status PrepareExecute(const std::vector<Datum>& args) {
-    RETURN_NOT_OK(this->SetupArgIteration(args));
+  Status PrepareExecute(const std::vector<Datum>& args,
+                        std::shared_ptr<SelectionVector> selection) {
+    RETURN_NOT_OK(this->SetupArgIteration(args, std::move(selection)));
 
     if (output_descr_.shape == ValueDescr::ARRAY) {
       // If the executor is configured to produce a single large Array output for
@@ -703,7 +769,18 @@ Status PackBatchNoChunks(const std::vector<Datum>& args, ExecBatch* out) {
 
 class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
  public:
-  Status Execute(const std::vector<Datum>& args, ExecListener* listener) override {
+  Status Execute(const std::vector<Datum>& args,
+                 const std::shared_ptr<SelectionVector>& selection,
+                 ExecListener* listener) override {
+    if (selection != nullptr) {
+      // Vector kernels need all of their input at once, so the selection is
+      // materialized up front
+      ExecBatch selected(args, selection->length());
+      selected.selection_vector = selection;
+      ARROW_ASSIGN_OR_RAISE(selected, selected.Materialize(exec_context()));
+      return Execute(selected.values, /*selection=*/nullptr, listener);
+    }
+
     RETURN_NOT_OK(PrepareExecute(args));
     ExecBatch batch;
     if (kernel_->can_execute_chunkwise) {
@@ -776,7 +853,8 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
     return Status::OK();
   }
 
-  Status SetupArgIteration(const std::vector<Datum>& args) override {
+  Status SetupArgIteration(const std::vector<Datum>& args,
+                           std::shared_ptr<SelectionVector>) override {
     if (kernel_->can_execute_chunkwise) {
       ARROW_ASSIGN_OR_RAISE(batch_iterator_, ExecBatchIterator::Make(
                                                  args, exec_context()->exec_chunksize()));
@@ -785,7 +863,7 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
   }
 
   Status PrepareExecute(const std::vector<Datum>& args) {
-    RETURN_NOT_OK(this->SetupArgIteration(args));
+    RETURN_NOT_OK(this->SetupArgIteration(args, /*selection=*/nullptr));
     output_num_buffers_ = static_cast<int>(output_descr_.type->layout().buffers.size());
 
     // Decide if we need to preallocate memory for this kernel
@@ -809,13 +887,16 @@ class ScalarAggExecutor : public KernelExecutorImpl<ScalarAggregateKernel> {
     return KernelExecutorImpl<ScalarAggregateKernel>::Init(ctx, args);
   }
 
-  Status Execute(const std::vector<Datum>& args, ExecListener* listener) override {
-    RETURN_NOT_OK(this->SetupArgIteration(args));
+  Status Execute(const std::vector<Datum>& args,
+                 const std::shared_ptr<SelectionVector>& selection,
+                 ExecListener* listener) override {
+    RETURN_NOT_OK(this->SetupArgIteration(args, selection));
 
     ExecBatch batch;
     while (batch_iterator_->Next(&batch)) {
       // TODO: implement parallelism
       if (batch.length > 0) {
+        RETURN_NOT_OK(GatherSelected(&batch));
         RETURN_NOT_OK(Consume(batch));
       }
     }
@@ -914,6 +995,69 @@ ExecContext::ExecContext(MemoryPool* pool, FunctionRegistry* func_registry)
 
 CpuInfo* ExecContext::cpu_info() const { return CpuInfo::GetInstance(); }
 
+// ----------------------------------------------------------------------
+// ExecBatch
+
+ExecBatch::ExecBatch(const RecordBatch& batch)
+    : values(batch.num_columns()), length(batch.num_rows()) {
+  auto columns = batch.column_data();
+  std::move(columns.begin(), columns.end(), values.begin());
+}
+
+Result<std::shared_ptr<RecordBatch>> ExecBatch::ToRecordBatch(
+    std::shared_ptr<Schema> schema, MemoryPool* pool) const {
+  if (selection_vector != nullptr) {
+    ExecContext ctx(pool);
+    ARROW_ASSIGN_OR_RAISE(auto materialized, Materialize(&ctx));
+    return materialized.ToRecordBatch(std::move(schema), pool);
+  }
+  if (static_cast<int>(values.size()) != schema->num_fields()) {
+    return Status::Invalid("ExecBatch has ", values.size(),
+                           " values but the schema has ", schema->num_fields(),
+                           " fields");
+  }
+  ArrayVector columns(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    const Datum& value = values[i];
+    if (value.is_array()) {
+      columns[i] = value.make_array();
+    } else if (value.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(columns[i],
+                            MakeArrayFromScalar(*value.scalar(), length, pool));
+    } else {
+      return Status::TypeError("ExecBatch value ", i,
+                               " is neither an array nor a scalar");
+    }
+  }
+  return RecordBatch::Make(std::move(schema), length, std::move(columns));
+}
+
+Result<ExecBatch> ExecBatch::Materialize(ExecContext* ctx) const {
+  if (selection_vector == nullptr) {
+    return *this;
+  }
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return Materialize(&default_ctx);
+  }
+
+  Datum indices(selection_vector->data());
+  ExecBatch out({}, selection_vector->length());
+  out.values.resize(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (values[i].is_scalar()) {
+      out.values[i] = values[i];
+    } else if (values[i].is_array()) {
+      ARROW_ASSIGN_OR_RAISE(out.values[i],
+                            CallFunction("take", {values[i], indices}, ctx));
+    } else {
+      return Status::Invalid("Cannot apply a selection vector to ExecBatch value ", i,
+                             " which is neither an array nor a scalar");
+    }
+  }
+  return out;
+}
+
 // ----------------------------------------------------------------------
 // SelectionVector
 
@@ -928,9 +1072,40 @@ SelectionVector::SelectionVector(const Array& arr) : SelectionVector(arr.data())
 
 int32_t SelectionVector::length() const { return static_cast<int32_t>(data_->length); }
 
+std::shared_ptr<SelectionVector> SelectionVector::Slice(int64_t offset,
+                                                        int64_t length) const {
+  return std::make_shared<SelectionVector>(data_->Slice(offset, length));
+}
+
 Result<std::shared_ptr<SelectionVector>> SelectionVector::FromMask(
-    const BooleanArray& arr) {
-  return Status::NotImplemented("FromMask");
+    const BooleanArray& arr, MemoryPool* pool) {
+  if (arr.length() > std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid("Mask of length ", arr.length(),
+                           " is too long for a SelectionVector");
+  }
+
+  const uint8_t* selected = arr.values()->data();
+  int64_t offset = arr.offset();
+  std::shared_ptr<Buffer> valid_and_true;
+  if (arr.null_count() > 0) {
+    ARROW_ASSIGN_OR_RAISE(valid_and_true,
+                          BitmapAnd(pool, arr.null_bitmap_data(), arr.offset(),
+                                    selected, arr.offset(), arr.length(), 0));
+    selected = valid_and_true->data();
+    offset = 0;
+  }
+
+  int64_t num_selected = CountSetBits(selected, offset, arr.length());
+  ARROW_ASSIGN_OR_RAISE(auto indices,
+                        AllocateBuffer(num_selected * sizeof(int32_t), pool));
+  auto out = reinterpret_cast<int32_t*>(indices->mutable_data());
+  VisitSetBitRunsVoid(selected, offset, arr.length(),
+                      [&](int64_t position, int64_t length) {
+                        std::iota(out, out + length, static_cast<int32_t>(position));
+                        out += length;
+                      });
+  return std::make_shared<SelectionVector>(ArrayData::Make(
+      int32(), num_selected, {nullptr, std::move(indices)}, /*null_count=*/0));
 }
 
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
@@ -131,7 +131,9 @@ class ARROW_EXPORT ExecContext {
 /// implementations. This is especially relevant for aggregations but also
 /// applies to scalar operations.
 ///
-/// We are not yet using this so this is mostly a placeholder for now.
+/// Scalar and scalar aggregate functions executed on an ExecBatch with a
+/// selection vector only process the selected rows of their own arguments,
+/// so the other columns of a filtered batch are never copied.
 ///
 /// [1]: http://cidrdb.org/cidr2005/papers/P19.pdf
 class ARROW_EXPORT SelectionVector {
@@ -140,8 +142,16 @@ class ARROW_EXPORT SelectionVector {
 
   explicit SelectionVector(const Array& arr);
 
-  /// \brief Create SelectionVector from boolean mask
-  static Result<std::shared_ptr<SelectionVector>> FromMask(const BooleanArray& arr);
+  /// \brief Create SelectionVector from boolean mask. Null slots of the mask
+  /// are not selected.
+  static Result<std::shared_ptr<SelectionVector>> FromMask(
+      const BooleanArray& arr, MemoryPool* pool = default_memory_pool());
+
+  /// \brief A SelectionVector of a contiguous range of these indices
+  std::shared_ptr<SelectionVector> Slice(int64_t offset, int64_t length) const;
+
+  /// The indices as an Int32 array without nulls
+  const std::shared_ptr<ArrayData>& data() const { return data_; }
 
   const int32_t* indices() const { return indices_; }
   int32_t length() const;
@@ -164,11 +174,26 @@ class ARROW_EXPORT SelectionVector {
 /// TODO: Datum uses arrow/util/variant.h which may be a bit heavier-weight
 /// than is desirable for this class. Microbenchmarks would help determine for
 /// sure. See ARROW-8928.
-struct ExecBatch {
+struct ARROW_EXPORT ExecBatch {
   ExecBatch() = default;
   ExecBatch(std::vector<Datum> values, int64_t length)
       : values(std::move(values)), length(length) {}
 
+  /// \brief Construct an ExecBatch holding the columns of a RecordBatch
+  explicit ExecBatch(const RecordBatch& batch);
+
+  /// \brief Convert to a RecordBatch with the given schema, broadcasting any
+  /// Scalar values to arrays of the batch length and materializing the
+  /// selection vector if there is one
+  Result<std::shared_ptr<RecordBatch>> ToRecordBatch(
+      std::shared_ptr<Schema> schema, MemoryPool* pool = default_memory_pool()) const;
+
+  /// \brief Return a batch of only the selected rows, without a selection vector.
+  ///
+  /// The selected rows of Array values are gathered; Scalar values are kept
+  /// as they are. If there is no selection vector, the batch is returned as is.
+  Result<ExecBatch> Materialize(ExecContext* ctx = NULLPTR) const;
+
   /// The values representing positional arguments to be passed to a kernel's
   /// exec function for processing.
   std::vector<Datum> values;
@@ -0,0 +1,703 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/exec/exec_plan.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/util.h"
+#include "arrow/compute/function.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/registry.h"
+#include "arrow/datum.h"
+#include "arrow/type.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// Counts the batches received from an input.  The counter completes once the
+// total announced by InputFinished is known and that many batches have been
+// received, whichever happens last.  Exactly one call returns true.
+class AtomicCounter {
+ public:
+  bool Increment() {
+    int count = count_.fetch_add(1) + 1;
+    if (count != total_.load()) return false;
+    return DoneOnce();
+  }
+
+  bool SetTotal(int total) {
+    total_.store(total);
+    if (count_.load() != total) return false;
+    return DoneOnce();
+  }
+
+ private:
+  bool DoneOnce() {
+    bool expected = false;
+    return complete_.compare_exchange_strong(expected, true);
+  }
+
+  std::atomic<int> count_{0};
+  std::atomic<int> total_{-1};
+  std::atomic<bool> complete_{false};
+};
+
+// Common bookkeeping for the nodes defined here
+class ExecNodeImpl : public ExecNode {
+ public:
+  using ExecNode::ExecNode;
+
+  Future<> finished() override { return finished_; }
+
+ protected:
+  bool is_finished() const { return finish_called_.load(); }
+
+  // Mark this node finished, unless it already was
+  void Finish(Status status = Status::OK()) {
+    bool expected = false;
+    if (!finish_called_.compare_exchange_strong(expected, true)) return;
+    // Marking the future may cause the plan (and this node) to be destroyed,
+    // so keep the future alive through a local copy.
+    auto finished = finished_;
+    finished.MarkFinished(std::move(status));
+  }
+
+ private:
+  std::atomic<bool> finish_called_{false};
+  Future<> finished_ = Future<>::Make();
+};
+
+[[noreturn]] void NoInputs() {
+  DCHECK(false) << "source nodes have no inputs";
+  std::abort();
+}
+
+// ----------------------------------------------------------------------
+// Source
+
+class SourceNode : public ExecNodeImpl {
+ public:
+  SourceNode(ExecPlan* plan, std::string label, std::shared_ptr<Schema> output_schema,
+             ExecBatchGenerator generator)
+      : ExecNodeImpl(plan, std::move(label), {}, std::move(output_schema),
+                     /*num_outputs=*/1),
+        generator_(std::move(generator)) {}
+
+  const char* kind_name() const override { return "SourceNode"; }
+
+  void InputReceived(ExecNode*, int, ExecBatch) override { NoInputs(); }
+  void ErrorReceived(ExecNode*, Status) override { NoInputs(); }
+  void InputFinished(ExecNode*, int) override { NoInputs(); }
+
+  Status StartProducing() override {
+    executor_ = plan_->executor();
+    if (executor_ != nullptr) {
+      // Allow enough batches in flight to keep every thread busy
+      max_in_flight_ = executor_->GetCapacity();
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (done_) return Status::OK();
+      generating_ = true;
+    }
+    if (executor_ == nullptr) {
+      Loop();
+      return Status::OK();
+    }
+    return executor_->Spawn([this] { Loop(); });
+  }
+
+  void StopProducing() override {
+    bool finish = false;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopped_ = true;
+      // If the generator is being pulled, Loop() will notice the stop
+      if (!generating_ && !done_) {
+        done_ = true;
+        finish = in_flight_ == 0;
+      }
+    }
+    if (finish) Finish(status_);
+  }
+
+ private:
+  // Pull batches until the generator is exhausted, an asynchronous batch is
+  // awaited, or too many batches are in flight.  Only one Loop() runs at a time.
+  void Loop() {
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (stopped_) {
+          lock.unlock();
+          DoneGenerating(Status::OK());
+          return;
+        }
+        if (in_flight_ >= max_in_flight_) {
+          // TaskDone() will resume
+          generating_ = false;
+          return;
+        }
+      }
+
+      auto next = generator_();
+      if (!next.is_finished()) {
+        next.AddCallback([this](const Result<util::optional<ExecBatch>>& maybe_batch) {
+          if (Deliver(maybe_batch)) Loop();
+        });
+        return;
+      }
+      if (!Deliver(next.result())) return;
+    }
+  }
+
+  // Push a batch to the output, returning whether to keep generating
+  bool Deliver(const Result<util::optional<ExecBatch>>& maybe_batch) {
+    if (!maybe_batch.ok()) {
+      outputs_[0]->ErrorReceived(this, maybe_batch.status());
+      DoneGenerating(maybe_batch.status());
+      return false;
+    }
+    const util::optional<ExecBatch>& next = maybe_batch.ValueOrDie();
+    if (!next.has_value()) {
+      outputs_[0]->InputFinished(this, batch_count_);
+      DoneGenerating(Status::OK());
+      return false;
+    }
+
+    int seq_num = batch_count_++;
+    ExecBatch batch = *next;
+    if (executor_ == nullptr) {
+      outputs_[0]->InputReceived(this, seq_num, std::move(batch));
+      return true;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++in_flight_;
+    }
+    Status st = executor_->Spawn([this, seq_num, batch]() mutable {
+      outputs_[0]->InputReceived(this, seq_num, std::move(batch));
+      TaskDone();
+    });
+    if (!st.ok()) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --in_flight_;
+      }
+      outputs_[0]->ErrorReceived(this, st);
+      DoneGenerating(st);
+      return false;
+    }
+    return true;
+  }
+
+  void DoneGenerating(Status status) {
+    bool finish;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      generating_ = false;
+      done_ = true;
+      status_ = std::move(status);
+      finish = in_flight_ == 0;
+    }
+    if (finish) Finish(status_);
+  }
+
+  void TaskDone() {
+    bool resume = false, finish = false;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --in_flight_;
+      if (!generating_ && !done_) {
+        generating_ = resume = true;
+      } else {
+        finish = done_ && in_flight_ == 0;
+      }
+    }
+    if (resume) {
+      Loop();
+    } else if (finish) {
+      Finish(status_);
+    }
+  }
+
+  ExecBatchGenerator generator_;
+  ::arrow::internal::Executor* executor_ = nullptr;
+  int max_in_flight_ = 1;
+  int batch_count_ = 0;
+
+  std::mutex mutex_;
+  int in_flight_ = 0;
+  // Whether a Loop() is running or awaiting a batch
+  bool generating_ = false;
+  // Whether the generator will no longer be pulled
+  bool done_ = false;
+  bool stopped_ = false;
+  Status status_;
+};
+
+// ----------------------------------------------------------------------
+// Map
+
+class MapNode : public ExecNodeImpl {
+ public:
+  MapNode(ExecNode* input, std::string label, std::shared_ptr<Schema> output_schema,
+          ExecBatchMapper mapper)
+      : ExecNodeImpl(input->plan(), std::move(label), {input}, std::move(output_schema),
+                     /*num_outputs=*/1),
+        mapper_(std::move(mapper)) {}
+
+  const char* kind_name() const override { return "MapNode"; }
+
+  void InputReceived(ExecNode* input, int seq_num, ExecBatch batch) override {
+    DCHECK_EQ(input, inputs_[0]);
+    if (is_finished()) return;
+
+    auto maybe_batch = mapper_(std::move(batch));
+    if (!maybe_batch.ok()) {
+      outputs_[0]->ErrorReceived(this, maybe_batch.status());
+      Finish(maybe_batch.status());
+      return;
+    }
+    outputs_[0]->InputReceived(this, seq_num, maybe_batch.MoveValueUnsafe());
+
+    if (counter_.Increment()) Finish();
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    DCHECK_EQ(input, inputs_[0]);
+    outputs_[0]->ErrorReceived(this, error);
+    Finish(std::move(error));
+  }
+
+  void InputFinished(ExecNode* input, int num_total) override {
+    DCHECK_EQ(input, inputs_[0]);
+    // Batches map one to one, so the output total is known already
+    outputs_[0]->InputFinished(this, num_total);
+    if (counter_.SetTotal(num_total)) Finish();
+  }
+
+  Status StartProducing() override { return Status::OK(); }
+
+  void StopProducing() override { Finish(); }
+
+ private:
+  ExecBatchMapper mapper_;
+  AtomicCounter counter_;
+};
+
+// ----------------------------------------------------------------------
+// Scalar aggregation
+
+class ScalarAggregateNode : public ExecNodeImpl {
+ public:
+  ScalarAggregateNode(ExecNode* input, std::string label,
+                      std::shared_ptr<Schema> output_schema,
+                      std::vector<const ScalarAggregateKernel*> kernels,
+                      std::vector<std::vector<ValueDescr>> in_descrs,
+                      std::vector<const FunctionOptions*> options,
+                      std::vector<std::unique_ptr<KernelState>> states)
+      : ExecNodeImpl(input->plan(), std::move(label), {input}, std::move(output_schema),
+                     /*num_outputs=*/1),
+        kernels_(std::move(kernels)),
+        in_descrs_(std::move(in_descrs)),
+        options_(std::move(options)),
+        states_(std::move(states)) {}
+
+  const char* kind_name() const override { return "ScalarAggregateNode"; }
+
+  void InputReceived(ExecNode* input, int seq_num, ExecBatch batch) override {
+    DCHECK_EQ(input, inputs_[0]);
+    if (is_finished()) return;
+
+    Status st = Consume(batch);
+    if (!st.ok()) {
+      outputs_[0]->ErrorReceived(this, st);
+      Finish(std::move(st));
+      return;
+    }
+    if (counter_.Increment()) Emit();
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    DCHECK_EQ(input, inputs_[0]);
+    outputs_[0]->ErrorReceived(this, error);
+    Finish(std::move(error));
+  }
+
+  void InputFinished(ExecNode* input, int num_total) override {
+    DCHECK_EQ(input, inputs_[0]);
+    if (counter_.SetTotal(num_total)) Emit();
+  }
+
+  Status StartProducing() override { return Status::OK(); }
+
+  void StopProducing() override { Finish(); }
+
+ private:
+  // Consume the batch into fresh states, then merge those into the
+  // accumulated states.  Only the merge is serialized.
+  Status Consume(const ExecBatch& batch) {
+    if (batch.length == 0) return Status::OK();
+
+    ExecContext* exec_ctx = plan_->exec_context();
+    std::vector<std::unique_ptr<KernelState>> batch_states(kernels_.size());
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+      KernelContext batch_ctx{exec_ctx};
+      batch_states[i] =
+          kernels_[i]->init(&batch_ctx, {kernels_[i], in_descrs_[i], options_[i]});
+      ARROW_CTX_RETURN_IF_ERROR(&batch_ctx);
+      batch_ctx.SetState(batch_states[i].get());
+
+      // Only the selected rows of the aggregated column are gathered
+      ExecBatch column({batch.values[i]}, batch.length);
+      column.selection_vector = batch.selection_vector;
+      ARROW_ASSIGN_OR_RAISE(column, column.Materialize(exec_ctx));
+
+      Datum value = std::move(column.values[0]);
+      if (value.is_scalar()) {
+        // Aggregate kernels only consume arrays
+        ARROW_ASSIGN_OR_RAISE(value, MakeArrayFromScalar(*value.scalar(), batch.length,
+                                                         exec_ctx->memory_pool()));
+      }
+      kernels_[i]->consume(&batch_ctx, ExecBatch({std::move(value)}, batch.length));
+      ARROW_CTX_RETURN_IF_ERROR(&batch_ctx);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+      KernelContext ctx{exec_ctx};
+      ctx.SetState(states_[i].get());
+      kernels_[i]->merge(&ctx, std::move(*batch_states[i]), states_[i].get());
+      ARROW_CTX_RETURN_IF_ERROR(&ctx);
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(ExecBatch* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    out->values.resize(kernels_.size());
+    out->length = 1;
+    for (size_t i = 0; i < kernels_.size(); ++i) {
+      KernelContext ctx{plan_->exec_context()};
+      ctx.SetState(states_[i].get());
+      kernels_[i]->finalize(&ctx, &out->values[i]);
+      ARROW_CTX_RETURN_IF_ERROR(&ctx);
+    }
+    return Status::OK();
+  }
+
+  void Emit() {
+    ExecBatch out;
+    Status st = Finalize(&out);
+    if (!st.ok()) {
+      outputs_[0]->ErrorReceived(this, st);
+      Finish(std::move(st));
+      return;
+    }
+    outputs_[0]->InputReceived(this, /*seq_num=*/0, std::move(out));
+    outputs_[0]->InputFinished(this, /*num_total=*/1);
+    Finish();
+  }
+
+  const std::vector<const ScalarAggregateKernel*> kernels_;
+  const std::vector<std::vector<ValueDescr>> in_descrs_;
+  const std::vector<const FunctionOptions*> options_;
+
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<KernelState>> states_;
+  AtomicCounter counter_;
+};
+
+// ----------------------------------------------------------------------
+// Sink
+
+class SinkNode : public ExecNodeImpl {
+ public:
+  SinkNode(ExecNode* input, std::string label, ExecBatchConsumer consumer)
+      : ExecNodeImpl(input->plan(), std::move(label), {input}, /*output_schema=*/nullptr,
+                     /*num_outputs=*/0),
+        consumer_(std::move(consumer)) {}
+
+  const char* kind_name() const override { return "SinkNode"; }
+
+  void InputReceived(ExecNode* input, int seq_num, ExecBatch batch) override {
+    DCHECK_EQ(input, inputs_[0]);
+    if (is_finished()) return;
+
+    Status st;
+    if (batch.selection_vector != nullptr) {
+      // Deferred filters end here
+      st = batch.Materialize(plan_->exec_context()).Value(&batch);
+    }
+    if (st.ok()) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      st = consumer_(std::move(batch));
+    }
+    if (!st.ok()) {
+      Fail(std::move(st));
+      return;
+    }
+    if (counter_.Increment()) Finish();
+  }
+
+  void ErrorReceived(ExecNode* input, Status error) override {
+    DCHECK_EQ(input, inputs_[0]);
+    Fail(std::move(error));
+  }
+
+  void InputFinished(ExecNode* input, int num_total) override {
+    DCHECK_EQ(input, inputs_[0]);
+    if (counter_.SetTotal(num_total)) Finish();
+  }
+
+  Status StartProducing() override { return Status::OK(); }
+
+  void StopProducing() override { Finish(); }
+
+ private:
+  void Fail(Status error) {
+    if (is_finished()) return;
+    Finish(std::move(error));
+    plan_->StopProducing();
+  }
+
+  ExecBatchConsumer consumer_;
+  std::mutex mutex_;
+  AtomicCounter counter_;
+};
+
+Status ValidateInput(const ExecNode* input) {
+  if (input == nullptr) {
+    return Status::Invalid("ExecNode input must not be null");
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// ExecPlan
+
+ExecPlan::ExecPlan(ExecContext* ctx)
+    : exec_context_(ctx == nullptr ? &default_exec_context_ : ctx) {}
+
+ExecPlan::~ExecPlan() {
+  if (started_ && !finished_.is_finished()) {
+    StopProducing();
+    finished_.Wait();
+  }
+}
+
+Result<std::shared_ptr<ExecPlan>> ExecPlan::Make(ExecContext* ctx) {
+  return std::shared_ptr<ExecPlan>(new ExecPlan(ctx));
+}
+
+ExecNode* ExecPlan::AddNode(std::unique_ptr<ExecNode> node) {
+  DCHECK_EQ(node->plan(), this);
+  nodes_.push_back(std::move(node));
+  return nodes_.back().get();
+}
+
+ExecPlan::NodeVector ExecPlan::sources() const {
+  NodeVector out;
+  for (const auto& node : nodes_) {
+    if (node->num_inputs() == 0) out.push_back(node.get());
+  }
+  return out;
+}
+
+ExecPlan::NodeVector ExecPlan::sinks() const {
+  NodeVector out;
+  for (const auto& node : nodes_) {
+    if (node->num_outputs() == 0) out.push_back(node.get());
+  }
+  return out;
+}
+
+::arrow::internal::Executor* ExecPlan::executor() const {
+  return exec_context_->use_threads() ? ::arrow::internal::GetCpuThreadPool() : nullptr;
+}
+
+Status ExecPlan::Validate() const {
+  if (nodes_.empty()) {
+    return Status::Invalid("ExecPlan has no nodes");
+  }
+  for (const auto& node : nodes_) {
+    RETURN_NOT_OK(node->Validate());
+  }
+  return Status::OK();
+}
+
+Status ExecPlan::StartProducing() {
+  if (started_) {
+    return Status::Invalid("ExecPlan was already started");
+  }
+  RETURN_NOT_OK(Validate());
+  started_ = true;
+
+  // Complete finished_ once every node has finished
+  struct FinishState {
+    std::mutex mutex;
+    size_t num_remaining;
+    Status status;
+    Future<> finished;
+  };
+  auto state = std::make_shared<FinishState>();
+  state->num_remaining = nodes_.size();
+  state->finished = finished_;
+  for (const auto& node : nodes_) {
+    node->finished().AddCallback([state](const Result<::arrow::detail::Empty>& result) {
+      bool done;
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->status.ok()) state->status = result.status();
+        done = --state->num_remaining == 0;
+      }
+      if (done) {
+        auto finished = state->finished;
+        finished.MarkFinished(state->status);
+      }
+    });
+  }
+
+  // Start sinks first so that no node receives a batch before it is started
+  for (auto it = nodes_.rbegin(); it != nodes_.rend(); ++it) {
+    Status st = (*it)->StartProducing();
+    if (!st.ok()) {
+      StopProducing();
+      return st;
+    }
+  }
+  return Status::OK();
+}
+
+void ExecPlan::StopProducing() {
+  for (const auto& node : nodes_) {
+    node->StopProducing();
+  }
+}
+
+// ----------------------------------------------------------------------
+// ExecNode
+
+ExecNode::ExecNode(ExecPlan* plan, std::string label, NodeVector inputs,
+                   std::shared_ptr<Schema> output_schema, int num_outputs)
+    : plan_(plan),
+      label_(std::move(label)),
+      inputs_(std::move(inputs)),
+      output_schema_(std::move(output_schema)),
+      num_outputs_(num_outputs) {
+  for (auto input : inputs_) {
+    input->outputs_.push_back(this);
+  }
+}
+
+Status ExecNode::Validate() const {
+  if (num_outputs() != static_cast<int>(outputs_.size())) {
+    return Status::Invalid("Node '", label(), "' (", kind_name(), ") requires ",
+                           num_outputs(), " outputs but has ", outputs_.size());
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Node factories
+
+Result<ExecNode*> MakeSourceNode(ExecPlan* plan, std::string label,
+                                 std::shared_ptr<Schema> output_schema,
+                                 ExecBatchGenerator generator) {
+  return plan->AddNode(::arrow::internal::make_unique<SourceNode>(
+      plan, std::move(label), std::move(output_schema), std::move(generator)));
+}
+
+Result<ExecNode*> MakeMapNode(ExecNode* input, std::string label,
+                              std::shared_ptr<Schema> output_schema,
+                              ExecBatchMapper mapper) {
+  RETURN_NOT_OK(ValidateInput(input));
+  return input->plan()->AddNode(::arrow::internal::make_unique<MapNode>(
+      input, std::move(label), std::move(output_schema), std::move(mapper)));
+}
+
+Result<ExecNode*> MakeScalarAggregateNode(ExecNode* input, std::string label,
+                                          std::vector<internal::Aggregate> aggregates) {
+  RETURN_NOT_OK(ValidateInput(input));
+  const auto& input_schema = *input->output_schema();
+  if (static_cast<int>(aggregates.size()) != input_schema.num_fields()) {
+    return Status::Invalid("Got ", aggregates.size(), " aggregates for an input of ",
+                           input_schema.num_fields(), " columns");
+  }
+
+  ExecContext* exec_ctx = input->plan()->exec_context();
+  const size_t num_aggregates = aggregates.size();
+  std::vector<const ScalarAggregateKernel*> kernels(num_aggregates);
+  std::vector<std::vector<ValueDescr>> in_descrs(num_aggregates);
+  std::vector<const FunctionOptions*> options(num_aggregates);
+  std::vector<std::unique_ptr<KernelState>> states(num_aggregates);
+  FieldVector out_fields;
+
+  for (size_t i = 0; i < num_aggregates; ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto function,
+                          exec_ctx->func_registry()->GetFunction(aggregates[i].function));
+    if (function->kind() != Function::SCALAR_AGGREGATE) {
+      return Status::Invalid("The provided function (", aggregates[i].function,
+                             ") is not a scalar aggregate function");
+    }
+
+    in_descrs[i] = {ValueDescr::Array(input_schema.field(static_cast<int>(i))->type())};
+    ARROW_ASSIGN_OR_RAISE(const Kernel* kernel, function->DispatchExact(in_descrs[i]));
+    kernels[i] = static_cast<const ScalarAggregateKernel*>(kernel);
+
+    options[i] = aggregates[i].options;
+    if (options[i] == nullptr) {
+      options[i] = function->default_options();
+    }
+
+    KernelContext kernel_ctx{exec_ctx};
+    states[i] = kernels[i]->init(&kernel_ctx, {kernel, in_descrs[i], options[i]});
+    ARROW_CTX_RETURN_IF_ERROR(&kernel_ctx);
+
+    ARROW_ASSIGN_OR_RAISE(
+        auto out_descr, kernel->signature->out_type().Resolve(&kernel_ctx, in_descrs[i]));
+    out_fields.push_back(field(aggregates[i].function, std::move(out_descr.type)));
+  }
+
+  return input->plan()->AddNode(::arrow::internal::make_unique<ScalarAggregateNode>(
+      input, std::move(label), schema(std::move(out_fields)), std::move(kernels),
+      std::move(in_descrs), std::move(options), std::move(states)));
+}
+
+Result<ExecNode*> MakeSinkNode(ExecNode* input, std::string label,
+                               ExecBatchConsumer consumer) {
+  RETURN_NOT_OK(ValidateInput(input));
+  return input->plan()->AddNode(::arrow::internal::make_unique<SinkNode>(
+      input, std::move(label), std::move(consumer)));
+}
+
+}  // namespace compute
+}  // namespace arrow
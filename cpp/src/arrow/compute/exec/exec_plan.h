@@ -0,0 +1,255 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// NOTE: API is EXPERIMENTAL and will change without going through a
+// deprecation cycle
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/exec.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/future.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/optional.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+class Executor;
+
+}  // namespace internal
+
+namespace compute {
+
+class ExecNode;
+
+/// \brief A push-based streaming execution plan
+///
+/// An ExecPlan is a directed acyclic graph of ExecNodes.  Source nodes
+/// produce ExecBatches which are pushed through the graph, each node
+/// transforming the batches it receives and pushing the results to its
+/// outputs, until they reach sink nodes.  Batches are never materialized
+/// beyond what a node needs for its own work, so a scan-filter-aggregate
+/// pipeline holds only the batches currently in flight.
+///
+/// When the ExecContext allows threads, sources push each batch from a task
+/// on the CPU thread pool, so nodes must accept concurrent calls to
+/// InputReceived.
+class ARROW_EXPORT ExecPlan {
+ public:
+  using NodeVector = std::vector<ExecNode*>;
+
+  ~ExecPlan();
+
+  /// \brief Make an empty plan.  If ctx is null, a default ExecContext is used.
+  static Result<std::shared_ptr<ExecPlan>> Make(ExecContext* ctx = NULLPTR);
+
+  /// \brief Add a node to the plan, which takes ownership of it.
+  ///
+  /// The node's inputs must already have been added to this plan.
+  ExecNode* AddNode(std::unique_ptr<ExecNode> node);
+
+  /// The initial nodes of the plan, which have no inputs
+  NodeVector sources() const;
+
+  /// The final nodes of the plan, which have no outputs
+  NodeVector sinks() const;
+
+  ExecContext* exec_context() const { return exec_context_; }
+
+  /// \brief The executor on which sources push batches, or null if the plan
+  /// runs serially on the thread calling StartProducing.
+  ::arrow::internal::Executor* executor() const;
+
+  /// \brief Check that every node is connected to as many inputs and outputs
+  /// as it requires.
+  Status Validate() const;
+
+  /// \brief Start producing on all nodes.
+  ///
+  /// Nodes are started in reverse topological order, so that every node is
+  /// ready to receive batches before its inputs start producing.  A plan can
+  /// only be started once.
+  Status StartProducing();
+
+  /// \brief Stop producing on all nodes.
+  ///
+  /// Sources stop producing new batches; batches already in flight are still
+  /// delivered.  finished() completes once they have been.
+  void StopProducing();
+
+  /// \brief A future which completes when every node has finished, with the
+  /// first error encountered if any.
+  Future<> finished() { return finished_; }
+
+ private:
+  explicit ExecPlan(ExecContext* ctx);
+
+  ExecContext default_exec_context_;
+  ExecContext* exec_context_;
+  std::vector<std::unique_ptr<ExecNode>> nodes_;
+  bool started_ = false;
+  Future<> finished_ = Future<>::Make();
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ExecPlan);
+};
+
+/// \brief A node of an ExecPlan
+///
+/// Nodes communicate by calling each other's "upstream" methods:
+/// InputReceived, ErrorReceived and InputFinished.  Each batch carries a
+/// sequence number which is unique among the batches emitted by one node;
+/// InputFinished gives the total number of batches emitted so that a node
+/// knows when it has received all of its input, regardless of the order in
+/// which batches arrived.
+///
+/// A batch may carry a selection vector, in which case only its selected rows
+/// belong to the stream.  This lets a filter defer materialization: nodes
+/// touch only the selected rows of the columns they use, and the remaining
+/// columns are not copied until the batch reaches a sink.
+class ARROW_EXPORT ExecNode {
+ public:
+  using NodeVector = std::vector<ExecNode*>;
+
+  virtual ~ExecNode() = default;
+
+  virtual const char* kind_name() const = 0;
+
+  int num_inputs() const { return static_cast<int>(inputs_.size()); }
+
+  /// This node's predecessors in the exec plan
+  const NodeVector& inputs() const { return inputs_; }
+
+  int num_outputs() const { return num_outputs_; }
+
+  /// This node's successors in the exec plan
+  const NodeVector& outputs() const { return outputs_; }
+
+  /// The datatypes for batches produced by this node
+  const std::shared_ptr<Schema>& output_schema() const { return output_schema_; }
+
+  /// This node's exec plan
+  ExecPlan* plan() { return plan_; }
+
+  /// \brief An optional label, for display and debugging
+  const std::string& label() const { return label_; }
+
+  /// \brief Check that this node is connected to as many outputs as it requires
+  Status Validate() const;
+
+  /// \brief Upstream API: an input has emitted a batch
+  ///
+  /// May be called concurrently from several threads.
+  virtual void InputReceived(ExecNode* input, int seq_num, ExecBatch batch) = 0;
+
+  /// \brief Upstream API: an input has failed.  No further batches will be
+  /// received from it.
+  virtual void ErrorReceived(ExecNode* input, Status error) = 0;
+
+  /// \brief Upstream API: an input has emitted all its batches
+  ///
+  /// num_total is the number of batches the input emitted.  Some of them may
+  /// not have been received yet.
+  virtual void InputFinished(ExecNode* input, int num_total) = 0;
+
+  /// \brief Start producing.  Only sources do any work here.
+  virtual Status StartProducing() = 0;
+
+  /// \brief Stop producing.  The node should finish as soon as possible,
+  /// dropping any further input.
+  virtual void StopProducing() = 0;
+
+  /// \brief A future which completes when this node will make no further
+  /// calls to its outputs and has no work in flight.
+  virtual Future<> finished() = 0;
+
+ protected:
+  ExecNode(ExecPlan* plan, std::string label, NodeVector inputs,
+           std::shared_ptr<Schema> output_schema, int num_outputs);
+
+  ExecPlan* plan_;
+  std::string label_;
+  NodeVector inputs_;
+  NodeVector outputs_;
+  std::shared_ptr<Schema> output_schema_;
+  int num_outputs_;
+};
+
+/// \brief A generator of ExecBatches for a source node.  An empty optional
+/// signals the end of the stream.
+using ExecBatchGenerator = std::function<Future<util::optional<ExecBatch>>()>;
+
+/// \brief Add a source node which pushes the batches of a generator.
+///
+/// The generator is never called concurrently.  When the plan has an
+/// executor, each batch is pushed to the outputs from a new task and the
+/// number of batches in flight is bounded by the executor's capacity, so a
+/// fast source does not run ahead of the rest of the plan.
+ARROW_EXPORT
+Result<ExecNode*> MakeSourceNode(ExecPlan* plan, std::string label,
+                                 std::shared_ptr<Schema> output_schema,
+                                 ExecBatchGenerator generator);
+
+/// \brief A batch transformation for a map node
+using ExecBatchMapper = std::function<Result<ExecBatch>(ExecBatch)>;
+
+/// \brief Add a node which applies a stateless transformation to each batch.
+///
+/// The mapper may be called concurrently and must produce batches matching
+/// output_schema.  It must honor the selection vector of the batches it
+/// receives, if any.  Sequence numbers are preserved.
+ARROW_EXPORT
+Result<ExecNode*> MakeMapNode(ExecNode* input, std::string label,
+                              std::shared_ptr<Schema> output_schema,
+                              ExecBatchMapper mapper);
+
+/// \brief Add a node which computes scalar aggregates of its input.
+///
+/// The i-th aggregate consumes the i-th column of the input, with a
+/// SCALAR_AGGREGATE function such as "sum" or "min_max".  Each batch is
+/// consumed as it arrives; once all input has been received a single batch
+/// of Scalars, one per aggregate, is emitted.  Output fields are named after
+/// their function.  The aggregates' options must outlive the plan.
+ARROW_EXPORT
+Result<ExecNode*> MakeScalarAggregateNode(ExecNode* input, std::string label,
+                                          std::vector<internal::Aggregate> aggregates);
+
+/// \brief A consumer of the batches reaching a sink node
+using ExecBatchConsumer = std::function<Status(ExecBatch)>;
+
+/// \brief Add a sink node which passes each batch it receives to a consumer.
+///
+/// The consumer is never called concurrently, but batches may arrive in any
+/// order.  Selection vectors are materialized before batches reach the
+/// consumer.  If the consumer returns an error, the plan is stopped and
+/// finishes with that error.
+ARROW_EXPORT
+Result<ExecNode*> MakeSinkNode(ExecNode* input, std::string label,
+                               ExecBatchConsumer consumer);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,343 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/exec/exec_plan.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace compute {
+
+using ::arrow::internal::checked_cast;
+
+// Yield the given batches, optionally completing each future on the CPU pool
+ExecBatchGenerator MakeVectorGenerator(std::vector<ExecBatch> batches,
+                                       bool async = false) {
+  auto state = std::make_shared<std::pair<std::vector<ExecBatch>, size_t>>(
+      std::move(batches), 0);
+  return [state, async]() -> Future<util::optional<ExecBatch>> {
+    util::optional<ExecBatch> next;
+    if (state->second < state->first.size()) {
+      next = state->first[state->second++];
+    }
+    if (!async) {
+      return Future<util::optional<ExecBatch>>::MakeFinished(std::move(next));
+    }
+    return DeferNotOk(::arrow::internal::GetCpuThreadPool()->Submit(
+        [next]() -> Result<util::optional<ExecBatch>> { return next; }));
+  };
+}
+
+std::shared_ptr<Schema> TestSchema() {
+  return schema({field("i32", int32()), field("f64", float64())});
+}
+
+// Make batches of consecutive values, [0, length) overall
+std::vector<ExecBatch> MakeTestBatches(int num_batches, int batch_length) {
+  std::vector<ExecBatch> batches;
+  for (int b = 0; b < num_batches; ++b) {
+    Int32Builder ints;
+    DoubleBuilder doubles;
+    for (int i = 0; i < batch_length; ++i) {
+      ABORT_NOT_OK(ints.Append(b * batch_length + i));
+      ABORT_NOT_OK(doubles.Append(0.5 * (b * batch_length + i)));
+    }
+    std::shared_ptr<Array> int_array, double_array;
+    ABORT_NOT_OK(ints.Finish(&int_array));
+    ABORT_NOT_OK(doubles.Finish(&double_array));
+    batches.emplace_back(std::vector<Datum>{int_array, double_array}, batch_length);
+  }
+  return batches;
+}
+
+class TestExecPlan : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() override {
+    ctx_.set_use_threads(GetParam());
+    ASSERT_OK_AND_ASSIGN(plan_, ExecPlan::Make(&ctx_));
+  }
+
+  ExecNode* AddCollectingSink(ExecNode* input) {
+    EXPECT_OK_AND_ASSIGN(auto sink, MakeSinkNode(input, "sink", [this](ExecBatch batch) {
+                           collected_.push_back(std::move(batch));
+                           return Status::OK();
+                         }));
+    return sink;
+  }
+
+  Status StartAndFinish() {
+    RETURN_NOT_OK(plan_->StartProducing());
+    auto finished = plan_->finished();
+    finished.Wait();
+    return finished.status();
+  }
+
+  // The int32 values collected, in sorted order
+  std::vector<int32_t> CollectedInts() {
+    std::vector<int32_t> values;
+    for (const auto& batch : collected_) {
+      auto array = batch.values[0].make_array();
+      const auto& ints = checked_cast<const Int32Array&>(*array);
+      for (int64_t i = 0; i < ints.length(); ++i) {
+        values.push_back(ints.Value(i));
+      }
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+  }
+
+ protected:
+  ExecContext ctx_;
+  std::shared_ptr<ExecPlan> plan_;
+  std::vector<ExecBatch> collected_;
+};
+
+TEST_P(TestExecPlan, Validate) {
+  ASSERT_RAISES(Invalid, plan_->Validate());
+
+  ASSERT_OK_AND_ASSIGN(auto source, MakeSourceNode(plan_.get(), "source", TestSchema(),
+                                                   MakeVectorGenerator({})));
+  // No sink
+  ASSERT_RAISES(Invalid, plan_->Validate());
+  ASSERT_RAISES(Invalid, plan_->StartProducing());
+
+  AddCollectingSink(source);
+  ASSERT_OK(plan_->Validate());
+  ASSERT_EQ(plan_->sources(), ExecPlan::NodeVector{source});
+  ASSERT_EQ(plan_->sinks().size(), 1);
+  ASSERT_RAISES(Invalid, MakeSinkNode(nullptr, "sink", nullptr));
+}
+
+TEST_P(TestExecPlan, SourceSink) {
+  for (bool async : {false, true}) {
+    ASSERT_OK_AND_ASSIGN(plan_, ExecPlan::Make(&ctx_));
+    collected_.clear();
+
+    ASSERT_OK_AND_ASSIGN(
+        auto source, MakeSourceNode(plan_.get(), "source", TestSchema(),
+                                    MakeVectorGenerator(MakeTestBatches(20, 5), async)));
+    AddCollectingSink(source);
+    ASSERT_OK(StartAndFinish());
+
+    ASSERT_EQ(collected_.size(), 20);
+    auto values = CollectedInts();
+    for (int32_t i = 0; i < 100; ++i) {
+      ASSERT_EQ(values[i], i);
+    }
+    ASSERT_RAISES(Invalid, plan_->StartProducing());
+  }
+}
+
+TEST_P(TestExecPlan, EmptySource) {
+  ASSERT_OK_AND_ASSIGN(auto source, MakeSourceNode(plan_.get(), "source", TestSchema(),
+                                                   MakeVectorGenerator({})));
+  AddCollectingSink(source);
+  ASSERT_OK(StartAndFinish());
+  ASSERT_TRUE(collected_.empty());
+}
+
+TEST_P(TestExecPlan, Map) {
+  ASSERT_OK_AND_ASSIGN(auto source,
+                       MakeSourceNode(plan_.get(), "source", TestSchema(),
+                                      MakeVectorGenerator(MakeTestBatches(10, 10))));
+  ASSERT_OK_AND_ASSIGN(
+      auto map,
+      MakeMapNode(source, "add_one", schema({field("i32", int32())}),
+                  [](ExecBatch batch) -> Result<ExecBatch> {
+                    ARROW_ASSIGN_OR_RAISE(Datum added,
+                                          Add(batch.values[0], Datum(int32_t(1))));
+                    return ExecBatch({std::move(added)}, batch.length);
+                  }));
+  AddCollectingSink(map);
+  ASSERT_OK(StartAndFinish());
+
+  auto values = CollectedInts();
+  ASSERT_EQ(values.size(), 100);
+  for (int32_t i = 0; i < 100; ++i) {
+    ASSERT_EQ(values[i], i + 1);
+  }
+}
+
+TEST_P(TestExecPlan, ScalarAggregate) {
+  ASSERT_OK_AND_ASSIGN(auto source,
+                       MakeSourceNode(plan_.get(), "source", TestSchema(),
+                                      MakeVectorGenerator(MakeTestBatches(50, 100))));
+  MinMaxOptions min_max_options;
+  ASSERT_OK_AND_ASSIGN(
+      auto aggregate,
+      MakeScalarAggregateNode(source, "aggregate",
+                              {{"sum", nullptr}, {"min_max", &min_max_options}}));
+  AssertSchemaEqual(*aggregate->output_schema(),
+                    *schema({field("sum", int64()),
+                             field("min_max", struct_({field("min", float64()),
+                                                       field("max", float64())}))}));
+  AddCollectingSink(aggregate);
+  ASSERT_OK(StartAndFinish());
+
+  ASSERT_EQ(collected_.size(), 1);
+  const ExecBatch& out = collected_[0];
+  ASSERT_EQ(out.length, 1);
+  AssertScalarsEqual(Int64Scalar(4999 * 5000 / 2), *out.values[0].scalar());
+  const auto& min_max = checked_cast<const StructScalar&>(*out.values[1].scalar());
+  AssertScalarsEqual(DoubleScalar(0), *min_max.value[0]);
+  AssertScalarsEqual(DoubleScalar(2499.5), *min_max.value[1]);
+}
+
+// Select the even values of each test batch
+std::vector<ExecBatch> SelectEven(std::vector<ExecBatch> batches) {
+  for (auto& batch : batches) {
+    Int32Builder indices;
+    int32_t first = checked_cast<const Int32Array&>(*batch.values[0].make_array())
+                        .Value(0);
+    for (int32_t i = first % 2; i < batch.length; i += 2) {
+      ABORT_NOT_OK(indices.Append(i));
+    }
+    std::shared_ptr<Array> index_array;
+    ABORT_NOT_OK(indices.Finish(&index_array));
+    batch.selection_vector = std::make_shared<SelectionVector>(*index_array);
+    batch.length = index_array->length();
+  }
+  return batches;
+}
+
+TEST_P(TestExecPlan, SelectionVectors) {
+  ASSERT_OK_AND_ASSIGN(
+      auto source,
+      MakeSourceNode(plan_.get(), "source", TestSchema(),
+                     MakeVectorGenerator(SelectEven(MakeTestBatches(10, 7)))));
+  AddCollectingSink(source);
+  ASSERT_OK(StartAndFinish());
+
+  // The sink only sees the selected rows
+  for (const auto& batch : collected_) {
+    ASSERT_EQ(batch.selection_vector, nullptr);
+    ASSERT_EQ(batch.values[0].length(), batch.length);
+  }
+  auto values = CollectedInts();
+  ASSERT_EQ(values.size(), 35);
+  for (int32_t i = 0; i < 35; ++i) {
+    ASSERT_EQ(values[i], 2 * i);
+  }
+}
+
+TEST_P(TestExecPlan, ScalarAggregateSelected) {
+  ASSERT_OK_AND_ASSIGN(
+      auto source,
+      MakeSourceNode(plan_.get(), "source", TestSchema(),
+                     MakeVectorGenerator(SelectEven(MakeTestBatches(50, 100)))));
+  MinMaxOptions min_max_options;
+  ASSERT_OK_AND_ASSIGN(
+      auto aggregate,
+      MakeScalarAggregateNode(source, "aggregate",
+                              {{"sum", nullptr}, {"min_max", &min_max_options}}));
+  AddCollectingSink(aggregate);
+  ASSERT_OK(StartAndFinish());
+
+  ASSERT_EQ(collected_.size(), 1);
+  const ExecBatch& out = collected_[0];
+  // 0 + 2 + ... + 4998
+  AssertScalarsEqual(Int64Scalar(2 * (2499 * 2500 / 2)), *out.values[0].scalar());
+  const auto& min_max = checked_cast<const StructScalar&>(*out.values[1].scalar());
+  AssertScalarsEqual(DoubleScalar(0), *min_max.value[0]);
+  AssertScalarsEqual(DoubleScalar(2499), *min_max.value[1]);
+}
+
+TEST_P(TestExecPlan, ScalarAggregateErrors) {
+  ASSERT_OK_AND_ASSIGN(auto source, MakeSourceNode(plan_.get(), "source", TestSchema(),
+                                                   MakeVectorGenerator({})));
+  ASSERT_RAISES(Invalid,
+                MakeScalarAggregateNode(source, "aggregate", {{"sum", nullptr}}));
+  ASSERT_RAISES(Invalid,
+                MakeScalarAggregateNode(source, "aggregate",
+                                        {{"add", nullptr}, {"sum", nullptr}}));
+  ASSERT_RAISES(KeyError,
+                MakeScalarAggregateNode(source, "aggregate",
+                                        {{"nonexistent", nullptr}, {"sum", nullptr}}));
+}
+
+TEST_P(TestExecPlan, SourceError) {
+  int count = 0;
+  ExecBatchGenerator generator = [&count]() -> Future<util::optional<ExecBatch>> {
+    if (++count > 3) {
+      return Future<util::optional<ExecBatch>>::MakeFinished(
+          Status::IOError("source failed"));
+    }
+    return Future<util::optional<ExecBatch>>::MakeFinished(MakeTestBatches(1, 10)[0]);
+  };
+  ASSERT_OK_AND_ASSIGN(auto source,
+                       MakeSourceNode(plan_.get(), "source", TestSchema(), generator));
+  AddCollectingSink(source);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(IOError, ::testing::HasSubstr("source failed"),
+                                  StartAndFinish());
+}
+
+TEST_P(TestExecPlan, ConsumerErrorStopsPlan) {
+  int pulled = 0;
+  ExecBatchGenerator generator = [&pulled]() -> Future<util::optional<ExecBatch>> {
+    ++pulled;
+    return Future<util::optional<ExecBatch>>::MakeFinished(MakeTestBatches(1, 10)[0]);
+  };
+  ASSERT_OK_AND_ASSIGN(auto source,
+                       MakeSourceNode(plan_.get(), "source", TestSchema(), generator));
+  ASSERT_OK(MakeSinkNode(source, "sink", [](ExecBatch) {
+              return Status::Invalid("consumer failed");
+            }).status());
+  // The generator never ends, so finishing at all means the plan was stopped
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("consumer failed"),
+                                  StartAndFinish());
+  ASSERT_GT(pulled, 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(Serial, TestExecPlan, ::testing::Values(false));
+INSTANTIATE_TEST_SUITE_P(Threaded, TestExecPlan, ::testing::Values(true));
+
+TEST(ExecBatch, RecordBatchRoundTrip) {
+  auto batch = RecordBatchFromJSON(TestSchema(), R"([{"i32": 1, "f64": 0.5},
+                                                     {"i32": null, "f64": 1.5}])");
+  ExecBatch exec_batch(*batch);
+  ASSERT_EQ(exec_batch.length, 2);
+  ASSERT_EQ(exec_batch.num_values(), 2);
+  ASSERT_OK_AND_ASSIGN(auto round_tripped, exec_batch.ToRecordBatch(TestSchema()));
+  AssertBatchesEqual(*batch, *round_tripped);
+
+  // Scalars are broadcast
+  exec_batch.values[1] = Datum(2.5);
+  ASSERT_OK_AND_ASSIGN(round_tripped, exec_batch.ToRecordBatch(TestSchema()));
+  AssertBatchesEqual(*RecordBatchFromJSON(TestSchema(), R"([{"i32": 1, "f64": 2.5},
+                                                          {"i32": null, "f64": 2.5}])"),
+                     *round_tripped);
+
+  ASSERT_RAISES(Invalid, exec_batch.ToRecordBatch(schema({field("i32", int32())})));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -51,6 +51,16 @@ class ARROW_EXPORT ExecBatchIterator {
   static Result<std::unique_ptr<ExecBatchIterator>> Make(
       std::vector<Datum> args, int64_t max_chunksize = kDefaultMaxChunksize);
 
+  /// \brief Construct iterator over the rows of args selected by a selection
+  /// vector, which may be null to select all rows
+  ///
+  /// Each batch holds the Scalar and Array args as they are, together with
+  /// the slice of the selection covering at most max_chunksize selected rows.
+  /// ChunkedArray args are not supported with a selection.
+  static Result<std::unique_ptr<ExecBatchIterator>> Make(
+      std::vector<Datum> args, std::shared_ptr<SelectionVector> selection,
+      int64_t max_chunksize = kDefaultMaxChunksize);
+
   /// \brief Compute the next batch. Always returns at least one batch. Return
   /// false if the iterator is exhausted
   bool Next(ExecBatch* batch);
@@ -65,6 +75,7 @@ class ARROW_EXPORT ExecBatchIterator {
   ExecBatchIterator(std::vector<Datum> args, int64_t length, int64_t max_chunksize);
 
   std::vector<Datum> args_;
+  std::shared_ptr<SelectionVector> selection_;
   std::vector<int> chunk_indexes_;
   std::vector<int64_t> chunk_positions_;
   int64_t position_;
@@ -110,7 +121,15 @@ class ARROW_EXPORT KernelExecutor {
 
   /// XXX: Better configurability for listener
   /// Not thread-safe
-  virtual Status Execute(const std::vector<Datum>& args, ExecListener* listener) = 0;
+  Status Execute(const std::vector<Datum>& args, ExecListener* listener) {
+    return Execute(args, /*selection=*/NULLPTR, listener);
+  }
+
+  /// \brief Execute on the rows of args selected by a selection vector, which
+  /// may be null to select all rows. Not thread-safe
+  virtual Status Execute(const std::vector<Datum>& args,
+                         const std::shared_ptr<SelectionVector>& selection,
+                         ExecListener* listener) = 0;
 
   virtual Datum WrapResults(const std::vector<Datum>& args,
                             const std::vector<Datum>& outputs) = 0;
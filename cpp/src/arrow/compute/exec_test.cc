@@ -25,6 +25,7 @@
 #include "arrow/testing/random.h"
 
 #include "arrow/array/array_base.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/array/data.h"
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
@@ -82,6 +83,62 @@ TEST(SelectionVector, Basics) {
 
   ASSERT_EQ(indices->length(), sel_vector->length());
   ASSERT_EQ(3, sel_vector->indices()[1]);
+
+  auto sliced = sel_vector->Slice(1, 1);
+  ASSERT_EQ(1, sliced->length());
+  ASSERT_EQ(3, sliced->indices()[0]);
+}
+
+TEST(SelectionVector, FromMask) {
+  auto CheckFromMask = [](const std::string& mask_json, const std::string& expected) {
+    auto mask = ArrayFromJSON(boolean(), mask_json);
+    ASSERT_OK_AND_ASSIGN(
+        auto sel_vector,
+        SelectionVector::FromMask(checked_cast<const BooleanArray&>(*mask)));
+    AssertArraysEqual(*ArrayFromJSON(int32(), expected), *MakeArray(sel_vector->data()),
+                      /*verbose=*/true);
+  };
+
+  CheckFromMask("[]", "[]");
+  CheckFromMask("[false, false]", "[]");
+  CheckFromMask("[true, false, true, true, false]", "[0, 2, 3]");
+  // Nulls are not selected
+  CheckFromMask("[true, null, true, null, false, true]", "[0, 2, 5]");
+
+  auto mask = ArrayFromJSON(boolean(), "[true, true, false, true, null, true]");
+  ASSERT_OK_AND_ASSIGN(auto sel_vector,
+                       SelectionVector::FromMask(
+                           checked_cast<const BooleanArray&>(*mask->Slice(1))));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 2, 4]"), *MakeArray(sel_vector->data()));
+}
+
+TEST(ExecBatch, Materialize) {
+  ExecBatch batch({ArrayFromJSON(int32(), "[1, 2, 3, null, 5]"), Datum(int32_t(7)),
+                   ArrayFromJSON(utf8(), R"(["a", "b", "c", "d", null])")},
+                  5);
+  ASSERT_OK_AND_ASSIGN(auto unchanged, batch.Materialize());
+  ASSERT_EQ(unchanged.values, batch.values);
+
+  batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[0, 3, 4]"));
+  batch.length = 3;
+  ASSERT_OK_AND_ASSIGN(auto materialized, batch.Materialize());
+  ASSERT_EQ(nullptr, materialized.selection_vector);
+  ASSERT_EQ(3, materialized.length);
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[1, null, 5]"), materialized[0]);
+  AssertDatumsEqual(Datum(int32_t(7)), materialized[1]);
+  AssertDatumsEqual(ArrayFromJSON(utf8(), R"(["a", "d", null])"), materialized[2]);
+
+  auto schema = ::arrow::schema(
+      {field("a", int32()), field("b", int32()), field("c", utf8())});
+  ASSERT_OK_AND_ASSIGN(auto record_batch, batch.ToRecordBatch(schema));
+  AssertBatchesEqual(*RecordBatchFromJSON(schema, R"([{"a": 1, "b": 7, "c": "a"},
+                                                      {"a": null, "b": 7, "c": "d"},
+                                                      {"a": 5, "b": 7, "c": null}])"),
+                     *record_batch);
+
+  batch.values.emplace_back(ChunkedArrayFromJSON(int32(), {"[1, 2]", "[3, 4, 5]"}));
+  ASSERT_RAISES(Invalid, batch.Materialize());
 }
 
 void AssertValidityZeroExtraBits(const ArrayData& arr) {
@@ -534,6 +591,121 @@ TEST_F(TestExecBatchIterator, ZeroLengthInputs) {
   CheckArgs(args);
 }
 
+TEST_F(TestExecBatchIterator, Selection) {
+  std::vector<Datum> args = {Datum(GetInt32Array(100)), Datum(GetFloat64Array(100)),
+                             Datum(std::make_shared<Int32Scalar>(3))};
+  auto indices = ArrayFromJSON(int32(), "[1, 5, 6, 20, 50, 51, 52, 99]");
+  auto selection = std::make_shared<SelectionVector>(*indices);
+
+  ASSERT_OK_AND_ASSIGN(iterator_,
+                       ExecBatchIterator::Make(args, selection, /*max_chunksize=*/3));
+  ASSERT_EQ(8, iterator_->length());
+
+  ExecBatch batch;
+  std::vector<int64_t> batch_sizes;
+  while (iterator_->Next(&batch)) {
+    // The values are passed on whole with a slice of the selection
+    ASSERT_EQ(args, batch.values);
+    ASSERT_NE(nullptr, batch.selection_vector);
+    ASSERT_EQ(batch.length, batch.selection_vector->length());
+    AssertArraysEqual(*indices->Slice(iterator_->position() - batch.length, batch.length),
+                      *MakeArray(batch.selection_vector->data()));
+    batch_sizes.push_back(batch.length);
+  }
+  ASSERT_EQ(batch_sizes, std::vector<int64_t>({3, 3, 2}));
+
+  // Without a selection, batches carry none
+  ASSERT_OK_AND_ASSIGN(iterator_, ExecBatchIterator::Make(args, nullptr));
+  ASSERT_TRUE(iterator_->Next(&batch));
+  ASSERT_EQ(nullptr, batch.selection_vector);
+  ASSERT_EQ(100, batch.length);
+
+  args.emplace_back(GetInt32Chunked({50, 50}));
+  ASSERT_RAISES(Invalid, ExecBatchIterator::Make(args, selection));
+  args = {Datum(GetInt32Array(100)), Datum(GetInt32Array(99))};
+  ASSERT_RAISES(Invalid, ExecBatchIterator::Make(args, selection));
+}
+
+// ----------------------------------------------------------------------
+// Function execution on selected rows
+
+class TestExecuteSelected : public TestComputeInternals {
+ public:
+  void SetUp() override {
+    TestComputeInternals::SetUp();
+    // Small chunks, so that selections span several batches
+    exec_ctx_->set_exec_chunksize(3);
+
+    batch_ = ExecBatch({ArrayFromJSON(int32(), "[1, 2, 3, null, 5, 6, 7, 8, 9, 10]"),
+                        ArrayFromJSON(float64(), "[0, 1, 2, 3, 4, 5, 6, 7, 8, null]"),
+                        Datum(int32_t(4))},
+                       10);
+    batch_.selection_vector = std::make_shared<SelectionVector>(
+        *ArrayFromJSON(int32(), "[0, 2, 3, 5, 6, 8, 9]"));
+    batch_.length = 7;
+  }
+
+  // Executing on the selection must give the same result as executing on the
+  // materialized batch
+  void CheckExecute(const std::string& func_name, std::vector<int> columns,
+                    const FunctionOptions* options = nullptr) {
+    ExecBatch args({}, batch_.length);
+    for (int i : columns) {
+      args.values.push_back(batch_.values[i]);
+    }
+    args.selection_vector = batch_.selection_vector;
+
+    ASSERT_OK_AND_ASSIGN(auto func, GetFunctionRegistry()->GetFunction(func_name));
+    ASSERT_OK_AND_ASSIGN(Datum actual, func->Execute(args, options, exec_ctx_.get()));
+    ASSERT_OK_AND_ASSIGN(auto materialized, args.Materialize());
+    ASSERT_OK_AND_ASSIGN(Datum expected, func->Execute(materialized.values, options,
+                                                       exec_ctx_.get()));
+    if (actual.is_arraylike()) {
+      ASSERT_EQ(actual.length(), batch_.length) << func_name;
+      ASSERT_OK_AND_ASSIGN(auto actual_array, Concatenate(actual.chunks()));
+      ASSERT_OK_AND_ASSIGN(auto expected_array, Concatenate(expected.chunks()));
+      AssertArraysEqual(*expected_array, *actual_array, /*verbose=*/true);
+    } else {
+      AssertDatumsEqual(expected, actual, /*verbose=*/true);
+    }
+  }
+
+ protected:
+  ExecBatch batch_;
+};
+
+TEST_F(TestExecuteSelected, Scalar) {
+  CheckExecute("add", {0, 2});
+  CheckExecute("multiply", {0, 0});
+  CheckExecute("greater", {0, 2});
+  CheckExecute("less_equal", {1, 1});
+  CheckExecute("subtract", {1, 1});
+  CheckExecute("is_null", {0});
+}
+
+TEST_F(TestExecuteSelected, ScalarAggregate) {
+  CheckExecute("sum", {0});
+  CheckExecute("mean", {1});
+  CheckExecute("count", {0});
+  CheckExecute("min_max", {1});
+}
+
+TEST_F(TestExecuteSelected, VectorAndMeta) {
+  CheckExecute("array_sort_indices", {0});
+  CheckExecute("unique", {0});
+  CheckExecute("sort_indices", {1});
+}
+
+TEST_F(TestExecuteSelected, NoSelection) {
+  batch_.selection_vector = nullptr;
+  batch_.length = 10;
+  ASSERT_OK_AND_ASSIGN(auto func, GetFunctionRegistry()->GetFunction("add"));
+  ASSERT_OK_AND_ASSIGN(Datum actual,
+                       func->Execute(ExecBatch({batch_[0], batch_[2]}, 10), nullptr,
+                                     exec_ctx_.get()));
+  ASSERT_EQ(actual.length(), 10);
+}
+
 // ----------------------------------------------------------------------
 // Scalar function execution
 
@@ -107,14 +107,20 @@ Result<const KernelType*> DispatchExactImpl(const Function& func,
                                 FormatArgTypes(values));
 }
 
-Result<Datum> Function::Execute(const std::vector<Datum>& args,
-                                const FunctionOptions* options, ExecContext* ctx) const {
+namespace {
+
+Result<Datum> ExecuteInternal(const Function& func, const std::vector<Datum>& args,
+                              const std::shared_ptr<SelectionVector>& selection,
+                              const FunctionOptions* options, ExecContext* ctx) {
   if (options == nullptr) {
-    options = default_options();
+    options = func.default_options();
   }
   if (ctx == nullptr) {
     ExecContext default_ctx;
-    return Execute(args, options, &default_ctx);
+    return ExecuteInternal(func, args, selection, options, &default_ctx);
+  }
+  if (func.kind() == Function::HASH_AGGREGATE) {
+    return Status::NotImplemented("Direct execution of HASH_AGGREGATE functions");
   }
   // type-check Datum arguments here. Really we'd like to avoid this as much as
   // possible
@@ -124,7 +130,7 @@ Result<Datum> Function::Execute(const std::vector<Datum>& args,
     inputs[i] = args[i].descr();
   }
 
-  ARROW_ASSIGN_OR_RAISE(auto kernel, DispatchExact(inputs));
+  ARROW_ASSIGN_OR_RAISE(auto kernel, func.DispatchExact(inputs));
   std::unique_ptr<KernelState> state;
 
   KernelContext kernel_ctx{ctx};
@@ -135,9 +141,9 @@ Result<Datum> Function::Execute(const std::vector<Datum>& args,
   }
 
   std::unique_ptr<detail::KernelExecutor> executor;
-  if (kind() == Function::SCALAR) {
+  if (func.kind() == Function::SCALAR) {
     executor = detail::KernelExecutor::MakeScalar();
-  } else if (kind() == Function::VECTOR) {
+  } else if (func.kind() == Function::VECTOR) {
     executor = detail::KernelExecutor::MakeVector();
   } else {
     executor = detail::KernelExecutor::MakeScalarAggregate();
@@ -145,10 +151,29 @@ Result<Datum> Function::Execute(const std::vector<Datum>& args,
   RETURN_NOT_OK(executor->Init(&kernel_ctx, {kernel, inputs, options}));
 
   auto listener = std::make_shared<detail::DatumAccumulator>();
-  RETURN_NOT_OK(executor->Execute(args, listener.get()));
+  RETURN_NOT_OK(executor->Execute(args, selection, listener.get()));
   return executor->WrapResults(args, listener->values());
 }
 
+}  // namespace
+
+Result<Datum> Function::Execute(const std::vector<Datum>& args,
+                                const FunctionOptions* options, ExecContext* ctx) const {
+  return ExecuteInternal(*this, args, /*selection=*/nullptr, options, ctx);
+}
+
+Result<Datum> Function::Execute(const ExecBatch& batch, const FunctionOptions* options,
+                                ExecContext* ctx) const {
+  if (batch.selection_vector == nullptr) {
+    return Execute(batch.values, options, ctx);
+  }
+  if (kind() == Function::META) {
+    ARROW_ASSIGN_OR_RAISE(auto materialized, batch.Materialize(ctx));
+    return Execute(materialized.values, options, ctx);
+  }
+  return ExecuteInternal(*this, batch.values, batch.selection_vector, options, ctx);
+}
+
 Status Function::Validate() const {
   if (!doc_->summary.empty()) {
     // Documentation given, check its contents
@@ -233,6 +258,20 @@ Result<const Kernel*> ScalarAggregateFunction::DispatchExact(
   return DispatchExactImpl(*this, kernels_, values);
 }
 
+Status HashAggregateFunction::AddKernel(HashAggregateKernel kernel) {
+  RETURN_NOT_OK(CheckArity(static_cast<int>(kernel.signature->in_types().size())));
+  if (arity_.is_varargs && !kernel.signature->is_varargs()) {
+    return Status::Invalid("Function accepts varargs but kernel signature does not");
+  }
+  kernels_.emplace_back(std::move(kernel));
+  return Status::OK();
+}
+
+Result<const Kernel*> HashAggregateFunction::DispatchExact(
+    const std::vector<ValueDescr>& values) const {
+  return DispatchExactImpl(*this, kernels_, values);
+}
+
 Result<Datum> MetaFunction::Execute(const std::vector<Datum>& args,
                                     const FunctionOptions* options,
                                     ExecContext* ctx) const {
@@ -230,5 +230,43 @@ TEST(ScalarAggregateFunction, DispatchExact) {
   ASSERT_TRUE(selected_kernel->signature->MatchesInputs(dispatch_args));
 }
 
+TEST(HashAggregateFunction, Basics) {
+  HashAggregateFunction func("hash_agg_test", Arity::Binary(), /*doc=*/nullptr);
+
+  ASSERT_EQ("hash_agg_test", func.name());
+  ASSERT_EQ(2, func.arity().num_args);
+  ASSERT_FALSE(func.arity().is_varargs);
+  ASSERT_EQ(Function::HASH_AGGREGATE, func.kind());
+}
+
+void NoopResize(KernelContext*, int64_t) {}
+void NoopHashMerge(KernelContext*, KernelState&&, const ArrayData&) {}
+
+TEST(HashAggregateFunction, DispatchExact) {
+  HashAggregateFunction func("hash_agg_test", Arity::Binary(), /*doc=*/nullptr);
+
+  std::vector<InputType> in_args = {ValueDescr::Array(int8()),
+                                    ValueDescr::Array(uint32())};
+  HashAggregateKernel kernel(std::move(in_args), int64(), NoopInit, NoopResize,
+                             NoopConsume, NoopHashMerge, NoopFinalize);
+  ASSERT_OK(func.AddKernel(kernel));
+
+  // Invalid arity
+  in_args = {float64()};
+  kernel.signature = std::make_shared<KernelSignature>(in_args, float64());
+  ASSERT_RAISES(Invalid, func.AddKernel(kernel));
+
+  std::vector<ValueDescr> dispatch_args = {ValueDescr::Array(int8()),
+                                           ValueDescr::Array(uint32())};
+  ASSERT_OK_AND_ASSIGN(const Kernel* selected_kernel, func.DispatchExact(dispatch_args));
+  ASSERT_EQ(func.kernels()[0], selected_kernel);
+
+  dispatch_args[0] = ValueDescr::Array(int16());
+  ASSERT_RAISES(NotImplemented, func.DispatchExact(dispatch_args));
+
+  // Grouped aggregations cannot be executed directly
+  ASSERT_RAISES(NotImplemented, func.Execute({}, /*options=*/nullptr, /*ctx=*/nullptr));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,1379 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/util.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/exec_internal.h"
+#include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/common.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/bitmap_reader.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/make_unique.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Key encoding
+//
+// Composite keys are encoded row-wise into a single byte string per row, so
+// that a single BinaryMemoTable can assign group ids regardless of the number
+// and types of the key columns.  Each column contributes a validity byte
+// followed by its value bytes.  Encoding is done a column at a time over the
+// whole batch.
+
+struct KeyEncoder {
+  static constexpr uint8_t kValidByte = 0;
+  static constexpr uint8_t kNullByte = 1;
+
+  virtual ~KeyEncoder() = default;
+
+  // Add the encoded length of each row of `data` to `lengths`
+  virtual void AddLength(const ArrayData& data, int64_t* lengths) = 0;
+
+  // Encode each row of `data` at `encoded_bytes[i]`, advancing the pointers
+  virtual void Encode(const ArrayData& data, uint8_t** encoded_bytes) = 0;
+
+  // Decode `length` rows, advancing the pointers
+  virtual Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                                    int32_t length,
+                                                    MemoryPool* pool) = 0;
+
+  template <typename VisitFunc>
+  static void VisitValidity(const ArrayData& data, VisitFunc&& visit) {
+    if (data.GetNullCount() == 0) {
+      for (int64_t i = 0; i < data.length; ++i) {
+        visit(i, true);
+      }
+      return;
+    }
+    ::arrow::internal::BitmapReader reader(data.buffers[0]->data(), data.offset,
+                                           data.length);
+    for (int64_t i = 0; i < data.length; ++i) {
+      visit(i, reader.IsSet());
+      reader.Next();
+    }
+  }
+
+  static Result<std::shared_ptr<Buffer>> DecodeValidity(const uint8_t** encoded_bytes,
+                                                        int32_t length,
+                                                        MemoryPool* pool,
+                                                        int64_t* null_count) {
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap, AllocateBitmap(length, pool));
+    uint8_t* validity = null_bitmap->mutable_data();
+    *null_count = 0;
+    for (int32_t i = 0; i < length; ++i) {
+      const bool is_valid = encoded_bytes[i][0] == kValidByte;
+      BitUtil::SetBitTo(validity, i, is_valid);
+      *null_count += !is_valid;
+      encoded_bytes[i] += 1;
+    }
+    if (*null_count == 0) {
+      return std::shared_ptr<Buffer>();
+    }
+    return std::move(null_bitmap);
+  }
+};
+
+struct BooleanKeyEncoder : KeyEncoder {
+  static constexpr int kByteWidth = 1;
+
+  void AddLength(const ArrayData& data, int64_t* lengths) override {
+    for (int64_t i = 0; i < data.length; ++i) {
+      lengths[i] += 1 + kByteWidth;
+    }
+  }
+
+  void Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    const uint8_t* values = data.buffers[1]->data();
+    VisitValidity(data, [&](int64_t i, bool is_valid) {
+      uint8_t*& encoded_ptr = encoded_bytes[i];
+      *encoded_ptr++ = is_valid ? kValidByte : kNullByte;
+      *encoded_ptr++ = is_valid && BitUtil::GetBit(values, data.offset + i);
+    });
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                            int32_t length, MemoryPool* pool) override {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap,
+                          DecodeValidity(encoded_bytes, length, pool, &null_count));
+
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBitmap(length, pool));
+    uint8_t* raw_output = key_buf->mutable_data();
+    for (int32_t i = 0; i < length; ++i) {
+      BitUtil::SetBitTo(raw_output, i, encoded_bytes[i][0] != 0);
+      encoded_bytes[i] += kByteWidth;
+    }
+
+    return ArrayData::Make(boolean(), length,
+                           {std::move(null_bitmap), std::move(key_buf)}, null_count);
+  }
+};
+
+struct FixedWidthKeyEncoder : KeyEncoder {
+  explicit FixedWidthKeyEncoder(std::shared_ptr<DataType> type)
+      : type_(std::move(type)),
+        byte_width_(checked_cast<const FixedWidthType&>(*type_).bit_width() / 8) {}
+
+  void AddLength(const ArrayData& data, int64_t* lengths) override {
+    for (int64_t i = 0; i < data.length; ++i) {
+      lengths[i] += 1 + byte_width_;
+    }
+  }
+
+  void Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    const uint8_t* values = data.buffers[1]->data() + data.offset * byte_width_;
+    VisitValidity(data, [&](int64_t i, bool is_valid) {
+      uint8_t*& encoded_ptr = encoded_bytes[i];
+      if (is_valid) {
+        *encoded_ptr++ = kValidByte;
+        std::memcpy(encoded_ptr, values + i * byte_width_, byte_width_);
+      } else {
+        *encoded_ptr++ = kNullByte;
+        std::memset(encoded_ptr, 0, byte_width_);
+      }
+      encoded_ptr += byte_width_;
+    });
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                            int32_t length, MemoryPool* pool) override {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap,
+                          DecodeValidity(encoded_bytes, length, pool, &null_count));
+
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBuffer(length * byte_width_, pool));
+    uint8_t* raw_output = key_buf->mutable_data();
+    for (int32_t i = 0; i < length; ++i) {
+      std::memcpy(raw_output + i * byte_width_, encoded_bytes[i], byte_width_);
+      encoded_bytes[i] += byte_width_;
+    }
+
+    return ArrayData::Make(type_, length, {std::move(null_bitmap), std::move(key_buf)},
+                           null_count);
+  }
+
+  std::shared_ptr<DataType> type_;
+  int byte_width_;
+};
+
+template <typename T>
+struct VarLengthKeyEncoder : KeyEncoder {
+  using Offset = typename T::offset_type;
+
+  explicit VarLengthKeyEncoder(std::shared_ptr<DataType> type) : type_(std::move(type)) {}
+
+  // Null keys are encoded with a zero length and no payload, whatever their
+  // slot in the offsets and values buffers holds
+  void AddLength(const ArrayData& data, int64_t* lengths) override {
+    const Offset* offsets = data.GetValues<Offset>(1);
+    VisitValidity(data, [&](int64_t i, bool is_valid) {
+      lengths[i] += 1 + sizeof(Offset) + (is_valid ? offsets[i + 1] - offsets[i] : 0);
+    });
+  }
+
+  void Encode(const ArrayData& data, uint8_t** encoded_bytes) override {
+    const Offset* offsets = data.GetValues<Offset>(1);
+    const uint8_t* values = data.buffers[2] ? data.buffers[2]->data() : NULLPTR;
+    VisitValidity(data, [&](int64_t i, bool is_valid) {
+      uint8_t*& encoded_ptr = encoded_bytes[i];
+      const Offset value_length = is_valid ? offsets[i + 1] - offsets[i] : 0;
+      *encoded_ptr++ = is_valid ? kValidByte : kNullByte;
+      std::memcpy(encoded_ptr, &value_length, sizeof(Offset));
+      encoded_ptr += sizeof(Offset);
+      if (value_length > 0) {
+        std::memcpy(encoded_ptr, values + offsets[i], value_length);
+        encoded_ptr += value_length;
+      }
+    });
+  }
+
+  Result<std::shared_ptr<ArrayData>> Decode(const uint8_t** encoded_bytes,
+                                            int32_t length, MemoryPool* pool) override {
+    int64_t null_count;
+    ARROW_ASSIGN_OR_RAISE(auto null_bitmap,
+                          DecodeValidity(encoded_bytes, length, pool, &null_count));
+
+    ARROW_ASSIGN_OR_RAISE(auto offset_buf,
+                          AllocateBuffer(sizeof(Offset) * (length + 1), pool));
+    auto raw_offsets = reinterpret_cast<Offset*>(offset_buf->mutable_data());
+    raw_offsets[0] = 0;
+    for (int32_t i = 0; i < length; ++i) {
+      Offset value_length;
+      std::memcpy(&value_length, encoded_bytes[i], sizeof(Offset));
+      if (ARROW_PREDICT_FALSE(value_length >
+                              std::numeric_limits<Offset>::max() - raw_offsets[i])) {
+        return Status::CapacityError("Unique keys do not fit in a ", type_->ToString(),
+                                     " array");
+      }
+      raw_offsets[i + 1] = raw_offsets[i] + value_length;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto key_buf, AllocateBuffer(raw_offsets[length], pool));
+    uint8_t* raw_keys = key_buf->mutable_data();
+    for (int32_t i = 0; i < length; ++i) {
+      const Offset value_length = raw_offsets[i + 1] - raw_offsets[i];
+      encoded_bytes[i] += sizeof(Offset);
+      std::memcpy(raw_keys + raw_offsets[i], encoded_bytes[i], value_length);
+      encoded_bytes[i] += value_length;
+    }
+
+    return ArrayData::Make(
+        type_, length,
+        {std::move(null_bitmap), std::move(offset_buf), std::move(key_buf)}, null_count);
+  }
+
+  std::shared_ptr<DataType> type_;
+};
+
+Result<std::shared_ptr<ArrayData>> BroadcastKey(const Datum& key, int64_t length,
+                                                MemoryPool* pool) {
+  if (key.is_array()) {
+    return key.array();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto array, MakeArrayFromScalar(*key.scalar(), length, pool));
+  return array->data();
+}
+
+// ----------------------------------------------------------------------
+// Grouper implementations
+
+// Accumulate the results of memo table lookups as a UInt32 array of group ids,
+// null where the key was not found
+class GroupIdLookupBuilder {
+ public:
+  explicit GroupIdLookupBuilder(MemoryPool* pool)
+      : group_ids_(pool), validity_(pool) {}
+
+  Status Reserve(int64_t length) {
+    RETURN_NOT_OK(group_ids_.Reserve(length));
+    return validity_.Reserve(length);
+  }
+
+  void UnsafeAppend(int32_t memo_index) {
+    const bool found = memo_index != ::arrow::internal::kKeyNotFound;
+    group_ids_.UnsafeAppend(found ? static_cast<uint32_t>(memo_index) : 0);
+    validity_.UnsafeAppend(found);
+  }
+
+  Result<Datum> Finish() {
+    const int64_t length = group_ids_.length();
+    const int64_t null_count = validity_.false_count();
+    std::shared_ptr<Buffer> group_ids, null_bitmap;
+    RETURN_NOT_OK(group_ids_.Finish(&group_ids));
+    RETURN_NOT_OK(validity_.Finish(&null_bitmap));
+    if (null_count == 0) {
+      null_bitmap = nullptr;
+    }
+    return Datum(ArrayData::Make(uint32(), length,
+                                 {std::move(null_bitmap), std::move(group_ids)},
+                                 null_count));
+  }
+
+ private:
+  TypedBufferBuilder<uint32_t> group_ids_;
+  TypedBufferBuilder<bool> validity_;
+};
+
+// General grouper for any number of keys, backed by a BinaryMemoTable of
+// encoded rows
+struct GrouperImpl : Grouper {
+  explicit GrouperImpl(MemoryPool* pool) : pool_(pool), memo_table_(pool) {}
+
+  static Result<std::unique_ptr<GrouperImpl>> Make(const std::vector<ValueDescr>& keys,
+                                                   MemoryPool* pool) {
+    auto impl = ::arrow::internal::make_unique<GrouperImpl>(pool);
+
+    impl->encoders_.resize(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+      const auto& key = keys[i].type;
+
+      if (key->id() == Type::BOOL) {
+        impl->encoders_[i] = ::arrow::internal::make_unique<BooleanKeyEncoder>();
+        continue;
+      }
+
+      if (is_fixed_width(key->id()) && key->id() != Type::DICTIONARY) {
+        impl->encoders_[i] = ::arrow::internal::make_unique<FixedWidthKeyEncoder>(key);
+        continue;
+      }
+
+      if (is_binary_like(key->id())) {
+        impl->encoders_[i] =
+            ::arrow::internal::make_unique<VarLengthKeyEncoder<BinaryType>>(key);
+        continue;
+      }
+
+      if (is_large_binary_like(key->id())) {
+        impl->encoders_[i] =
+            ::arrow::internal::make_unique<VarLengthKeyEncoder<LargeBinaryType>>(key);
+        continue;
+      }
+
+      return Status::NotImplemented("Keys of type ", *key);
+    }
+
+    return std::move(impl);
+  }
+
+  // Encode each row of the batch into key_bytes_batch_, at offsets_batch_
+  Status EncodeBatch(const ExecBatch& batch) {
+    if (batch.num_values() != static_cast<int>(encoders_.size())) {
+      return Status::Invalid("Expected batch with ", encoders_.size(),
+                             " keys, got a batch with ", batch.num_values());
+    }
+
+    std::vector<std::shared_ptr<ArrayData>> keys(encoders_.size());
+    for (size_t i = 0; i < encoders_.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(keys[i], BroadcastKey(batch[i], batch.length, pool_));
+    }
+
+    // Compute the encoded length of each row, then its offset in the batch's
+    // key buffer
+    offsets_batch_.assign(batch.length + 1, 0);
+    for (size_t i = 0; i < keys.size(); ++i) {
+      encoders_[i]->AddLength(*keys[i], offsets_batch_.data());
+    }
+    int64_t total_length = 0;
+    for (int64_t i = 0; i < batch.length; ++i) {
+      const int64_t row_length = offsets_batch_[i];
+      offsets_batch_[i] = total_length;
+      total_length += row_length;
+    }
+    offsets_batch_[batch.length] = total_length;
+
+    key_bytes_batch_.resize(total_length);
+    key_buf_ptrs_.resize(batch.length);
+    for (int64_t i = 0; i < batch.length; ++i) {
+      key_buf_ptrs_[i] = key_bytes_batch_.data() + offsets_batch_[i];
+    }
+    for (size_t i = 0; i < keys.size(); ++i) {
+      encoders_[i]->Encode(*keys[i], key_buf_ptrs_.data());
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Consume(const ExecBatch& batch) override {
+    RETURN_NOT_OK(EncodeBatch(batch));
+
+    TypedBufferBuilder<uint32_t> group_ids_batch(pool_);
+    RETURN_NOT_OK(group_ids_batch.Resize(batch.length));
+    for (int64_t i = 0; i < batch.length; ++i) {
+      int32_t group_id;
+      RETURN_NOT_OK(memo_table_.GetOrInsert(key_bytes_batch_.data() + offsets_batch_[i],
+                                            offsets_batch_[i + 1] - offsets_batch_[i],
+                                            &group_id));
+      group_ids_batch.UnsafeAppend(static_cast<uint32_t>(group_id));
+    }
+
+    std::shared_ptr<Buffer> group_ids;
+    RETURN_NOT_OK(group_ids_batch.Finish(&group_ids));
+    return Datum(ArrayData::Make(uint32(), batch.length, {nullptr, std::move(group_ids)},
+                                 /*null_count=*/0));
+  }
+
+  Result<Datum> Lookup(const ExecBatch& batch) override {
+    RETURN_NOT_OK(EncodeBatch(batch));
+
+    GroupIdLookupBuilder group_ids_batch(pool_);
+    RETURN_NOT_OK(group_ids_batch.Reserve(batch.length));
+    for (int64_t i = 0; i < batch.length; ++i) {
+      group_ids_batch.UnsafeAppend(
+          memo_table_.Get(key_bytes_batch_.data() + offsets_batch_[i],
+                          offsets_batch_[i + 1] - offsets_batch_[i]));
+    }
+    return group_ids_batch.Finish();
+  }
+
+  uint32_t num_groups() const override {
+    return static_cast<uint32_t>(memo_table_.size());
+  }
+
+  Result<ExecBatch> GetUniques() override {
+    const int32_t length = static_cast<int32_t>(num_groups());
+
+    // Decode directly from the keys stored in the memo table
+    std::vector<const uint8_t*> key_buf_ptrs;
+    key_buf_ptrs.reserve(length);
+    memo_table_.VisitValues(0, [&](const util::string_view& key) {
+      key_buf_ptrs.push_back(reinterpret_cast<const uint8_t*>(key.data()));
+    });
+
+    ExecBatch out({}, length);
+    out.values.resize(encoders_.size());
+    for (size_t i = 0; i < encoders_.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(out.values[i],
+                            encoders_[i]->Decode(key_buf_ptrs.data(), length, pool_));
+    }
+    return out;
+  }
+
+  MemoryPool* pool_;
+  std::vector<std::unique_ptr<KeyEncoder>> encoders_;
+  ::arrow::internal::BinaryMemoTable<LargeBinaryBuilder> memo_table_;
+
+  // Scratch space reused across batches
+  std::vector<int64_t> offsets_batch_;
+  std::vector<uint8_t> key_bytes_batch_;
+  std::vector<uint8_t*> key_buf_ptrs_;
+};
+
+// Fast path for a single key column of a primitive C type, which avoids the
+// key encoding step altogether
+template <typename Type>
+struct ScalarGrouperImpl : Grouper {
+  using CType = typename Type::c_type;
+  using MemoTableType = typename ::arrow::internal::HashTraits<Type>::MemoTableType;
+
+  ScalarGrouperImpl(std::shared_ptr<DataType> type, MemoryPool* pool)
+      : type_(std::move(type)), pool_(pool), memo_table_(pool) {}
+
+  Result<Datum> Consume(const ExecBatch& batch) override {
+    if (batch.num_values() != 1) {
+      return Status::Invalid("Expected batch with 1 key, got a batch with ",
+                             batch.num_values());
+    }
+    ARROW_ASSIGN_OR_RAISE(auto key, BroadcastKey(batch[0], batch.length, pool_));
+
+    TypedBufferBuilder<uint32_t> group_ids_batch(pool_);
+    RETURN_NOT_OK(group_ids_batch.Resize(batch.length));
+    RETURN_NOT_OK(VisitArrayDataInline<Type>(
+        *key,
+        [&](CType value) {
+          int32_t group_id;
+          RETURN_NOT_OK(memo_table_.GetOrInsert(value, &group_id));
+          group_ids_batch.UnsafeAppend(static_cast<uint32_t>(group_id));
+          return Status::OK();
+        },
+        [&]() {
+          group_ids_batch.UnsafeAppend(
+              static_cast<uint32_t>(memo_table_.GetOrInsertNull()));
+          return Status::OK();
+        }));
+
+    std::shared_ptr<Buffer> group_ids;
+    RETURN_NOT_OK(group_ids_batch.Finish(&group_ids));
+    return Datum(ArrayData::Make(uint32(), batch.length, {nullptr, std::move(group_ids)},
+                                 /*null_count=*/0));
+  }
+
+  Result<Datum> Lookup(const ExecBatch& batch) override {
+    if (batch.num_values() != 1) {
+      return Status::Invalid("Expected batch with 1 key, got a batch with ",
+                             batch.num_values());
+    }
+    ARROW_ASSIGN_OR_RAISE(auto key, BroadcastKey(batch[0], batch.length, pool_));
+
+    GroupIdLookupBuilder group_ids_batch(pool_);
+    RETURN_NOT_OK(group_ids_batch.Reserve(batch.length));
+    VisitArrayDataInline<Type>(
+        *key, [&](CType value) { group_ids_batch.UnsafeAppend(memo_table_.Get(value)); },
+        [&]() { group_ids_batch.UnsafeAppend(memo_table_.GetNull()); });
+    return group_ids_batch.Finish();
+  }
+
+  uint32_t num_groups() const override {
+    return static_cast<uint32_t>(memo_table_.size());
+  }
+
+  Result<ExecBatch> GetUniques() override {
+    const int64_t length = static_cast<int64_t>(num_groups());
+
+    ARROW_ASSIGN_OR_RAISE(auto values, AllocateBuffer(length * sizeof(CType), pool_));
+    auto raw_values = reinterpret_cast<CType*>(values->mutable_data());
+    memo_table_.CopyValues(0, raw_values);
+
+    int64_t null_count;
+    std::shared_ptr<Buffer> null_bitmap;
+    RETURN_NOT_OK(::arrow::internal::ComputeNullBitmap(pool_, memo_table_, 0, &null_count,
+                                                       &null_bitmap));
+    if (null_count > 0) {
+      // The null slot is not written by CopyValues
+      raw_values[memo_table_.GetNull()] = CType{};
+    }
+
+    return ExecBatch(
+        {ArrayData::Make(type_, length, {std::move(null_bitmap), std::move(values)},
+                         null_count)},
+        length);
+  }
+
+  std::shared_ptr<DataType> type_;
+  MemoryPool* pool_;
+  MemoTableType memo_table_;
+};
+
+struct ScalarGrouperFactory {
+  Status Visit(const DataType&) { return Status::OK(); }
+
+  Status Visit(const BooleanType&) { return Status::OK(); }
+
+  template <typename Type>
+  enable_if_t<has_c_type<Type>::value, Status> Visit(const Type&) {
+    out = ::arrow::internal::make_unique<ScalarGrouperImpl<Type>>(type, pool);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> type;
+  MemoryPool* pool;
+  std::unique_ptr<Grouper> out;
+};
+
+// ----------------------------------------------------------------------
+// Grouped aggregators
+
+struct GroupedAggregator : public KernelState {
+  virtual Status Resize(KernelContext* ctx, int64_t new_num_groups) = 0;
+
+  virtual Status Consume(KernelContext* ctx, const ExecBatch& batch) = 0;
+
+  virtual Status Merge(KernelContext* ctx, GroupedAggregator&& other,
+                       const ArrayData& group_id_mapping) = 0;
+
+  virtual Status Finalize(KernelContext* ctx, Datum* out) = 0;
+
+  int64_t num_groups() const { return num_groups_; }
+
+ protected:
+  // Grow `builder` to `num_groups_` elements, filling new slots with `value`
+  template <typename T>
+  Status GrowTo(TypedBufferBuilder<T>* builder, T value) {
+    const int64_t added_groups = num_groups_ - builder->length();
+    if (added_groups > 0) {
+      RETURN_NOT_OK(builder->Append(added_groups, value));
+    }
+    return Status::OK();
+  }
+
+  int64_t num_groups_ = 0;
+};
+
+// Call `visit(group_id, value)` for each non-null value of the batch's
+// argument, and `visit_null(group_id)` for each null
+template <typename Type, typename VisitFunc, typename NullFunc>
+void VisitGroupedValues(const ExecBatch& batch, VisitFunc&& visit,
+                        NullFunc&& visit_null) {
+  const uint32_t* g = batch[1].array()->GetValues<uint32_t>(1);
+  VisitArrayDataInline<Type>(
+      *batch[0].array(), [&](typename GetViewType<Type>::T value) { visit(*g++, value); },
+      [&]() { visit_null(*g++); });
+}
+
+// Compute a validity bitmap which is set where `counts[i] > min_count`
+Status CountsToValidity(KernelContext* ctx, const int64_t* counts, int64_t num_groups,
+                        int64_t min_count, std::shared_ptr<Buffer>* null_bitmap,
+                        int64_t* null_count) {
+  *null_count = 0;
+  for (int64_t i = 0; i < num_groups; ++i) {
+    *null_count += counts[i] <= min_count;
+  }
+  *null_bitmap = nullptr;
+  if (*null_count > 0) {
+    ARROW_ASSIGN_OR_RAISE(*null_bitmap, ctx->AllocateBitmap(num_groups));
+    uint8_t* validity = (*null_bitmap)->mutable_data();
+    for (int64_t i = 0; i < num_groups; ++i) {
+      BitUtil::SetBitTo(validity, i, counts[i] > min_count);
+    }
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Count implementation
+
+struct GroupedCountImpl : public GroupedAggregator {
+  GroupedCountImpl(CountOptions options, MemoryPool* pool)
+      : options_(std::move(options)), counts_(pool) {}
+
+  Status Resize(KernelContext* ctx, int64_t new_num_groups) override {
+    num_groups_ = new_num_groups;
+    return GrowTo(&counts_, int64_t(0));
+  }
+
+  Status Consume(KernelContext* ctx, const ExecBatch& batch) override {
+    const ArrayData& input = *batch[0].array();
+    const uint32_t* g = batch[1].array()->GetValues<uint32_t>(1);
+    int64_t* counts = counts_.mutable_data();
+
+    const int64_t null_count = input.GetNullCount();
+    const bool count_nulls = options_.count_mode == CountOptions::COUNT_NULL;
+    if (null_count == 0 || null_count == input.length) {
+      // Either every value or no value is counted
+      if ((null_count == 0) != count_nulls) {
+        for (int64_t i = 0; i < input.length; ++i) {
+          ++counts[g[i]];
+        }
+      }
+      return Status::OK();
+    }
+
+    ::arrow::internal::BitmapReader reader(input.buffers[0]->data(), input.offset,
+                                           input.length);
+    for (int64_t i = 0; i < input.length; ++i) {
+      counts[g[i]] += reader.IsSet() != count_nulls;
+      reader.Next();
+    }
+    return Status::OK();
+  }
+
+  Status Merge(KernelContext* ctx, GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedCountImpl*>(&raw_other);
+    const uint32_t* g = group_id_mapping.GetValues<uint32_t>(1);
+    int64_t* counts = counts_.mutable_data();
+    const int64_t* other_counts = other->counts_.mutable_data();
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      counts[g[other_g]] += other_counts[other_g];
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(KernelContext* ctx, Datum* out) override {
+    std::shared_ptr<Buffer> counts;
+    RETURN_NOT_OK(counts_.Finish(&counts));
+    *out = ArrayData::Make(int64(), num_groups_, {nullptr, std::move(counts)},
+                           /*null_count=*/0);
+    return Status::OK();
+  }
+
+  CountOptions options_;
+  TypedBufferBuilder<int64_t> counts_;
+};
+
+// ----------------------------------------------------------------------
+// Sum / Mean implementation
+
+template <typename Type>
+struct GroupedSumImpl : public GroupedAggregator {
+  using AccType = typename FindAccumulatorType<Type>::Type;
+  using AccCType = typename AccType::c_type;
+
+  explicit GroupedSumImpl(MemoryPool* pool) : sums_(pool), counts_(pool) {}
+
+  Status Resize(KernelContext* ctx, int64_t new_num_groups) override {
+    num_groups_ = new_num_groups;
+    RETURN_NOT_OK(GrowTo(&sums_, AccCType(0)));
+    return GrowTo(&counts_, int64_t(0));
+  }
+
+  Status Consume(KernelContext* ctx, const ExecBatch& batch) override {
+    AccCType* sums = sums_.mutable_data();
+    int64_t* counts = counts_.mutable_data();
+    VisitGroupedValues<Type>(
+        batch,
+        [&](uint32_t g, typename GetViewType<Type>::T value) {
+          sums[g] += static_cast<AccCType>(value);
+          ++counts[g];
+        },
+        [](uint32_t) {});
+    return Status::OK();
+  }
+
+  Status Merge(KernelContext* ctx, GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedSumImpl*>(&raw_other);
+    const uint32_t* g = group_id_mapping.GetValues<uint32_t>(1);
+    AccCType* sums = sums_.mutable_data();
+    int64_t* counts = counts_.mutable_data();
+    const AccCType* other_sums = other->sums_.mutable_data();
+    const int64_t* other_counts = other->counts_.mutable_data();
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      sums[g[other_g]] += other_sums[other_g];
+      counts[g[other_g]] += other_counts[other_g];
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(KernelContext* ctx, Datum* out) override {
+    // Groups without any non-null value have a null sum
+    std::shared_ptr<Buffer> null_bitmap;
+    int64_t null_count;
+    RETURN_NOT_OK(CountsToValidity(ctx, counts_.mutable_data(), num_groups_,
+                                   /*min_count=*/0, &null_bitmap, &null_count));
+
+    std::shared_ptr<Buffer> sums;
+    RETURN_NOT_OK(sums_.Finish(&sums));
+    *out = ArrayData::Make(TypeTraits<AccType>::type_singleton(), num_groups_,
+                           {std::move(null_bitmap), std::move(sums)}, null_count);
+    return Status::OK();
+  }
+
+  TypedBufferBuilder<AccCType> sums_;
+  TypedBufferBuilder<int64_t> counts_;
+};
+
+template <typename Type>
+struct GroupedMeanImpl : public GroupedSumImpl<Type> {
+  using GroupedSumImpl<Type>::GroupedSumImpl;
+
+  Status Finalize(KernelContext* ctx, Datum* out) override {
+    const int64_t num_groups = this->num_groups_;
+    std::shared_ptr<Buffer> null_bitmap;
+    int64_t null_count;
+    const int64_t* counts = this->counts_.mutable_data();
+    RETURN_NOT_OK(CountsToValidity(ctx, counts, num_groups, /*min_count=*/0,
+                                   &null_bitmap, &null_count));
+
+    ARROW_ASSIGN_OR_RAISE(auto means, ctx->Allocate(num_groups * sizeof(double)));
+    auto raw_means = reinterpret_cast<double*>(means->mutable_data());
+    const auto* sums = this->sums_.mutable_data();
+    for (int64_t i = 0; i < num_groups; ++i) {
+      raw_means[i] =
+          counts[i] > 0 ? static_cast<double>(sums[i]) / static_cast<double>(counts[i])
+                        : 0;
+    }
+
+    *out = ArrayData::Make(float64(), num_groups,
+                           {std::move(null_bitmap), std::move(means)}, null_count);
+    return Status::OK();
+  }
+};
+
+// ----------------------------------------------------------------------
+// MinMax implementation
+
+template <typename CType, typename Enable = void>
+struct AntiExtrema {
+  static constexpr CType anti_min() { return std::numeric_limits<CType>::max(); }
+  static constexpr CType anti_max() { return std::numeric_limits<CType>::min(); }
+};
+
+template <typename CType>
+struct AntiExtrema<CType, enable_if_t<std::is_floating_point<CType>::value>> {
+  static constexpr CType anti_min() { return std::numeric_limits<CType>::infinity(); }
+  static constexpr CType anti_max() { return -std::numeric_limits<CType>::infinity(); }
+};
+
+template <typename CType, typename Enable = void>
+struct MinMaxOp {
+  static CType min(CType a, CType b) { return std::min(a, b); }
+  static CType max(CType a, CType b) { return std::max(a, b); }
+};
+
+template <typename CType>
+struct MinMaxOp<CType, enable_if_t<std::is_floating_point<CType>::value>> {
+  // Consistent with the scalar min_max kernel, NaNs are ignored
+  static CType min(CType a, CType b) { return std::fmin(a, b); }
+  static CType max(CType a, CType b) { return std::fmax(a, b); }
+};
+
+template <typename Type>
+struct GroupedMinMaxImpl : public GroupedAggregator {
+  using CType = typename Type::c_type;
+  using Op = MinMaxOp<CType>;
+
+  GroupedMinMaxImpl(std::shared_ptr<DataType> out_type, MinMaxOptions options,
+                    MemoryPool* pool)
+      : out_type_(std::move(out_type)),
+        options_(std::move(options)),
+        mins_(pool),
+        maxes_(pool),
+        has_values_(pool),
+        has_nulls_(pool) {}
+
+  Status Resize(KernelContext* ctx, int64_t new_num_groups) override {
+    num_groups_ = new_num_groups;
+    RETURN_NOT_OK(GrowTo(&mins_, AntiExtrema<CType>::anti_min()));
+    RETURN_NOT_OK(GrowTo(&maxes_, AntiExtrema<CType>::anti_max()));
+    RETURN_NOT_OK(GrowTo(&has_values_, false));
+    return GrowTo(&has_nulls_, false);
+  }
+
+  Status Consume(KernelContext* ctx, const ExecBatch& batch) override {
+    CType* mins = mins_.mutable_data();
+    CType* maxes = maxes_.mutable_data();
+    uint8_t* has_values = has_values_.mutable_data();
+    uint8_t* has_nulls = has_nulls_.mutable_data();
+    VisitGroupedValues<Type>(
+        batch,
+        [&](uint32_t g, CType value) {
+          mins[g] = Op::min(mins[g], value);
+          maxes[g] = Op::max(maxes[g], value);
+          BitUtil::SetBit(has_values, g);
+        },
+        [&](uint32_t g) { BitUtil::SetBit(has_nulls, g); });
+    return Status::OK();
+  }
+
+  Status Merge(KernelContext* ctx, GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedMinMaxImpl*>(&raw_other);
+    const uint32_t* g = group_id_mapping.GetValues<uint32_t>(1);
+    CType* mins = mins_.mutable_data();
+    CType* maxes = maxes_.mutable_data();
+    uint8_t* has_values = has_values_.mutable_data();
+    uint8_t* has_nulls = has_nulls_.mutable_data();
+    const CType* other_mins = other->mins_.mutable_data();
+    const CType* other_maxes = other->maxes_.mutable_data();
+    const uint8_t* other_has_values = other->has_values_.mutable_data();
+    const uint8_t* other_has_nulls = other->has_nulls_.mutable_data();
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      mins[g[other_g]] = Op::min(mins[g[other_g]], other_mins[other_g]);
+      maxes[g[other_g]] = Op::max(maxes[g[other_g]], other_maxes[other_g]);
+      if (BitUtil::GetBit(other_has_values, other_g)) {
+        BitUtil::SetBit(has_values, g[other_g]);
+      }
+      if (BitUtil::GetBit(other_has_nulls, other_g)) {
+        BitUtil::SetBit(has_nulls, g[other_g]);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(KernelContext* ctx, Datum* out) override {
+    // A group is null if it has no values, or if it has nulls and nulls are emitted
+    std::shared_ptr<Buffer> null_bitmap;
+    RETURN_NOT_OK(has_values_.Finish(&null_bitmap));
+    if (options_.null_handling == MinMaxOptions::EMIT_NULL) {
+      std::shared_ptr<Buffer> has_nulls;
+      RETURN_NOT_OK(has_nulls_.Finish(&has_nulls));
+      ::arrow::internal::BitmapAndNot(null_bitmap->data(), 0, has_nulls->data(), 0,
+                                      num_groups_, 0, null_bitmap->mutable_data());
+    }
+    const int64_t null_count =
+        num_groups_ -
+        ::arrow::internal::CountSetBits(null_bitmap->data(), 0, num_groups_);
+    if (null_count == 0) {
+      null_bitmap = nullptr;
+    }
+
+    std::shared_ptr<Buffer> mins, maxes;
+    RETURN_NOT_OK(mins_.Finish(&mins));
+    RETURN_NOT_OK(maxes_.Finish(&maxes));
+    const auto& type = out_type_->field(0)->type();
+    auto min_data =
+        ArrayData::Make(type, num_groups_, {null_bitmap, std::move(mins)}, null_count);
+    auto max_data =
+        ArrayData::Make(type, num_groups_, {null_bitmap, std::move(maxes)}, null_count);
+    *out = ArrayData::Make(out_type_, num_groups_, {nullptr},
+                           {std::move(min_data), std::move(max_data)},
+                           /*null_count=*/0);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type_;
+  MinMaxOptions options_;
+  TypedBufferBuilder<CType> mins_, maxes_;
+  TypedBufferBuilder<bool> has_values_, has_nulls_;
+};
+
+// ----------------------------------------------------------------------
+// Variance / Stddev implementation
+
+enum class VarOrStd : bool { Var, Std };
+
+template <typename Type>
+struct GroupedVarStdImpl : public GroupedAggregator {
+  GroupedVarStdImpl(VarianceOptions options, VarOrStd return_type, MemoryPool* pool)
+      : options_(std::move(options)),
+        return_type_(return_type),
+        counts_(pool),
+        means_(pool),
+        m2s_(pool) {}
+
+  Status Resize(KernelContext* ctx, int64_t new_num_groups) override {
+    num_groups_ = new_num_groups;
+    RETURN_NOT_OK(GrowTo(&counts_, int64_t(0)));
+    RETURN_NOT_OK(GrowTo(&means_, 0.0));
+    return GrowTo(&m2s_, 0.0);
+  }
+
+  // Welford's online algorithm, updated once per value, see
+  // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance
+  Status Consume(KernelContext* ctx, const ExecBatch& batch) override {
+    int64_t* counts = counts_.mutable_data();
+    double* means = means_.mutable_data();
+    double* m2s = m2s_.mutable_data();
+    VisitGroupedValues<Type>(
+        batch,
+        [&](uint32_t g, typename Type::c_type value) {
+          const double v = static_cast<double>(value);
+          const double delta = v - means[g];
+          ++counts[g];
+          means[g] += delta / static_cast<double>(counts[g]);
+          m2s[g] += delta * (v - means[g]);
+        },
+        [](uint32_t) {});
+    return Status::OK();
+  }
+
+  // Combine `m2` from two groups (m2 = n*s2)
+  // https://www.emathzone.com/tutorials/basic-statistics/combined-variance.html
+  Status Merge(KernelContext* ctx, GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedVarStdImpl*>(&raw_other);
+    const uint32_t* g = group_id_mapping.GetValues<uint32_t>(1);
+    int64_t* counts = counts_.mutable_data();
+    double* means = means_.mutable_data();
+    double* m2s = m2s_.mutable_data();
+    const int64_t* other_counts = other->counts_.mutable_data();
+    const double* other_means = other->means_.mutable_data();
+    const double* other_m2s = other->m2s_.mutable_data();
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      const uint32_t this_g = g[other_g];
+      if (other_counts[other_g] == 0) {
+        continue;
+      }
+      if (counts[this_g] == 0) {
+        counts[this_g] = other_counts[other_g];
+        means[this_g] = other_means[other_g];
+        m2s[this_g] = other_m2s[other_g];
+        continue;
+      }
+      const double count = static_cast<double>(counts[this_g]);
+      const double other_count = static_cast<double>(other_counts[other_g]);
+      const double mean = (means[this_g] * count + other_means[other_g] * other_count) /
+                          (count + other_count);
+      m2s[this_g] += other_m2s[other_g] +
+                     count * (means[this_g] - mean) * (means[this_g] - mean) +
+                     other_count * (other_means[other_g] - mean) *
+                         (other_means[other_g] - mean);
+      counts[this_g] += other_counts[other_g];
+      means[this_g] = mean;
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(KernelContext* ctx, Datum* out) override {
+    const int64_t* counts = counts_.mutable_data();
+    const double* m2s = m2s_.mutable_data();
+
+    std::shared_ptr<Buffer> null_bitmap;
+    int64_t null_count;
+    RETURN_NOT_OK(CountsToValidity(ctx, counts, num_groups_, options_.ddof,
+                                   &null_bitmap, &null_count));
+
+    ARROW_ASSIGN_OR_RAISE(auto values, ctx->Allocate(num_groups_ * sizeof(double)));
+    auto raw_values = reinterpret_cast<double*>(values->mutable_data());
+    for (int64_t i = 0; i < num_groups_; ++i) {
+      if (counts[i] <= options_.ddof) {
+        raw_values[i] = 0;
+        continue;
+      }
+      const double var = m2s[i] / static_cast<double>(counts[i] - options_.ddof);
+      raw_values[i] = return_type_ == VarOrStd::Var ? var : std::sqrt(var);
+    }
+
+    *out = ArrayData::Make(float64(), num_groups_,
+                           {std::move(null_bitmap), std::move(values)}, null_count);
+    return Status::OK();
+  }
+
+  VarianceOptions options_;
+  VarOrStd return_type_;
+  TypedBufferBuilder<int64_t> counts_;
+  TypedBufferBuilder<double> means_, m2s_;
+};
+
+// ----------------------------------------------------------------------
+// Kernel initialization
+
+std::unique_ptr<KernelState> CountInit(KernelContext* ctx, const KernelInitArgs& args) {
+  return ::arrow::internal::make_unique<GroupedCountImpl>(
+      static_cast<const CountOptions&>(*args.options), ctx->memory_pool());
+}
+
+template <template <typename> class Impl>
+struct GroupedSumLikeInit {
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("No grouped sum implemented for ", type);
+  }
+
+  Status Visit(const HalfFloatType& type) {
+    return Status::NotImplemented("No grouped sum implemented for ", type);
+  }
+
+  Status Visit(const BooleanType&) {
+    state.reset(new Impl<BooleanType>(ctx->memory_pool()));
+    return Status::OK();
+  }
+
+  template <typename Type>
+  enable_if_number<Type, Status> Visit(const Type&) {
+    state.reset(new Impl<Type>(ctx->memory_pool()));
+    return Status::OK();
+  }
+
+  std::unique_ptr<KernelState> Create(const DataType& type) {
+    ctx->SetStatus(VisitTypeInline(type, this));
+    return std::move(state);
+  }
+
+  KernelContext* ctx;
+  std::unique_ptr<KernelState> state;
+};
+
+std::unique_ptr<KernelState> SumInit(KernelContext* ctx, const KernelInitArgs& args) {
+  return GroupedSumLikeInit<GroupedSumImpl>{ctx}.Create(*args.inputs[0].type);
+}
+
+std::unique_ptr<KernelState> MeanInit(KernelContext* ctx, const KernelInitArgs& args) {
+  return GroupedSumLikeInit<GroupedMeanImpl>{ctx}.Create(*args.inputs[0].type);
+}
+
+struct GroupedMinMaxInit {
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("No grouped min/max implemented for ", type);
+  }
+
+  Status Visit(const HalfFloatType& type) {
+    return Status::NotImplemented("No grouped min/max implemented for ", type);
+  }
+
+  template <typename Type>
+  enable_if_number<Type, Status> Visit(const Type&) {
+    state.reset(new GroupedMinMaxImpl<Type>(out_type, options, ctx->memory_pool()));
+    return Status::OK();
+  }
+
+  KernelContext* ctx;
+  std::shared_ptr<DataType> out_type;
+  const MinMaxOptions& options;
+  std::unique_ptr<KernelState> state;
+};
+
+std::unique_ptr<KernelState> MinMaxInit(KernelContext* ctx, const KernelInitArgs& args) {
+  GroupedMinMaxInit visitor{ctx, struct_({field("min", args.inputs[0].type),
+                                          field("max", args.inputs[0].type)}),
+                            static_cast<const MinMaxOptions&>(*args.options)};
+  ctx->SetStatus(VisitTypeInline(*args.inputs[0].type, &visitor));
+  return std::move(visitor.state);
+}
+
+struct GroupedVarStdInit {
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("No grouped variance implemented for ", type);
+  }
+
+  Status Visit(const HalfFloatType& type) {
+    return Status::NotImplemented("No grouped variance implemented for ", type);
+  }
+
+  template <typename Type>
+  enable_if_number<Type, Status> Visit(const Type&) {
+    state.reset(new GroupedVarStdImpl<Type>(options, return_type, ctx->memory_pool()));
+    return Status::OK();
+  }
+
+  KernelContext* ctx;
+  const VarianceOptions& options;
+  VarOrStd return_type;
+  std::unique_ptr<KernelState> state;
+};
+
+template <VarOrStd return_type>
+std::unique_ptr<KernelState> VarStdInit(KernelContext* ctx, const KernelInitArgs& args) {
+  GroupedVarStdInit visitor{ctx, static_cast<const VarianceOptions&>(*args.options),
+                            return_type};
+  ctx->SetStatus(VisitTypeInline(*args.inputs[0].type, &visitor));
+  return std::move(visitor.state);
+}
+
+// ----------------------------------------------------------------------
+// Kernel adapters
+
+void HashAggregateResize(KernelContext* ctx, int64_t num_groups) {
+  KERNEL_RETURN_IF_ERROR(
+      ctx, checked_cast<GroupedAggregator*>(ctx->state())->Resize(ctx, num_groups));
+}
+
+void HashAggregateConsume(KernelContext* ctx, const ExecBatch& batch) {
+  KERNEL_RETURN_IF_ERROR(
+      ctx, checked_cast<GroupedAggregator*>(ctx->state())->Consume(ctx, batch));
+}
+
+void HashAggregateMerge(KernelContext* ctx, KernelState&& other,
+                        const ArrayData& group_id_mapping) {
+  KERNEL_RETURN_IF_ERROR(
+      ctx, checked_cast<GroupedAggregator*>(ctx->state())
+               ->Merge(ctx, checked_cast<GroupedAggregator&&>(other), group_id_mapping));
+}
+
+void HashAggregateFinalize(KernelContext* ctx, Datum* out) {
+  KERNEL_RETURN_IF_ERROR(
+      ctx, checked_cast<GroupedAggregator*>(ctx->state())->Finalize(ctx, out));
+}
+
+void AddHashAggKernel(InputType argument_type, OutputType out_type, KernelInit init,
+                      HashAggregateFunction* func) {
+  // (array[T], array[uint32]) -> array[OutT]
+  auto sig = KernelSignature::Make(
+      {std::move(argument_type), InputType::Array(Type::UINT32)}, std::move(out_type));
+  HashAggregateKernel kernel(std::move(sig), init, HashAggregateResize,
+                             HashAggregateConsume, HashAggregateMerge,
+                             HashAggregateFinalize);
+  DCHECK_OK(func->AddKernel(std::move(kernel)));
+}
+
+void AddHashAggKernels(KernelInit init,
+                       const std::vector<std::shared_ptr<DataType>>& types,
+                       std::shared_ptr<DataType> out_ty, HashAggregateFunction* func) {
+  for (const auto& ty : types) {
+    AddHashAggKernel(InputType::Array(ty), ValueDescr::Array(out_ty), init, func);
+  }
+}
+
+Result<ValueDescr> MinMaxType(KernelContext*, const std::vector<ValueDescr>& descrs) {
+  // array[T] -> array[struct<min: T, max: T>]
+  const auto& ty = descrs[0].type;
+  return ValueDescr::Array(struct_({field("min", ty), field("max", ty)}));
+}
+
+const FunctionDoc hash_count_doc{"Count the number of null / non-null values",
+                                 ("By default, non-null values are counted.\n"
+                                  "This can be changed through CountOptions."),
+                                 {"array", "group_id_array"},
+                                 "CountOptions"};
+
+const FunctionDoc hash_sum_doc{"Sum values of a numeric array",
+                               ("Null values are ignored."),
+                               {"array", "group_id_array"}};
+
+const FunctionDoc hash_mean_doc{"Compute the mean of a numeric array",
+                                ("Null values are ignored. The result is always "
+                                 "computed\nas a double, regardless of the input types"),
+                                {"array", "group_id_array"}};
+
+const FunctionDoc hash_min_max_doc{
+    "Compute the minimum and maximum values of a numeric array",
+    ("Null values are ignored by default.\n"
+     "This can be changed through MinMaxOptions."),
+    {"array", "group_id_array"},
+    "MinMaxOptions"};
+
+const FunctionDoc hash_variance_doc{
+    "Calculate the variance of a numeric array",
+    ("The number of degrees of freedom can be controlled using VarianceOptions.\n"
+     "By default (`ddof` = 0), the population variance is calculated.\n"
+     "Nulls are ignored.  If there are not enough non-null values in a group\n"
+     "to satisfy `ddof`, null is returned for that group."),
+    {"array", "group_id_array"},
+    "VarianceOptions"};
+
+const FunctionDoc hash_stddev_doc{
+    "Calculate the standard deviation of a numeric array",
+    ("The number of degrees of freedom can be controlled using VarianceOptions.\n"
+     "By default (`ddof` = 0), the population standard deviation is calculated.\n"
+     "Nulls are ignored.  If there are not enough non-null values in a group\n"
+     "to satisfy `ddof`, null is returned for that group."),
+    {"array", "group_id_array"},
+    "VarianceOptions"};
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Grouper and GroupBy
+
+Result<std::unique_ptr<Grouper>> Grouper::Make(const std::vector<ValueDescr>& descrs,
+                                               ExecContext* ctx) {
+  MemoryPool* pool = ctx != nullptr ? ctx->memory_pool() : default_memory_pool();
+  if (descrs.size() == 1) {
+    ScalarGrouperFactory factory{descrs[0].type, pool, nullptr};
+    RETURN_NOT_OK(VisitTypeInline(*descrs[0].type, &factory));
+    if (factory.out != nullptr) {
+      return std::move(factory.out);
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(auto impl, GrouperImpl::Make(descrs, pool));
+  return std::unique_ptr<Grouper>(std::move(impl));
+}
+
+Result<Datum> GroupBy(const std::vector<Datum>& arguments, const std::vector<Datum>& keys,
+                      const std::vector<Aggregate>& aggregates, ExecContext* ctx) {
+  if (ctx == nullptr) {
+    ExecContext default_ctx;
+    return GroupBy(arguments, keys, aggregates, &default_ctx);
+  }
+  if (arguments.size() != aggregates.size()) {
+    return Status::Invalid("Got ", arguments.size(), " arguments but ",
+                           aggregates.size(), " aggregates");
+  }
+  if (keys.empty()) {
+    return Status::Invalid("GroupBy requires at least one key");
+  }
+
+  std::vector<Datum> args_and_keys(arguments);
+  args_and_keys.insert(args_and_keys.end(), keys.begin(), keys.end());
+  RETURN_NOT_OK(compute::detail::CheckAllValues(args_and_keys));
+
+  // Dispatch and initialize a HashAggregateKernel for each argument
+  const size_t num_aggregates = aggregates.size();
+  std::vector<const HashAggregateKernel*> kernels(num_aggregates);
+  std::vector<std::unique_ptr<KernelState>> states(num_aggregates);
+  std::vector<KernelContext> kernel_ctxs(num_aggregates, KernelContext{ctx});
+  FieldVector out_fields;
+
+  for (size_t i = 0; i < num_aggregates; ++i) {
+    ARROW_ASSIGN_OR_RAISE(auto function,
+                          ctx->func_registry()->GetFunction(aggregates[i].function));
+    if (function->kind() != Function::HASH_AGGREGATE) {
+      return Status::Invalid("The provided function (", aggregates[i].function,
+                             ") is not a hash aggregate function");
+    }
+
+    const std::vector<ValueDescr> in_descrs = {arguments[i].descr(),
+                                               ValueDescr::Array(uint32())};
+    ARROW_ASSIGN_OR_RAISE(const Kernel* kernel, function->DispatchExact(in_descrs));
+    kernels[i] = static_cast<const HashAggregateKernel*>(kernel);
+
+    const FunctionOptions* options = aggregates[i].options;
+    if (options == nullptr) {
+      options = function->default_options();
+    }
+
+    KernelContext* kernel_ctx = &kernel_ctxs[i];
+    states[i] = kernels[i]->init(kernel_ctx, KernelInitArgs{kernel, in_descrs, options});
+    ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+    kernel_ctx->SetState(states[i].get());
+
+    kernels[i]->resize(kernel_ctx, 0);
+    ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+
+    ARROW_ASSIGN_OR_RAISE(auto out_descr,
+                          kernel->signature->out_type().Resolve(kernel_ctx, in_descrs));
+    out_fields.push_back(field(aggregates[i].function, std::move(out_descr.type)));
+  }
+
+  std::vector<ValueDescr> key_descrs(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    key_descrs[i] = keys[i].descr();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto grouper, Grouper::Make(key_descrs, ctx));
+
+  // Assign group ids to each batch of keys, then update the aggregates
+  ARROW_ASSIGN_OR_RAISE(
+      auto batch_iterator,
+      compute::detail::ExecBatchIterator::Make(args_and_keys, ctx->exec_chunksize()));
+
+  ExecBatch batch;
+  while (batch_iterator->Next(&batch)) {
+    if (batch.length == 0) continue;
+
+    ExecBatch key_batch(
+        std::vector<Datum>(batch.values.begin() + num_aggregates, batch.values.end()),
+        batch.length);
+    ARROW_ASSIGN_OR_RAISE(Datum id_batch, grouper->Consume(key_batch));
+
+    for (size_t i = 0; i < num_aggregates; ++i) {
+      KernelContext* kernel_ctx = &kernel_ctxs[i];
+      kernels[i]->resize(kernel_ctx, grouper->num_groups());
+      ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+
+      ARROW_ASSIGN_OR_RAISE(
+          auto argument, BroadcastKey(batch[i], batch.length, ctx->memory_pool()));
+      kernels[i]->consume(kernel_ctx, ExecBatch({Datum(std::move(argument)), id_batch},
+                                                batch.length));
+      ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+    }
+  }
+
+  // Finalize each aggregate and append the unique keys
+  ArrayDataVector out_data(num_aggregates + keys.size());
+  for (size_t i = 0; i < num_aggregates; ++i) {
+    KernelContext* kernel_ctx = &kernel_ctxs[i];
+    Datum out;
+    kernels[i]->finalize(kernel_ctx, &out);
+    ARROW_CTX_RETURN_IF_ERROR(kernel_ctx);
+    out_data[i] = out.array();
+  }
+
+  ARROW_ASSIGN_OR_RAISE(ExecBatch out_keys, grouper->GetUniques());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    out_data[num_aggregates + i] = out_keys[i].array();
+    out_fields.push_back(field("key_" + std::to_string(i), keys[i].type()));
+  }
+
+  const int64_t length = static_cast<int64_t>(grouper->num_groups());
+  return ArrayData::Make(struct_(std::move(out_fields)), length,
+                         {/*null_bitmap=*/nullptr}, std::move(out_data),
+                         /*null_count=*/0);
+}
+
+void RegisterHashAggregateBasic(FunctionRegistry* registry) {
+  {
+    static auto default_count_options = CountOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_count", Arity::Binary(), &hash_count_doc, &default_count_options);
+    AddHashAggKernel(InputType(ValueDescr::ARRAY), ValueDescr::Array(int64()),
+                     CountInit, func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>("hash_sum", Arity::Binary(),
+                                                        &hash_sum_doc);
+    AddHashAggKernels(SumInit, {boolean()}, uint64(), func.get());
+    AddHashAggKernels(SumInit, SignedIntTypes(), int64(), func.get());
+    AddHashAggKernels(SumInit, UnsignedIntTypes(), uint64(), func.get());
+    AddHashAggKernels(SumInit, FloatingPointTypes(), float64(), func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>("hash_mean", Arity::Binary(),
+                                                        &hash_mean_doc);
+    AddHashAggKernels(MeanInit, {boolean()}, float64(), func.get());
+    AddHashAggKernels(MeanInit, NumericTypes(), float64(), func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    static auto default_minmax_options = MinMaxOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_min_max", Arity::Binary(), &hash_min_max_doc, &default_minmax_options);
+    for (const auto& ty : NumericTypes()) {
+      AddHashAggKernel(InputType::Array(ty), OutputType(MinMaxType), MinMaxInit,
+                       func.get());
+    }
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  static auto default_variance_options = VarianceOptions::Defaults();
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_variance", Arity::Binary(), &hash_variance_doc, &default_variance_options);
+    AddHashAggKernels(VarStdInit<VarOrStd::Var>, NumericTypes(), float64(), func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_stddev", Arity::Binary(), &hash_stddev_doc, &default_variance_options);
+    AddHashAggKernels(VarStdInit<VarOrStd::Std>, NumericTypes(), float64(), func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
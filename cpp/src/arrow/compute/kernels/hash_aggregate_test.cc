@@ -0,0 +1,321 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/compute/registry.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+using internal::Aggregate;
+using internal::GroupBy;
+using internal::Grouper;
+
+void ValidateGroupBy(const std::vector<Datum>& arguments, const std::vector<Datum>& keys,
+                     const std::vector<Aggregate>& aggregates, const Array& expected) {
+  ASSERT_OK_AND_ASSIGN(Datum actual, GroupBy(arguments, keys, aggregates));
+  ASSERT_OK(actual.make_array()->ValidateFull());
+  AssertArraysApproxEqual(expected, *actual.make_array(), /*verbose=*/true);
+}
+
+TEST(Grouper, Basics) {
+  ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({ValueDescr::Array(utf8()),
+                                                    ValueDescr::Array(int32())}));
+
+  ExecBatch batch({ArrayFromJSON(utf8(), R"(["a", "b", "a", null, "b", null])"),
+                   ArrayFromJSON(int32(), "[1, 1, 1, 2, 2, 2]")},
+                  6);
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(batch));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[0, 1, 0, 2, 3, 2]"), *ids.make_array());
+  ASSERT_EQ(grouper->num_groups(), 4);
+
+  // Group ids are stable across batches
+  batch = ExecBatch({ArrayFromJSON(utf8(), R"(["c", "b", null])"),
+                     ArrayFromJSON(int32(), "[1, 2, null]")},
+                    3);
+  ASSERT_OK_AND_ASSIGN(ids, grouper->Consume(batch));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[4, 3, 5]"), *ids.make_array());
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+  ASSERT_EQ(uniques.length, 6);
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "b", null, "b", "c", null])"),
+                    *uniques[0].make_array());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 1, 2, 2, 1, null]"),
+                    *uniques[1].make_array());
+}
+
+TEST(Grouper, NullVarLengthKeysWithData) {
+  // Null slots may span non-empty ranges of the values buffer; they must still
+  // all map to the same group
+  std::vector<int32_t> raw_offsets = {0, 1, 2, 3, 5, 5, 8};
+  std::vector<uint8_t> raw_validity = {0x05};
+  auto offsets = Buffer::Wrap(raw_offsets);
+  auto values = Buffer::FromString("axaybzzz");
+  auto validity = Buffer::Wrap(raw_validity);
+  std::shared_ptr<Array> keys =
+      std::make_shared<StringArray>(6, offsets, values, validity);
+  ASSERT_OK(keys->ValidateFull());
+
+  ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({ValueDescr::Array(utf8())}));
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(ExecBatch({keys}, 6)));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[0, 1, 0, 1, 1, 1]"), *ids.make_array());
+
+  // Sliced input with the same contents
+  ASSERT_OK_AND_ASSIGN(ids, grouper->Consume(ExecBatch({keys->Slice(1, 3)}, 3)));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[1, 0, 1]"), *ids.make_array());
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", null])"), *uniques[0].make_array());
+}
+
+TEST(Grouper, SingleNumericKey) {
+  for (const auto& ty :
+       {int8(), uint16(), int64(), float64(), timestamp(TimeUnit::MILLI)}) {
+    SCOPED_TRACE(ty->ToString());
+    ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make({ValueDescr::Array(ty)}));
+
+    ExecBatch batch({ArrayFromJSON(ty, "[3, null, 3, 1, null, 1, 2]")}, 7);
+    ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(batch));
+    AssertArraysEqual(*ArrayFromJSON(uint32(), "[0, 1, 0, 2, 1, 2, 3]"),
+                      *ids.make_array());
+
+    ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+    AssertArraysEqual(*ArrayFromJSON(ty, "[3, null, 1, 2]"), *uniques[0].make_array());
+  }
+}
+
+TEST(Grouper, Lookup) {
+  for (const auto& descrs : std::vector<std::vector<ValueDescr>>{
+           {ValueDescr::Array(int32())},
+           {ValueDescr::Array(int32()), ValueDescr::Array(utf8())}}) {
+    ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make(descrs));
+    auto make_batch = [&](const std::string& json) {
+      ExecBatch batch({ArrayFromJSON(int32(), json)}, 4);
+      if (descrs.size() > 1) {
+        batch.values.push_back(ArrayFromJSON(utf8(), R"(["a", "a", "a", "a"])"));
+      }
+      return batch;
+    };
+
+    ASSERT_OK(grouper->Consume(make_batch("[5, 7, null, 5]")));
+    ASSERT_EQ(grouper->num_groups(), 3);
+
+    ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Lookup(make_batch("[7, 6, 5, null]")));
+    AssertArraysEqual(*ArrayFromJSON(uint32(), "[1, null, 0, 2]"), *ids.make_array());
+    // Lookup doesn't insert new groups
+    ASSERT_EQ(grouper->num_groups(), 3);
+  }
+}
+
+TEST(Grouper, BooleanAndFixedSizeBinaryKeys) {
+  ASSERT_OK_AND_ASSIGN(auto grouper,
+                       Grouper::Make({ValueDescr::Array(boolean()),
+                                      ValueDescr::Array(fixed_size_binary(2))}));
+
+  ExecBatch batch(
+      {ArrayFromJSON(boolean(), "[true, false, true, null, true]"),
+       ArrayFromJSON(fixed_size_binary(2), R"(["aa", "aa", "aa", "bb", "bb"])")},
+      5);
+  ASSERT_OK_AND_ASSIGN(Datum ids, grouper->Consume(batch));
+  AssertArraysEqual(*ArrayFromJSON(uint32(), "[0, 1, 0, 2, 3]"), *ids.make_array());
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch uniques, grouper->GetUniques());
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, false, null, true]"),
+                    *uniques[0].make_array());
+  AssertArraysEqual(
+      *ArrayFromJSON(fixed_size_binary(2), R"(["aa", "aa", "bb", "bb"])"),
+      *uniques[1].make_array());
+}
+
+TEST(Grouper, UnsupportedKey) {
+  ASSERT_RAISES(NotImplemented, Grouper::Make({ValueDescr::Array(list(int32())),
+                                              ValueDescr::Array(int32())}));
+}
+
+TEST(GroupBy, SumOnly) {
+  auto argument =
+      ArrayFromJSON(float64(), "[1.0, 0.0, null, 4.0, 3.25, 0.125, -0.25, 0.75]");
+  auto key = ArrayFromJSON(int64(), "[1, 2, 3, null, 1, 2, 2, null]");
+
+  ValidateGroupBy({argument}, {key}, {{"hash_sum", nullptr}},
+                  *ArrayFromJSON(struct_({field("hash_sum", float64()),
+                                          field("key_0", int64())}),
+                                 R"([
+    [4.25,   1],
+    [-0.125, 2],
+    [null,   3],
+    [4.75,   null]
+  ])"));
+}
+
+TEST(GroupBy, SumMeanCountMinMax) {
+  auto argument = ArrayFromJSON(int32(), "[1, 0, null, 4, 3, 0, -1, 7, null]");
+  auto key = ArrayFromJSON(utf8(), R"(["x", "y", "z", null, "x", "y", "y", null, "x"])");
+
+  CountOptions count_nulls(CountOptions::COUNT_NULL);
+  MinMaxOptions emit_null(MinMaxOptions::EMIT_NULL);
+
+  ValidateGroupBy({argument, argument, argument, argument, argument, argument},
+                  {key},
+                  {
+                      {"hash_sum", nullptr},
+                      {"hash_mean", nullptr},
+                      {"hash_count", nullptr},
+                      {"hash_count", &count_nulls},
+                      {"hash_min_max", nullptr},
+                      {"hash_min_max", &emit_null},
+                  },
+                  *ArrayFromJSON(struct_({
+                                     field("hash_sum", int64()),
+                                     field("hash_mean", float64()),
+                                     field("hash_count", int64()),
+                                     field("hash_count", int64()),
+                                     field("hash_min_max", struct_({
+                                                               field("min", int32()),
+                                                               field("max", int32()),
+                                                           })),
+                                     field("hash_min_max", struct_({
+                                                               field("min", int32()),
+                                                               field("max", int32()),
+                                                           })),
+                                     field("key_0", utf8()),
+                                 }),
+                                 R"([
+    [4,    2.0,                 2, 1, {"min": 1,    "max": 3},
+                                      {"min": null, "max": null}, "x"],
+    [-1,   -0.3333333333333333, 3, 0, {"min": -1,   "max": 0},
+                                      {"min": -1,   "max": 0},    "y"],
+    [null, null,                0, 1, {"min": null, "max": null},
+                                      {"min": null, "max": null}, "z"],
+    [11,   5.5,                 2, 0, {"min": 4,    "max": 7},
+                                      {"min": 4,    "max": 7},    null]
+  ])"));
+}
+
+TEST(GroupBy, VarianceAndStddev) {
+  auto argument = ArrayFromJSON(float64(), "[1, 2, 3, 4, 5, 6, null, 8]");
+  auto key = ArrayFromJSON(int32(), "[1, 1, 2, 2, 2, 3, 3, 4]");
+
+  VarianceOptions ddof1(/*ddof=*/1);
+  ValidateGroupBy({argument, argument, argument}, {key},
+                  {
+                      {"hash_variance", nullptr},
+                      {"hash_stddev", nullptr},
+                      {"hash_variance", &ddof1},
+                  },
+                  *ArrayFromJSON(struct_({
+                                     field("hash_variance", float64()),
+                                     field("hash_stddev", float64()),
+                                     field("hash_variance", float64()),
+                                     field("key_0", int32()),
+                                 }),
+                                 R"([
+    [0.25,               0.5,                0.5,  1],
+    [0.6666666666666666, 0.816496580927726,  1.0,  2],
+    [0.0,                0.0,                null, 3],
+    [0.0,                0.0,                null, 4]
+  ])"));
+}
+
+TEST(GroupBy, MultipleKeys) {
+  auto argument = ArrayFromJSON(int64(), "[1, 2, 3, 4, 5, 6]");
+  auto key0 = ArrayFromJSON(boolean(), "[true, true, false, true, null, false]");
+  auto key1 = ArrayFromJSON(utf8(), R"(["a", "b", "a", "a", "a", "a"])");
+
+  ValidateGroupBy({argument}, {key0, key1}, {{"hash_sum", nullptr}},
+                  *ArrayFromJSON(struct_({field("hash_sum", int64()),
+                                          field("key_0", boolean()),
+                                          field("key_1", utf8())}),
+                                 R"([
+    [5, true,  "a"],
+    [2, true,  "b"],
+    [9, false, "a"],
+    [5, null,  "a"]
+  ])"));
+}
+
+TEST(GroupBy, ChunkedInput) {
+  auto argument = ChunkedArrayFromJSON(uint8(), {"[1, 2, 3]", "[4, 5]", "[]", "[6]"});
+  auto key = ChunkedArrayFromJSON(int64(), {"[1, 2, 1]", "[3, 2]", "[]", "[1]"});
+
+  ExecContext ctx;
+  ctx.set_exec_chunksize(2);
+  ASSERT_OK_AND_ASSIGN(Datum actual,
+                       GroupBy({argument}, {key}, {{"hash_sum", nullptr}}, &ctx));
+  AssertArraysEqual(*ArrayFromJSON(struct_({field("hash_sum", uint64()),
+                                            field("key_0", int64())}),
+                                   "[[10, 1], [7, 2], [4, 3]]"),
+                    *actual.make_array(), /*verbose=*/true);
+}
+
+TEST(GroupBy, RandomSumMatchesScalarAggregate) {
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  const int64_t length = 10000;
+  auto argument = rand.Float64(length, -100, 100, /*null_probability=*/0.1);
+  auto key = rand.Int64(length, 0, 50, /*null_probability=*/0.01);
+
+  ASSERT_OK_AND_ASSIGN(Datum actual, GroupBy({argument}, {key}, {{"hash_sum", nullptr}}));
+  auto result_array = actual.make_array();
+  ASSERT_OK(result_array->ValidateFull());
+  const auto& result = checked_cast<const StructArray&>(*result_array);
+
+  double total = 0;
+  const auto& sums = checked_cast<const DoubleArray&>(*result.field(0));
+  for (int64_t i = 0; i < sums.length(); ++i) {
+    if (sums.IsValid(i)) total += sums.Value(i);
+  }
+  ASSERT_OK_AND_ASSIGN(Datum expected, Sum(argument));
+  ASSERT_NEAR(checked_cast<const DoubleScalar&>(*expected.scalar()).value, total, 1e-6);
+}
+
+TEST(GroupBy, Errors) {
+  auto argument = ArrayFromJSON(int32(), "[1, 2]");
+  auto key = ArrayFromJSON(int32(), "[1, 2]");
+
+  // Not a hash aggregate function
+  ASSERT_RAISES(Invalid, GroupBy({argument}, {key}, {{"sum", nullptr}}));
+  // Mismatched arguments and aggregates
+  ASSERT_RAISES(Invalid, GroupBy({argument, argument}, {key}, {{"hash_sum", nullptr}}));
+  // No keys
+  ASSERT_RAISES(Invalid, GroupBy({argument}, {}, {{"hash_sum", nullptr}}));
+  // Unsupported argument type
+  ASSERT_RAISES(NotImplemented, GroupBy({ArrayFromJSON(utf8(), R"(["a", "b"])")}, {key},
+                                        {{"hash_sum", nullptr}}));
+
+  // HASH_AGGREGATE functions cannot be called directly
+  ASSERT_RAISES(NotImplemented,
+                CallFunction("hash_sum", {argument, ArrayFromJSON(uint32(), "[0, 1]")}));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,390 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec_internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/util/bitmap_reader.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/make_unique.h"
+
+namespace arrow {
+
+using internal::BitmapReader;
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+constexpr uint32_t kNullKey = std::numeric_limits<uint32_t>::max();
+
+// Overwrite the group id of each row having a null in any key column with
+// kNullKey, since null keys never match in a join
+void MaskNullKeys(const ExecBatch& keys, uint32_t* group_ids) {
+  for (const Datum& key : keys.values) {
+    if (key.is_scalar()) {
+      if (!key.scalar()->is_valid) {
+        std::fill(group_ids, group_ids + keys.length, kNullKey);
+      }
+      continue;
+    }
+    const ArrayData& data = *key.array();
+    if (data.GetNullCount() == 0) continue;
+    BitmapReader reader(data.buffers[0]->data(), data.offset, data.length);
+    for (int64_t i = 0; i < data.length; ++i) {
+      if (reader.IsNotSet()) group_ids[i] = kNullKey;
+      reader.Next();
+    }
+  }
+}
+
+class HashJoinImpl : public HashJoin {
+ public:
+  HashJoinImpl(JoinType join_type, const ExecContext& ctx)
+      : join_type_(join_type), ctx_(ctx), pool_(ctx.memory_pool()) {}
+
+  Status Build(const std::vector<Datum>& build_keys) {
+    if (build_keys.empty()) {
+      return Status::Invalid("HashJoin requires at least one key");
+    }
+    RETURN_NOT_OK(compute::detail::CheckAllValues(build_keys));
+
+    key_descrs_.resize(build_keys.size());
+    for (size_t i = 0; i < build_keys.size(); ++i) {
+      if (!build_keys[i].is_arraylike()) {
+        return Status::Invalid("Build keys must be arrays or chunked arrays");
+      }
+      key_descrs_[i] = ValueDescr::Array(build_keys[i].type());
+    }
+    ARROW_ASSIGN_OR_RAISE(grouper_, internal::Grouper::Make(key_descrs_, &ctx_));
+
+    // Assign a group id to each build row
+    ARROW_ASSIGN_OR_RAISE(auto batch_iterator, compute::detail::ExecBatchIterator::Make(
+                                                   build_keys, ctx_.exec_chunksize()));
+    std::vector<uint32_t> build_group_ids;
+    ExecBatch batch;
+    while (batch_iterator->Next(&batch)) {
+      if (batch.length == 0) continue;
+
+      ARROW_ASSIGN_OR_RAISE(Datum ids, grouper_->Consume(batch));
+      const uint32_t* raw_ids = ids.array()->GetValues<uint32_t>(1);
+      const size_t offset = build_group_ids.size();
+      build_group_ids.insert(build_group_ids.end(), raw_ids, raw_ids + batch.length);
+      MaskNullKeys(batch, build_group_ids.data() + offset);
+    }
+    num_build_rows_ = static_cast<int64_t>(build_group_ids.size());
+
+    // Lay out the build rows of each group contiguously, in build order, so
+    // that a probe only needs the group's range in build_rows_
+    const uint32_t num_groups = grouper_->num_groups();
+    group_offsets_.assign(num_groups + 1, 0);
+    for (uint32_t group_id : build_group_ids) {
+      if (group_id != kNullKey) ++group_offsets_[group_id + 1];
+    }
+    for (uint32_t g = 0; g < num_groups; ++g) {
+      group_offsets_[g + 1] += group_offsets_[g];
+    }
+    build_rows_.resize(group_offsets_[num_groups]);
+    std::vector<int64_t> cursors(group_offsets_.begin(), group_offsets_.end() - 1);
+    for (int64_t row = 0; row < num_build_rows_; ++row) {
+      const uint32_t group_id = build_group_ids[row];
+      if (group_id != kNullKey) build_rows_[cursors[group_id]++] = row;
+    }
+    return Status::OK();
+  }
+
+  Status SetBuildTable(const std::shared_ptr<Table>& build) {
+    // The columns are shared with the caller's Table, not copied
+    build_schema_ = build->schema();
+    build_columns_ = build->columns();
+    return Status::OK();
+  }
+
+  Result<HashJoinIndices> ProbeIndices(const ExecBatch& probe_keys) override {
+    if (probe_keys.num_values() != static_cast<int>(key_descrs_.size())) {
+      return Status::Invalid("Expected ", key_descrs_.size(),
+                             " probe keys, got ", probe_keys.num_values());
+    }
+    for (int i = 0; i < probe_keys.num_values(); ++i) {
+      if (!probe_keys[i].type()->Equals(*key_descrs_[i].type)) {
+        return Status::TypeError("Probe key ", i, " has type ", *probe_keys[i].type(),
+                                 " but build key has type ", *key_descrs_[i].type);
+      }
+    }
+
+    ARROW_ASSIGN_OR_RAISE(Datum lookup, grouper_->Lookup(probe_keys));
+    const ArrayData& group_ids = *lookup.array();
+    const uint32_t* raw_group_ids = group_ids.GetValues<uint32_t>(1);
+    const uint8_t* found =
+        group_ids.buffers[0] != nullptr ? group_ids.buffers[0]->data() : nullptr;
+
+    auto match_range = [&](int64_t i, int64_t* begin, int64_t* end) {
+      if (found != nullptr && !BitUtil::GetBit(found, i)) {
+        *begin = *end = 0;
+        return;
+      }
+      *begin = group_offsets_[raw_group_ids[i]];
+      *end = group_offsets_[raw_group_ids[i] + 1];
+    };
+
+    const int64_t length = probe_keys.length;
+    TypedBufferBuilder<int64_t> probe_indices(pool_);
+    TypedBufferBuilder<int64_t> build_indices(pool_);
+    TypedBufferBuilder<bool> build_validity(pool_);
+    int64_t begin, end;
+
+    switch (join_type_) {
+      case JoinType::INNER:
+      case JoinType::LEFT_OUTER: {
+        const bool outer = join_type_ == JoinType::LEFT_OUTER;
+        RETURN_NOT_OK(probe_indices.Reserve(length));
+        RETURN_NOT_OK(build_indices.Reserve(length));
+        for (int64_t i = 0; i < length; ++i) {
+          match_range(i, &begin, &end);
+          if (begin == end) {
+            if (outer) {
+              RETURN_NOT_OK(build_validity.Append(
+                  build_indices.length() - build_validity.length(), true));
+              RETURN_NOT_OK(build_validity.Append(false));
+              RETURN_NOT_OK(probe_indices.Append(i));
+              RETURN_NOT_OK(build_indices.Append(0));
+            }
+            continue;
+          }
+          RETURN_NOT_OK(probe_indices.Append(end - begin, i));
+          RETURN_NOT_OK(build_indices.Append(build_rows_.data() + begin, end - begin));
+        }
+        break;
+      }
+      case JoinType::LEFT_SEMI:
+      case JoinType::LEFT_ANTI: {
+        const bool semi = join_type_ == JoinType::LEFT_SEMI;
+        RETURN_NOT_OK(probe_indices.Reserve(length));
+        for (int64_t i = 0; i < length; ++i) {
+          match_range(i, &begin, &end);
+          if ((begin != end) == semi) probe_indices.UnsafeAppend(i);
+        }
+        break;
+      }
+    }
+
+    HashJoinIndices out;
+    const int64_t out_length = probe_indices.length();
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(probe_indices.Finish(&buffer));
+    out.probe_indices = MakeArray(ArrayData::Make(int64(), out_length,
+                                                  {nullptr, std::move(buffer)},
+                                                  /*null_count=*/0));
+    if (join_type_ == JoinType::INNER || join_type_ == JoinType::LEFT_OUTER) {
+      std::shared_ptr<Buffer> null_bitmap;
+      int64_t null_count = 0;
+      if (build_validity.length() > 0) {
+        RETURN_NOT_OK(build_validity.Append(out_length - build_validity.length(), true));
+        null_count = build_validity.false_count();
+        RETURN_NOT_OK(build_validity.Finish(&null_bitmap));
+      }
+      RETURN_NOT_OK(build_indices.Finish(&buffer));
+      out.build_indices = MakeArray(ArrayData::Make(
+          int64(), out_length, {std::move(null_bitmap), std::move(buffer)}, null_count));
+    }
+    return out;
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Probe(
+      const RecordBatch& probe,
+      const std::vector<std::string>& probe_key_names) override {
+    if (build_schema_ == nullptr) {
+      return Status::Invalid("HashJoin was not made from a Table");
+    }
+    ExecBatch probe_keys({}, probe.num_rows());
+    for (const auto& name : probe_key_names) {
+      auto column = probe.GetColumnByName(name);
+      if (column == nullptr) {
+        return Status::Invalid("No key column named '", name, "'");
+      }
+      probe_keys.values.emplace_back(std::move(column));
+    }
+    ARROW_ASSIGN_OR_RAISE(HashJoinIndices indices, ProbeIndices(probe_keys));
+
+    // The indices were generated in bounds
+    const auto take_options = TakeOptions::NoBoundsCheck();
+    std::vector<std::shared_ptr<Field>> fields = probe.schema()->fields();
+    std::vector<std::shared_ptr<Array>> columns(probe.num_columns());
+    for (int i = 0; i < probe.num_columns(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(columns[i], Take(*probe.column(i), *indices.probe_indices,
+                                             take_options, &ctx_));
+    }
+    if (indices.build_indices != nullptr) {
+      for (int i = 0; i < build_schema_->num_fields(); ++i) {
+        auto field = build_schema_->field(i);
+        if (join_type_ == JoinType::LEFT_OUTER) {
+          field = field->WithNullable(true);
+        }
+        fields.push_back(std::move(field));
+        ARROW_ASSIGN_OR_RAISE(auto column,
+                              TakeBuildRows(*build_columns_[i], *indices.build_indices));
+        columns.push_back(std::move(column));
+      }
+    }
+    return RecordBatch::Make(schema(std::move(fields)),
+                             indices.probe_indices->length(), std::move(columns));
+  }
+
+  JoinType join_type() const override { return join_type_; }
+
+  int64_t num_build_rows() const override { return num_build_rows_; }
+
+ private:
+  // Take the rows at `indices` (global build row numbers, possibly null) from
+  // a chunked build column.  Rather than concatenating the build chunks, the
+  // indices are split by chunk, each chunk is taken from separately and the
+  // output-sized pieces are then put back in probe order.
+  Result<std::shared_ptr<Array>> TakeBuildRows(const ChunkedArray& column,
+                                               const Array& indices) {
+    const auto take_options = TakeOptions::NoBoundsCheck();
+    const auto& chunks = column.chunks();
+    if (chunks.size() == 1) {
+      return Take(*chunks[0], indices, take_options, &ctx_);
+    }
+    if (chunks.empty()) {
+      // No build rows, so every index is null
+      return MakeArrayOfNull(column.type(), indices.length(), pool_);
+    }
+
+    const int num_chunks = static_cast<int>(chunks.size());
+    std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+    for (int c = 0; c < num_chunks; ++c) {
+      chunk_offsets[c + 1] = chunk_offsets[c] + chunks[c]->length();
+    }
+
+    // Resolve each index to its chunk
+    const auto& global_indices = checked_cast<const Int64Array&>(indices);
+    const int64_t length = global_indices.length();
+    std::vector<int> chunk_ids(length, -1);
+    std::vector<int64_t> chunk_lengths(num_chunks, 0);
+    for (int64_t i = 0; i < length; ++i) {
+      if (global_indices.IsNull(i)) continue;
+      const auto it = std::upper_bound(chunk_offsets.begin() + 1, chunk_offsets.end(),
+                                       global_indices.Value(i));
+      chunk_ids[i] = static_cast<int>(it - chunk_offsets.begin() - 1);
+      ++chunk_lengths[chunk_ids[i]];
+    }
+
+    // Local indices into each chunk, and the position of each output row in
+    // the concatenation of the per-chunk pieces
+    std::vector<std::shared_ptr<Buffer>> local_buffers(num_chunks);
+    std::vector<int64_t*> local_indices(num_chunks);
+    std::vector<int64_t> cursors(num_chunks);
+    int64_t piece_offset = 0;
+    for (int c = 0; c < num_chunks; ++c) {
+      ARROW_ASSIGN_OR_RAISE(local_buffers[c],
+                            AllocateBuffer(chunk_lengths[c] * sizeof(int64_t), pool_));
+      local_indices[c] = reinterpret_cast<int64_t*>(local_buffers[c]->mutable_data());
+      cursors[c] = piece_offset;
+      piece_offset += chunk_lengths[c];
+    }
+    const int64_t offset = global_indices.offset();
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> positions_buffer,
+                          AllocateBuffer((offset + length) * sizeof(int64_t), pool_));
+    // Laid out at the same offset as the indices, so as to share their validity
+    auto positions =
+        reinterpret_cast<int64_t*>(positions_buffer->mutable_data()) + offset;
+    for (int64_t i = 0; i < length; ++i) {
+      const int c = chunk_ids[i];
+      if (c < 0) {
+        positions[i] = 0;
+        continue;
+      }
+      *local_indices[c]++ = global_indices.Value(i) - chunk_offsets[c];
+      positions[i] = cursors[c]++;
+    }
+
+    ArrayVector pieces(num_chunks);
+    for (int c = 0; c < num_chunks; ++c) {
+      Int64Array chunk_indices(chunk_lengths[c], std::move(local_buffers[c]));
+      ARROW_ASSIGN_OR_RAISE(pieces[c],
+                            Take(*chunks[c], chunk_indices, take_options, &ctx_));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto taken, Concatenate(pieces, pool_));
+    Int64Array position_indices(length, std::move(positions_buffer),
+                                global_indices.null_bitmap(), global_indices.null_count(),
+                                offset);
+    return Take(*taken, position_indices, take_options, &ctx_);
+  }
+
+  JoinType join_type_;
+  ExecContext ctx_;
+  MemoryPool* pool_;
+
+  std::vector<ValueDescr> key_descrs_;
+  std::unique_ptr<internal::Grouper> grouper_;
+  int64_t num_build_rows_ = 0;
+  // The build rows of group g are
+  // build_rows_[group_offsets_[g]:group_offsets_[g + 1]]
+  std::vector<int64_t> group_offsets_;
+  std::vector<int64_t> build_rows_;
+
+  // Only set when made from a Table
+  std::shared_ptr<Schema> build_schema_;
+  std::vector<std::shared_ptr<ChunkedArray>> build_columns_;
+};
+
+}  // namespace
+
+Result<std::unique_ptr<HashJoin>> HashJoin::Make(JoinType join_type,
+                                                 const std::vector<Datum>& build_keys,
+                                                 ExecContext* ctx) {
+  auto impl = ::arrow::internal::make_unique<HashJoinImpl>(
+      join_type, ctx != nullptr ? *ctx : ExecContext());
+  RETURN_NOT_OK(impl->Build(build_keys));
+  return std::unique_ptr<HashJoin>(std::move(impl));
+}
+
+Result<std::unique_ptr<HashJoin>> HashJoin::Make(
+    JoinType join_type, const std::shared_ptr<Table>& build,
+    const std::vector<std::string>& build_key_names, ExecContext* ctx) {
+  std::vector<Datum> build_keys(build_key_names.size());
+  for (size_t i = 0; i < build_key_names.size(); ++i) {
+    auto column = build->GetColumnByName(build_key_names[i]);
+    if (column == nullptr) {
+      return Status::Invalid("No key column named '", build_key_names[i], "'");
+    }
+    build_keys[i] = std::move(column);
+  }
+  auto impl = ::arrow::internal::make_unique<HashJoinImpl>(
+      join_type, ctx != nullptr ? *ctx : ExecContext());
+  RETURN_NOT_OK(impl->Build(build_keys));
+  RETURN_NOT_OK(impl->SetBuildTable(build));
+  return std::unique_ptr<HashJoin>(std::move(impl));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,172 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+void AssertJoinIndices(const HashJoinIndices& indices, const std::string& probe_json,
+                       const std::string& build_json) {
+  ASSERT_OK(indices.probe_indices->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(int64(), probe_json), *indices.probe_indices,
+                    /*verbose=*/true);
+  if (build_json.empty()) {
+    ASSERT_EQ(indices.build_indices, nullptr);
+  } else {
+    ASSERT_OK(indices.build_indices->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(int64(), build_json), *indices.build_indices,
+                      /*verbose=*/true);
+  }
+}
+
+class TestHashJoin : public ::testing::Test {
+ public:
+  void SetUp() override {
+    build_keys_ = {ArrayFromJSON(int32(), "[1, 2, 1, null, 3, 5]")};
+    probe_keys_ = ExecBatch({ArrayFromJSON(int32(), "[2, null, 4, 1, 5]")}, 5);
+  }
+
+  HashJoinIndices Probe(JoinType join_type) {
+    EXPECT_OK_AND_ASSIGN(auto join, HashJoin::Make(join_type, build_keys_));
+    EXPECT_EQ(join->num_build_rows(), 6);
+    EXPECT_OK_AND_ASSIGN(auto indices, join->ProbeIndices(probe_keys_));
+    return indices;
+  }
+
+ protected:
+  std::vector<Datum> build_keys_;
+  ExecBatch probe_keys_;
+};
+
+TEST_F(TestHashJoin, Inner) {
+  AssertJoinIndices(Probe(JoinType::INNER), "[0, 3, 3, 4]", "[1, 0, 2, 5]");
+}
+
+TEST_F(TestHashJoin, LeftOuter) {
+  AssertJoinIndices(Probe(JoinType::LEFT_OUTER), "[0, 1, 2, 3, 3, 4]",
+                    "[1, null, null, 0, 2, 5]");
+}
+
+TEST_F(TestHashJoin, LeftSemi) {
+  AssertJoinIndices(Probe(JoinType::LEFT_SEMI), "[0, 3, 4]", "");
+}
+
+TEST_F(TestHashJoin, LeftAnti) {
+  AssertJoinIndices(Probe(JoinType::LEFT_ANTI), "[1, 2]", "");
+}
+
+TEST_F(TestHashJoin, NoMatches) {
+  probe_keys_ = ExecBatch({ArrayFromJSON(int32(), "[7, 8]")}, 2);
+  AssertJoinIndices(Probe(JoinType::INNER), "[]", "[]");
+  AssertJoinIndices(Probe(JoinType::LEFT_OUTER), "[0, 1]", "[null, null]");
+  AssertJoinIndices(Probe(JoinType::LEFT_ANTI), "[0, 1]", "");
+}
+
+TEST_F(TestHashJoin, ScalarProbeKey) {
+  probe_keys_ = ExecBatch({MakeScalar(int32(), 1).ValueOrDie()}, 2);
+  AssertJoinIndices(Probe(JoinType::INNER), "[0, 0, 1, 1]", "[0, 2, 0, 2]");
+}
+
+TEST(HashJoin, CompositeKeys) {
+  auto build_a = ChunkedArrayFromJSON(int64(), {"[1, 1]", "[2, 1, null]"});
+  auto build_b = ChunkedArrayFromJSON(utf8(), {R"(["x", "y"])", R"(["x", "x", "x"])"});
+  ASSERT_OK_AND_ASSIGN(auto join, HashJoin::Make(JoinType::INNER, {build_a, build_b}));
+
+  ExecBatch probe({ArrayFromJSON(int64(), "[1, 2, 1, null, 2]"),
+                   ArrayFromJSON(utf8(), R"(["x", "y", "y", "x", null])")},
+                  5);
+  ASSERT_OK_AND_ASSIGN(auto indices, join->ProbeIndices(probe));
+  AssertJoinIndices(indices, "[0, 0, 2]", "[0, 3, 1]");
+}
+
+TEST(HashJoin, Tables) {
+  // Several chunks, one of them empty
+  auto build = TableFromJSON(schema({field("id", int32()), field("name", utf8())}),
+                             {R"([{"id": 1, "name": "one"},
+                                  {"id": 2, "name": "two"}])",
+                              "[]",
+                              R"([{"id": 3, "name": "three"},
+                                  {"id": 1, "name": "uno"}])"});
+  auto probe = RecordBatchFromJSON(schema({field("key", int32()), field("x", float64())}),
+                                   R"([{"key": 3, "x": 0.5},
+                                       {"key": 4, "x": 1.5},
+                                       {"key": 1, "x": 2.5}])");
+
+  ASSERT_OK_AND_ASSIGN(auto join, HashJoin::Make(JoinType::LEFT_OUTER, build, {"id"}));
+  ASSERT_OK_AND_ASSIGN(auto joined, join->Probe(*probe, {"key"}));
+  ASSERT_OK(joined->ValidateFull());
+  AssertBatchesEqual(*RecordBatchFromJSON(schema({field("key", int32()),
+                                                   field("x", float64()),
+                                                   field("id", int32()),
+                                                   field("name", utf8())}),
+                                           R"([
+    {"key": 3, "x": 0.5, "id": 3, "name": "three"},
+    {"key": 4, "x": 1.5, "id": null, "name": null},
+    {"key": 1, "x": 2.5, "id": 1, "name": "one"},
+    {"key": 1, "x": 2.5, "id": 1, "name": "uno"}
+  ])"),
+                     *joined);
+
+  ASSERT_OK_AND_ASSIGN(join, HashJoin::Make(JoinType::LEFT_SEMI, build, {"id"}));
+  ASSERT_OK_AND_ASSIGN(joined, join->Probe(*probe, {"key"}));
+  AssertBatchesEqual(*RecordBatchFromJSON(probe->schema(),
+                                           R"([{"key": 3, "x": 0.5},
+                                               {"key": 1, "x": 2.5}])"),
+                     *joined);
+}
+
+TEST(HashJoin, Errors) {
+  std::vector<Datum> build_keys = {ArrayFromJSON(int32(), "[1, 2]")};
+  // No keys
+  ASSERT_RAISES(Invalid, HashJoin::Make(JoinType::INNER, std::vector<Datum>{}));
+  // Unsupported key type
+  ASSERT_RAISES(NotImplemented,
+                HashJoin::Make(JoinType::INNER,
+                               {ArrayFromJSON(list(int32()), "[[1], [2]]")}));
+
+  ASSERT_OK_AND_ASSIGN(auto join, HashJoin::Make(JoinType::INNER, build_keys));
+  // Mismatched probe keys
+  ASSERT_RAISES(Invalid, join->ProbeIndices(ExecBatch({}, 0)));
+  ASSERT_RAISES(TypeError,
+                join->ProbeIndices(ExecBatch({ArrayFromJSON(int64(), "[1]")}, 1)));
+  // Not made from a Table
+  auto probe = RecordBatchFromJSON(schema({field("key", int32())}), R"([{"key": 1}])");
+  ASSERT_RAISES(Invalid, join->Probe(*probe, {"key"}));
+
+  auto build =
+      TableFromJSON(schema({field("id", int32())}), {R"([{"id": 1}, {"id": 2}])"});
+  ASSERT_RAISES(Invalid, HashJoin::Make(JoinType::INNER, build, {"missing"}));
+  ASSERT_OK_AND_ASSIGN(join, HashJoin::Make(JoinType::INNER, build, {"id"}));
+  ASSERT_RAISES(Invalid, join->Probe(*probe, {"missing"}));
+}
+
+}  // namespace compute
+}  // namespace arrow
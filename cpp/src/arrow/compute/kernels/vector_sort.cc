@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <limits>
 #include <numeric>
 #include <type_traits>
@@ -25,11 +26,15 @@
 #include "arrow/array/data.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/common.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/make_unique.h"
 #include "arrow/util/optional.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/string_view.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -1523,6 +1528,343 @@ class MultipleKeyTableSorter : public TypeVisitor {
   Comparator comparator_;
 };
 
+// ----------------------------------------------------------------------
+// Parallel table sorting
+
+// Encodes the sort keys of each row of a RecordBatch as a byte string, such
+// that comparing the strings of two rows with memcmp() orders them as
+// MultipleKeyComparator would.  This makes multi-key comparisons branch-free
+// and independent of column types and chunking.
+//
+// Each key contributes a marker byte (so that nulls sort last and NaNs just
+// before them, regardless of the sort order) followed by the value:
+// - integers are stored big-endian, with the sign bit flipped;
+// - floating-point values are stored big-endian, with the sign bit flipped
+//   for positive values and all bits flipped for negative values;
+// - binary values are stored with 0x00 escaped as 0x00 0xFF, and terminated
+//   by 0x00 0x00, so that no encoded value is a prefix of another.
+// Value bytes are inverted for descending sort keys.
+class NormalizedKeyEncoder {
+ public:
+  static constexpr uint8_t kValueMarker = 0;
+  static constexpr uint8_t kNaNMarker = 1;
+  static constexpr uint8_t kNullMarker = 2;
+
+  NormalizedKeyEncoder(const RecordBatch& batch, const SortOptions& options)
+      : batch_(batch), options_(options), length_(batch.num_rows()) {}
+
+  Status Encode() {
+    std::vector<std::shared_ptr<Array>> arrays;
+    for (const auto& sort_key : options_.sort_keys) {
+      auto array = batch_.GetColumnByName(sort_key.name);
+      if (!array) {
+        return Status::Invalid("Nonexistent sort key column: ", sort_key.name);
+      }
+      arrays.push_back(GetPhysicalArray(*array, GetPhysicalType(array->type())));
+    }
+
+    // Measure the encoded rows, then write them
+    for (int pass = 0; pass < 2; ++pass) {
+      writing_ = pass == 1;
+      if (writing_) {
+        if (row_width_ >= 0) {
+          bytes_.resize(row_width_ * length_);
+        } else {
+          // Turn the row lengths into start offsets
+          offsets_.resize(length_ + 1);
+          int64_t offset = 0;
+          for (int64_t i = 0; i < length_; ++i) {
+            const int64_t row_length = offsets_[i];
+            offsets_[i] = offset;
+            offset += row_length;
+          }
+          offsets_[length_] = offset;
+          bytes_.resize(offset);
+        }
+        cursors_.resize(length_);
+        for (int64_t i = 0; i < length_; ++i) {
+          cursors_[i] = bytes_.data() + (row_width_ >= 0 ? i * row_width_ : offsets_[i]);
+        }
+      }
+      for (size_t k = 0; k < arrays.size(); ++k) {
+        current_array_ = arrays[k].get();
+        descending_ = options_.sort_keys[k].order == SortOrder::Descending;
+        RETURN_NOT_OK(VisitTypeInline(*current_array_->type(), this));
+      }
+    }
+    cursors_.clear();
+    return Status::OK();
+  }
+
+  util::string_view key(int64_t i) const {
+    if (row_width_ >= 0) {
+      return util::string_view(
+          reinterpret_cast<const char*>(bytes_.data() + i * row_width_), row_width_);
+    }
+    return util::string_view(reinterpret_cast<const char*>(bytes_.data() + offsets_[i]),
+                             offsets_[i + 1] - offsets_[i]);
+  }
+
+#define VISIT(TYPE) \
+  Status Visit(const TYPE& type) { return VisitInternal<TYPE>(); }
+
+  VISIT_PHYSICAL_TYPES(VISIT)
+
+#undef VISIT
+
+  Status Visit(const DataType& type) {
+    return Status::TypeError("Unsupported type for Table sorting: ", type.ToString());
+  }
+
+ private:
+  template <typename Type>
+  enable_if_t<is_integer_type<Type>::value || is_floating_type<Type>::value, Status>
+  VisitInternal() {
+    using CType = typename TypeTraits<Type>::CType;
+    constexpr int64_t kWidth = 1 + sizeof(CType);
+    if (!writing_) {
+      // Nulls are padded so that rows remain fixed-width if possible
+      if (row_width_ >= 0) {
+        row_width_ += kWidth;
+      } else {
+        AddLength(kWidth);
+      }
+      return Status::OK();
+    }
+    const auto& array = checked_cast<const typename TypeTraits<Type>::ArrayType&>(
+        *current_array_);
+    int64_t i = 0;
+    VisitRawValuesInline(
+        array,
+        [&](CType value) {
+          uint8_t*& out = cursors_[i++];
+          WriteValue(value, &out);
+        },
+        [&]() {
+          uint8_t*& out = cursors_[i++];
+          *out = kNullMarker;
+          std::memset(out + 1, 0, sizeof(CType));
+          out += kWidth;
+        });
+    return Status::OK();
+  }
+
+  template <typename Type>
+  enable_if_t<is_base_binary_type<Type>::value, Status> VisitInternal() {
+    const auto& array = checked_cast<const typename TypeTraits<Type>::ArrayType&>(
+        *current_array_);
+    if (!writing_) {
+      // Switch to variable-width rows
+      if (row_width_ >= 0) {
+        offsets_.assign(length_, row_width_);
+        row_width_ = -1;
+      }
+      for (int64_t i = 0; i < length_; ++i) {
+        if (array.IsNull(i)) {
+          offsets_[i] += 1;
+          continue;
+        }
+        const auto value = array.GetView(i);
+        offsets_[i] += 1 + value.size() + 2 +
+                       std::count(value.begin(), value.end(), '\0');
+      }
+      return Status::OK();
+    }
+    const uint8_t mask = descending_ ? 0xFF : 0x00;
+    for (int64_t i = 0; i < length_; ++i) {
+      uint8_t*& out = cursors_[i];
+      if (array.IsNull(i)) {
+        *out++ = kNullMarker;
+        continue;
+      }
+      *out++ = kValueMarker;
+      for (const char c : array.GetView(i)) {
+        const auto byte = static_cast<uint8_t>(c);
+        *out++ = byte ^ mask;
+        if (byte == 0) {
+          *out++ = 0xFF ^ mask;
+        }
+      }
+      *out++ = mask;
+      *out++ = mask;
+    }
+    return Status::OK();
+  }
+
+  void AddLength(int64_t width) {
+    for (int64_t i = 0; i < length_; ++i) {
+      offsets_[i] += width;
+    }
+  }
+
+  template <typename CType>
+  enable_if_t<std::is_integral<CType>::value> WriteValue(CType value, uint8_t** out) {
+    using UnsignedType = typename std::make_unsigned<CType>::type;
+    auto bits = static_cast<UnsignedType>(value);
+    if (std::is_signed<CType>::value) {
+      bits ^= static_cast<UnsignedType>(UnsignedType{1} << (sizeof(CType) * 8 - 1));
+    }
+    WriteBits(kValueMarker, bits, out);
+  }
+
+  template <typename CType>
+  enable_if_t<std::is_floating_point<CType>::value> WriteValue(CType value,
+                                                                uint8_t** out) {
+    using UnsignedType =
+        typename std::conditional<sizeof(CType) == 4, uint32_t, uint64_t>::type;
+    constexpr auto kSignBit = static_cast<UnsignedType>(UnsignedType{1}
+                                                        << (sizeof(CType) * 8 - 1));
+    if (std::isnan(value)) {
+      WriteBits(kNaNMarker, UnsignedType{0}, out);
+      return;
+    }
+    if (value == 0) {
+      // -0.0 and 0.0 compare equal
+      value = 0;
+    }
+    UnsignedType bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    bits = (bits & kSignBit) ? ~bits : (bits | kSignBit);
+    WriteBits(kValueMarker, bits, out);
+  }
+
+  template <typename UnsignedType>
+  void WriteBits(uint8_t marker, UnsignedType bits, uint8_t** out) {
+    if (descending_ && marker == kValueMarker) {
+      bits = static_cast<UnsignedType>(~bits);
+    }
+    bits = BitUtil::ToBigEndian(bits);
+    **out = marker;
+    std::memcpy(*out + 1, &bits, sizeof(bits));
+    *out += 1 + sizeof(bits);
+  }
+
+  const RecordBatch& batch_;
+  const SortOptions& options_;
+  const int64_t length_;
+
+  // Rows are fixed-width unless a key is variable-width, in which case
+  // offsets_ holds the start of each row (or its length while measuring)
+  int64_t row_width_ = 0;
+  std::vector<int64_t> offsets_;
+  std::vector<uint8_t> bytes_;
+
+  bool writing_ = false;
+  const Array* current_array_ = NULLPTR;
+  bool descending_ = false;
+  std::vector<uint8_t*> cursors_;
+};
+
+// Sort a table by splitting it into slices which are sorted independently on
+// the CPU thread pool, then merging the sorted slices.  Both steps compare
+// rows using normalized keys.
+class ParallelTableSorter {
+ public:
+  // Slices smaller than this are not worth sorting separately
+  static constexpr int64_t kMinSliceLength = 1 << 16;
+
+  ParallelTableSorter(uint64_t* indices_begin, uint64_t* indices_end, const Table& table,
+                      const SortOptions& options)
+      : indices_begin_(indices_begin),
+        indices_end_(indices_end),
+        table_(table),
+        options_(options) {}
+
+  static bool ShouldUse(ExecContext* ctx, const Table& table) {
+    return ctx->use_threads() && table.num_rows() >= 2 * kMinSliceLength;
+  }
+
+  Status Sort() {
+    RETURN_NOT_OK(SliceTable());
+    const int num_slices = static_cast<int>(slices_.size());
+    encoders_.resize(num_slices);
+    sorted_.resize(table_.num_rows());
+
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(num_slices, [&](int i) {
+      const RecordBatch& slice = *slices_[i];
+      encoders_[i].reset(new NormalizedKeyEncoder(slice, options_));
+      RETURN_NOT_OK(encoders_[i]->Encode());
+      const auto& encoder = *encoders_[i];
+      uint64_t* begin = sorted_.data() + slice_offsets_[i];
+      uint64_t* end = begin + slice.num_rows();
+      std::iota(begin, end, 0);
+      std::stable_sort(begin, end, [&](uint64_t left, uint64_t right) {
+        return encoder.key(left).compare(encoder.key(right)) < 0;
+      });
+      return Status::OK();
+    }));
+
+    Merge();
+    return Status::OK();
+  }
+
+ private:
+  Status SliceTable() {
+    const int64_t num_rows = table_.num_rows();
+    const int64_t capacity = GetCpuThreadPoolCapacity();
+    TableBatchReader reader(table_);
+    const int64_t slice_length = (num_rows + capacity - 1) / capacity;
+    reader.set_chunksize(slice_length > kMinSliceLength ? slice_length : kMinSliceLength);
+    int64_t offset = 0;
+    while (true) {
+      std::shared_ptr<RecordBatch> slice;
+      RETURN_NOT_OK(reader.ReadNext(&slice));
+      if (!slice) break;
+      if (slice->num_rows() == 0) continue;
+      slice_offsets_.push_back(offset);
+      offset += slice->num_rows();
+      slices_.push_back(std::move(slice));
+    }
+    return Status::OK();
+  }
+
+  // K-way merge of the sorted slices into the output, using a heap of the
+  // current row of each slice.  Ties go to the earlier slice, so that the
+  // sort is stable.
+  void Merge() {
+    struct Cursor {
+      int slice;
+      uint64_t* current;
+      uint64_t* end;
+    };
+    std::vector<Cursor> heap;
+    for (size_t i = 0; i < slices_.size(); ++i) {
+      uint64_t* begin = sorted_.data() + slice_offsets_[i];
+      heap.push_back({static_cast<int>(i), begin, begin + slices_[i]->num_rows()});
+    }
+    auto greater = [&](const Cursor& left, const Cursor& right) {
+      const int compared = encoders_[left.slice]->key(*left.current).compare(
+          encoders_[right.slice]->key(*right.current));
+      return compared != 0 ? compared > 0 : left.slice > right.slice;
+    };
+    std::make_heap(heap.begin(), heap.end(), greater);
+
+    uint64_t* out = indices_begin_;
+    while (!heap.empty()) {
+      std::pop_heap(heap.begin(), heap.end(), greater);
+      Cursor& cursor = heap.back();
+      *out++ = slice_offsets_[cursor.slice] + *cursor.current++;
+      if (cursor.current == cursor.end) {
+        heap.pop_back();
+      } else {
+        std::push_heap(heap.begin(), heap.end(), greater);
+      }
+    }
+    DCHECK_EQ(out, indices_end_);
+  }
+
+  uint64_t* indices_begin_;
+  uint64_t* indices_end_;
+  const Table& table_;
+  const SortOptions& options_;
+
+  std::vector<std::shared_ptr<RecordBatch>> slices_;
+  std::vector<int64_t> slice_offsets_;
+  std::vector<std::unique_ptr<NormalizedKeyEncoder>> encoders_;
+  // The sorted indices of each slice, relative to the slice
+  std::vector<uint64_t> sorted_;
+};
+
 // ----------------------------------------------------------------------
 // Top-level sort functions
 
@@ -1650,7 +1992,7 @@ class SortIndicesMetaFunction : public MetaFunction {
     if (n_sort_keys == 0) {
       return Status::Invalid("Must specify one or more sort keys");
     }
-    if (n_sort_keys == 1) {
+    if (n_sort_keys == 1 && !ParallelTableSorter::ShouldUse(ctx, table)) {
       auto chunked_array = table.GetColumnByName(options.sort_keys[0].name);
       if (!chunked_array) {
         return Status::Invalid("Nonexistent sort key column: ",
@@ -1679,12 +2021,298 @@ class SortIndicesMetaFunction : public MetaFunction {
     //
     // TableRadixSorter sorter;
     // ARROW_RETURN_NOT_OK(sorter.Sort(ctx, out_begin, out_end, table, options));
+    if (ParallelTableSorter::ShouldUse(ctx, table)) {
+      ParallelTableSorter sorter(out_begin, out_end, table, options);
+      ARROW_RETURN_NOT_OK(sorter.Sort());
+      return Datum(out);
+    }
     MultipleKeyTableSorter sorter(out_begin, out_end, table, options);
     ARROW_RETURN_NOT_OK(sorter.Sort());
     return Datum(out);
   }
 };
 
+// ----------------------------------------------------------------------
+// Select K
+
+// Compares values of a sort key column, which may come from different
+// arrays.  Nulls sort last and NaNs just before them, regardless of the sort
+// order, as in the sorters above.
+class ColumnComparator {
+ public:
+  explicit ColumnComparator(SortOrder order) : order_(order) {}
+  virtual ~ColumnComparator() = default;
+
+  virtual int Compare(const Array& left, int64_t left_index, const Array& right,
+                      int64_t right_index) const = 0;
+
+ protected:
+  SortOrder order_;
+};
+
+template <typename Type>
+class ConcreteColumnComparator : public ColumnComparator {
+ public:
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+
+  using ColumnComparator::ColumnComparator;
+
+  int Compare(const Array& left, int64_t left_index, const Array& right,
+              int64_t right_index) const override {
+    const bool left_null = left.IsNull(left_index);
+    const bool right_null = right.IsNull(right_index);
+    if (left_null || right_null) {
+      return static_cast<int>(left_null) - static_cast<int>(right_null);
+    }
+    const auto left_value = checked_cast<const ArrayType&>(left).GetView(left_index);
+    const auto right_value = checked_cast<const ArrayType&>(right).GetView(right_index);
+    return CompareValues(left_value, right_value);
+  }
+
+ private:
+  template <typename ValueType>
+  enable_if_t<!std::is_floating_point<ValueType>::value, int> CompareValues(
+      const ValueType& left, const ValueType& right) const {
+    const int compared = (left > right) - (left < right);
+    return order_ == SortOrder::Descending ? -compared : compared;
+  }
+
+  template <typename ValueType>
+  enable_if_t<std::is_floating_point<ValueType>::value, int> CompareValues(
+      ValueType left, ValueType right) const {
+    const bool left_nan = std::isnan(left);
+    const bool right_nan = std::isnan(right);
+    if (left_nan || right_nan) {
+      return static_cast<int>(left_nan) - static_cast<int>(right_nan);
+    }
+    const int compared = (left > right) - (left < right);
+    return order_ == SortOrder::Descending ? -compared : compared;
+  }
+};
+
+struct ColumnComparatorFactory {
+#define VISIT(TYPE)                                                            \
+  Status Visit(const TYPE& type) {                                             \
+    out = ::arrow::internal::make_unique<ConcreteColumnComparator<TYPE>>(order); \
+    return Status::OK();                                                       \
+  }
+
+  VISIT_PHYSICAL_TYPES(VISIT)
+
+#undef VISIT
+
+  Status Visit(const DataType& type) {
+    return Status::TypeError("Unsupported type for select_k: ", type.ToString());
+  }
+
+  SortOrder order;
+  std::unique_ptr<ColumnComparator> out;
+};
+
+// Select the first k rows of a table, in sorted order.  The table is split
+// into slices; the best k rows of each slice are kept in a bounded heap, then
+// the candidates of all slices are sorted and truncated to k rows.
+class TableSelecter {
+ public:
+  TableSelecter(ExecContext* ctx, const Table& table, int64_t k,
+                const std::vector<SortKey>& sort_keys)
+      : ctx_(ctx), table_(table), k_(k), sort_keys_(sort_keys) {}
+
+  Result<std::shared_ptr<ArrayData>> Select() {
+    for (const auto& sort_key : sort_keys_) {
+      const auto& column = table_.GetColumnByName(sort_key.name);
+      if (!column) {
+        return Status::Invalid("Nonexistent sort key column: ", sort_key.name);
+      }
+      ColumnComparatorFactory factory{sort_key.order, nullptr};
+      RETURN_NOT_OK(VisitTypeInline(*GetPhysicalType(column->type()), &factory));
+      comparators_.push_back(std::move(factory.out));
+    }
+    RETURN_NOT_OK(SliceTable());
+
+    // Keep the best k rows of each slice
+    const int num_slices = static_cast<int>(slices_.size());
+    std::vector<std::vector<uint64_t>> slice_candidates(num_slices);
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        ctx_->use_threads(), num_slices, [&](int i) {
+          slice_candidates[i] = SelectSlice(slices_[i]);
+          return Status::OK();
+        }));
+
+    // Merge the candidates of all slices
+    struct Candidate {
+      const Slice* slice;
+      uint64_t index;
+    };
+    std::vector<Candidate> candidates;
+    for (int i = 0; i < num_slices; ++i) {
+      for (uint64_t index : slice_candidates[i]) {
+        candidates.push_back({&slices_[i], index});
+      }
+    }
+    const auto out_length = std::min<int64_t>(k_, candidates.size());
+    auto less = [&](const Candidate& left, const Candidate& right) {
+      return Less(*left.slice, left.index, *right.slice, right.index);
+    };
+    std::partial_sort(candidates.begin(), candidates.begin() + out_length,
+                      candidates.end(), less);
+
+    ARROW_ASSIGN_OR_RAISE(
+        auto indices, AllocateBuffer(out_length * sizeof(uint64_t), ctx_->memory_pool()));
+    auto out = reinterpret_cast<uint64_t*>(indices->mutable_data());
+    for (int64_t i = 0; i < out_length; ++i) {
+      out[i] = candidates[i].slice->offset + candidates[i].index;
+    }
+    return ArrayData::Make(uint64(), out_length, {nullptr, std::move(indices)},
+                           /*null_count=*/0);
+  }
+
+ private:
+  struct Slice {
+    int64_t offset;
+    int64_t length;
+    // The physical arrays of each sort key
+    std::vector<std::shared_ptr<Array>> keys;
+  };
+
+  Status SliceTable() {
+    const int64_t num_rows = table_.num_rows();
+    TableBatchReader reader(table_);
+    if (ctx_->use_threads()) {
+      const int64_t capacity = GetCpuThreadPoolCapacity();
+      const int64_t slice_length = (num_rows + capacity - 1) / capacity;
+      const int64_t min_length = ParallelTableSorter::kMinSliceLength;
+      reader.set_chunksize(slice_length > min_length ? slice_length : min_length);
+    }
+    int64_t offset = 0;
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (!batch) break;
+      if (batch->num_rows() == 0) continue;
+      Slice slice{offset, batch->num_rows(), {}};
+      for (const auto& sort_key : sort_keys_) {
+        const auto& array = batch->GetColumnByName(sort_key.name);
+        slice.keys.push_back(GetPhysicalArray(*array, GetPhysicalType(array->type())));
+      }
+      offset += batch->num_rows();
+      slices_.push_back(std::move(slice));
+    }
+    return Status::OK();
+  }
+
+  // Whether the left row sorts before the right row.  Ties are broken by
+  // position, so that selection is stable.
+  bool Less(const Slice& left_slice, uint64_t left, const Slice& right_slice,
+            uint64_t right) const {
+    for (size_t i = 0; i < comparators_.size(); ++i) {
+      const int compared = comparators_[i]->Compare(*left_slice.keys[i], left,
+                                                    *right_slice.keys[i], right);
+      if (compared != 0) {
+        return compared < 0;
+      }
+    }
+    return left_slice.offset + left < right_slice.offset + right;
+  }
+
+  std::vector<uint64_t> SelectSlice(const Slice& slice) const {
+    // A max-heap of the best rows seen so far, so that the worst of them is
+    // on top and can be evicted by a better row
+    auto less = [&](uint64_t left, uint64_t right) {
+      return Less(slice, left, slice, right);
+    };
+    std::vector<uint64_t> heap;
+    const auto heap_size = static_cast<size_t>(std::min(k_, slice.length));
+    heap.reserve(heap_size);
+    for (int64_t i = 0; i < slice.length; ++i) {
+      const auto index = static_cast<uint64_t>(i);
+      if (heap.size() < heap_size) {
+        heap.push_back(index);
+        std::push_heap(heap.begin(), heap.end(), less);
+      } else if (heap_size > 0 && less(index, heap.front())) {
+        std::pop_heap(heap.begin(), heap.end(), less);
+        heap.back() = index;
+        std::push_heap(heap.begin(), heap.end(), less);
+      }
+    }
+    return heap;
+  }
+
+  ExecContext* ctx_;
+  const Table& table_;
+  const int64_t k_;
+  const std::vector<SortKey>& sort_keys_;
+
+  std::vector<std::unique_ptr<ColumnComparator>> comparators_;
+  std::vector<Slice> slices_;
+};
+
+const auto kDefaultSelectKOptions = SelectKOptions::Defaults();
+
+const FunctionDoc select_k_doc(
+    "Return the indices of the first k rows of the sorted input",
+    ("This function computes the first k elements of the indices that define\n"
+     "a stable sort of the input array, record batch or table, as given by\n"
+     "sort_indices, without sorting the entire input.  Null values are\n"
+     "considered greater than any other value.  For floating-point types,\n"
+     "NaNs are considered greater than any other non-null value, but smaller\n"
+     "than null values.\n"
+     "\n"
+     "The number of rows `k` must be given in SelectKOptions."),
+    {"input"}, "SelectKOptions");
+
+class SelectKMetaFunction : public MetaFunction {
+ public:
+  SelectKMetaFunction()
+      : MetaFunction("select_k", Arity::Unary(), &select_k_doc,
+                     &kDefaultSelectKOptions) {}
+
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    const auto& select_k_options = static_cast<const SelectKOptions&>(*options);
+    if (select_k_options.k < 0) {
+      return Status::Invalid("select_k requires a non-negative k, got ",
+                             select_k_options.k);
+    }
+    std::shared_ptr<Table> table;
+    std::vector<SortKey> sort_keys = select_k_options.sort_keys;
+    switch (args[0].kind()) {
+      case Datum::ARRAY:
+      case Datum::CHUNKED_ARRAY: {
+        // Select from a single-column table, ordered by the first sort key
+        SortOrder order = SortOrder::Ascending;
+        if (!sort_keys.empty()) {
+          order = sort_keys[0].order;
+        }
+        auto column = args[0].kind() == Datum::ARRAY
+                          ? std::make_shared<ChunkedArray>(args[0].make_array())
+                          : args[0].chunked_array();
+        auto values_schema = ::arrow::schema({field("values", column->type())});
+        table = Table::Make(std::move(values_schema), {std::move(column)});
+        sort_keys = {SortKey("values", order)};
+      } break;
+      case Datum::RECORD_BATCH: {
+        ARROW_ASSIGN_OR_RAISE(table, Table::FromRecordBatches({args[0].record_batch()}));
+      } break;
+      case Datum::TABLE:
+        table = args[0].table();
+        break;
+      default:
+        return Status::NotImplemented(
+            "Unsupported types for select_k operation: "
+            "values=",
+            args[0].ToString());
+    }
+    if (sort_keys.empty()) {
+      return Status::Invalid("Must specify one or more sort keys");
+    }
+    TableSelecter selecter(ctx, *table, select_k_options.k, sort_keys);
+    ARROW_ASSIGN_OR_RAISE(auto out, selecter.Select());
+    return Datum(std::move(out));
+  }
+};
+
 const auto kDefaultArraySortOptions = ArraySortOptions::Defaults();
 
 const FunctionDoc array_sort_indices_doc(
@@ -1729,6 +2357,7 @@ void RegisterVectorSort(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunction(std::move(array_sort_indices)));
 
   DCHECK_OK(registry->AddFunction(std::make_shared<SortIndicesMetaFunction>()));
+  DCHECK_OK(registry->AddFunction(std::make_shared<SelectKMetaFunction>()));
 
   // partition_nth_indices has a parameter so needs its init function
   auto part_indices = std::make_shared<VectorFunction>(
@@ -858,6 +858,130 @@ TEST_F(TestTableSortIndices, NaNAndNull) {
   AssertSortIndices(table, options, "[7, 1, 2, 6, 5, 4, 0, 3]");
 }
 
+// A chunked table with many ties, and binary values with embedded zeros
+std::shared_ptr<Table> MakeRandomTableWithTies(int64_t length) {
+  random::RandomArrayGenerator rand(0x5487656);
+
+  // Binary values with embedded zeros, to exercise escaping in normalized keys
+  const std::vector<std::string> binary_values = {
+      "", std::string("\0", 1), std::string("\0\0", 2), "a", std::string("a\0", 2),
+      std::string("\0a", 2)};
+  std::default_random_engine engine(0x5487656);
+  std::uniform_int_distribution<size_t> distribution(0, binary_values.size());
+  BinaryBuilder binary_builder;
+  for (int64_t i = 0; i < length; ++i) {
+    const size_t choice = distribution(engine);
+    if (choice == binary_values.size()) {
+      ABORT_NOT_OK(binary_builder.AppendNull());
+    } else {
+      ABORT_NOT_OK(binary_builder.Append(binary_values[choice]));
+    }
+  }
+  std::shared_ptr<Array> binary_array;
+  ABORT_NOT_OK(binary_builder.Finish(&binary_array));
+
+  auto table = Table::Make(
+      schema({field("a", int16()), field("b", float64()), field("c", utf8()),
+              field("d", uint8()), field("e", binary())}),
+      {rand.Int16(length, -20, 20, 0.05), rand.Float64(length, -1, 1, 0.05, 0.05),
+       rand.String(length, 0, 2, 0.05), rand.UInt8(length, 0, 3, 0.1), binary_array});
+  TableBatchReader reader(*table);
+  reader.set_chunksize(length / 7);
+  std::shared_ptr<Table> chunked_table;
+  ABORT_NOT_OK(reader.ReadAll(&chunked_table));
+  return chunked_table;
+}
+
+std::vector<std::vector<SortKey>> RandomTableSortKeys() {
+  return {{SortKey("a", SortOrder::Ascending), SortKey("c", SortOrder::Descending),
+           SortKey("b", SortOrder::Ascending)},
+          {SortKey("e", SortOrder::Descending), SortKey("d", SortOrder::Ascending)},
+          {SortKey("b", SortOrder::Descending), SortKey("e", SortOrder::Ascending)},
+          {SortKey("a", SortOrder::Descending)}};
+}
+
+TEST_F(TestTableSortIndices, ParallelMatchesSerial) {
+  // Large enough to be sorted as several slices in parallel
+  auto chunked_table = MakeRandomTableWithTies(300000);
+
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  ExecContext parallel_ctx;
+  parallel_ctx.set_use_threads(true);
+
+  for (const auto& sort_keys : RandomTableSortKeys()) {
+    SortOptions options(sort_keys);
+    ASSERT_OK_AND_ASSIGN(auto expected,
+                         SortIndices(Datum(chunked_table), options, &serial_ctx));
+    ASSERT_OK_AND_ASSIGN(auto actual,
+                         SortIndices(Datum(chunked_table), options, &parallel_ctx));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*expected, *actual);
+  }
+}
+
+// ----------------------------------------------------------------------
+// Tests for SelectK
+
+void AssertSelectK(const Datum& input, int64_t k, const SortOptions& options,
+                   const std::string& expected) {
+  ASSERT_OK_AND_ASSIGN(auto actual, SelectK(input, k, options));
+  ASSERT_OK(actual->ValidateFull());
+  AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual, /*verbose=*/true);
+}
+
+TEST(SelectK, Array) {
+  auto array = ArrayFromJSON(int32(), "[3, null, 1, 5, 1, null, 4]");
+  AssertSelectK(array, 3, SortOptions(), "[2, 4, 0]");
+  SortOptions descending({SortKey("unused", SortOrder::Descending)});
+  AssertSelectK(array, 3, descending, "[3, 6, 0]");
+  AssertSelectK(array, 0, descending, "[]");
+  AssertSelectK(array, 100, SortOptions(), "[2, 4, 0, 6, 3, 1, 5]");
+  AssertSelectK(array, 100, descending, "[3, 6, 0, 2, 4, 1, 5]");
+
+  ASSERT_RAISES(Invalid, SelectK(array, -1, SortOptions()));
+}
+
+TEST(SelectK, ChunkedArray) {
+  auto chunked_array = ChunkedArrayFromJSON(
+      float64(), {"[NaN, 2.5]", "[]", "[null, -1, 2.5]", "[0, NaN, -0.0]"});
+  AssertSelectK(chunked_array, 4, SortOptions(), "[3, 5, 7, 1]");
+  AssertSelectK(chunked_array, 6, SortOptions({SortKey("", SortOrder::Descending)}),
+                "[1, 4, 5, 7, 3, 0]");
+  AssertSelectK(chunked_array, 8, SortOptions(), "[3, 5, 7, 1, 4, 0, 6, 2]");
+}
+
+TEST(SelectK, RecordBatch) {
+  auto batch = RecordBatchFromJSON(schema({field("a", int32()), field("b", utf8())}),
+                                   R"([{"a": 1, "b": "x"},
+                                       {"a": 2, "b": "y"},
+                                       {"a": null, "b": "z"},
+                                       {"a": 2, "b": "z"},
+                                       {"a": 1, "b": "w"}])");
+  SortOptions options({SortKey("a", SortOrder::Descending), SortKey("b")});
+  AssertSelectK(batch, 3, options, "[1, 3, 4]");
+
+  ASSERT_RAISES(Invalid, SelectK(batch, 3, SortOptions()));
+  ASSERT_RAISES(Invalid, SelectK(batch, 3, SortOptions({SortKey("nonexistent")})));
+}
+
+TEST(SelectK, TableMatchesSortIndices) {
+  auto table = MakeRandomTableWithTies(150000);
+  for (const bool use_threads : {false, true}) {
+    ExecContext ctx;
+    ctx.set_use_threads(use_threads);
+    for (const auto& sort_keys : RandomTableSortKeys()) {
+      SortOptions options(sort_keys);
+      ASSERT_OK_AND_ASSIGN(auto sorted, SortIndices(Datum(table), options, &ctx));
+      for (const int64_t k : {0, 1, 10, 1000, 150001}) {
+        ASSERT_OK_AND_ASSIGN(auto actual, SelectK(Datum(table), k, options, &ctx));
+        ASSERT_OK(actual->ValidateFull());
+        AssertArraysEqual(*sorted->Slice(0, k), *actual);
+      }
+    }
+  }
+}
+
 // Tests for temporal types
 template <typename ArrowType>
 class TestTableSortIndicesForTemporal : public TestTableSortIndices {
@@ -131,6 +131,7 @@ static std::unique_ptr<FunctionRegistry> CreateBuiltInRegistry() {
   RegisterScalarAggregateMode(registry.get());
   RegisterScalarAggregateQuantile(registry.get());
   RegisterScalarAggregateVariance(registry.get());
+  RegisterHashAggregateBasic(registry.get());
 
   // Vector functions
   RegisterVectorHash(registry.get());
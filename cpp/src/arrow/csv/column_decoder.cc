@@ -239,16 +239,24 @@ class InferringColumnDecoder : public ConcreteColumnDecoder {
  public:
   InferringColumnDecoder(int32_t col_index, const ConvertOptions& options,
                          MemoryPool* pool,
-                         const std::shared_ptr<internal::TaskGroup>& task_group)
+                         const std::shared_ptr<internal::TaskGroup>& task_group,
+                         int64_t num_inference_blocks)
       : ConcreteColumnDecoder(pool, task_group, col_index),
         options_(options),
         infer_status_(options),
-        type_frozen_(false) {}
+        type_frozen_(false),
+        num_inference_blocks_(num_inference_blocks),
+        num_inference_parsers_(0),
+        inference_started_(false),
+        inference_failed_(false),
+        inference_done_(Future<>::Make()) {}
 
   Status Init();
 
   void Insert(int64_t block_index, const std::shared_ptr<BlockParser>& parser) override;
 
+  void SetEOF(int64_t num_blocks) override;
+
  protected:
   std::shared_ptr<DataType> type() const override {
     DCHECK_NE(converter_, nullptr);
@@ -257,6 +265,9 @@ class InferringColumnDecoder : public ConcreteColumnDecoder {
 
   Status UpdateType();
   Result<std::shared_ptr<Array>> RunInference(const std::shared_ptr<BlockParser>& parser);
+  // Whether all the inference blocks were inserted and inference can start
+  bool ShouldStartInferenceUnlocked();
+  void StartInference();
 
   // CAUTION: ConvertOptions can grow large (if it customizes hundreds or
   // thousands of columns), so avoid copying it in each InferringColumnDecoder.
@@ -267,6 +278,14 @@ class InferringColumnDecoder : public ConcreteColumnDecoder {
   bool type_frozen_;
   std::shared_ptr<Converter> converter_;
 
+  // The first blocks, over which the type is inferred
+  int64_t num_inference_blocks_;
+  int64_t num_inference_parsers_;
+  bool inference_started_;
+  // Whether all the inference blocks failed converting
+  bool inference_failed_;
+  Future<> inference_done_;
+
   // The parsers corresponding to each chunk (for reconverting)
   std::vector<std::shared_ptr<BlockParser>> parsers_;
 };
@@ -294,34 +313,89 @@ Result<std::shared_ptr<Array>> InferringColumnDecoder::RunInference(
   }
 }
 
+bool InferringColumnDecoder::ShouldStartInferenceUnlocked() {
+  if (inference_started_ || num_inference_parsers_ < num_inference_blocks_) {
+    return false;
+  }
+  inference_started_ = true;
+  return true;
+}
+
+void InferringColumnDecoder::StartInference() {
+  if (num_inference_blocks_ == 0) {
+    type_frozen_ = true;
+    inference_done_.MarkFinished();
+    return;
+  }
+
+  task_group_->Append([this]() -> Status {
+    std::vector<Result<std::shared_ptr<Array>>> results;
+    results.reserve(static_cast<size_t>(num_inference_blocks_));
+    for (int64_t i = 0; i < num_inference_blocks_; ++i) {
+      results.push_back(RunInference(parsers_[i]));
+    }
+    // Blocks converted before the type was loosened by a later block are
+    // converted again
+    bool all_failed = true;
+    for (int64_t i = 0; i < num_inference_blocks_; ++i) {
+      if (!results[i].ok()) {
+        continue;
+      }
+      all_failed = false;
+      if (!(*results[i])->type()->Equals(*converter_->type())) {
+        results[i] = converter_->Convert(*parsers_[i], col_index_);
+      }
+    }
+
+    // The decoder may be destroyed as soon as the chunks are fetched, so
+    // don't touch it after releasing the lock
+    std::unique_lock<std::mutex> lock(mutex_);
+    DCHECK(!type_frozen_);
+    type_frozen_ = true;
+    inference_failed_ = all_failed;
+    parsers_.clear();
+    inference_done_.MarkFinished();
+    for (int64_t i = 0; i < num_inference_blocks_; ++i) {
+      SetChunkUnlocked(i, std::move(results[i]));
+    }
+    return Status::OK();
+  });
+}
+
 void InferringColumnDecoder::Insert(int64_t block_index,
                                     const std::shared_ptr<BlockParser>& parser) {
   PrepareChunk(block_index);
 
-  // First block: run inference
-  if (block_index == 0) {
-    task_group_->Append([=]() -> Status {
-      auto maybe_array = RunInference(parser);
-
+  // First blocks: keep them until all of them are available, then run
+  // inference over them
+  if (block_index < num_inference_blocks_) {
+    bool start_inference;
+    {
       std::unique_lock<std::mutex> lock(mutex_);
-      DCHECK(!type_frozen_);
-      type_frozen_ = true;
-      SetChunkUnlocked(block_index, std::move(maybe_array));
-      return Status::OK();
-    });
+      DCHECK(!inference_started_);
+      if (parsers_.size() <= static_cast<size_t>(block_index)) {
+        parsers_.resize(static_cast<size_t>(block_index) + 1);
+      }
+      parsers_[block_index] = parser;
+      ++num_inference_parsers_;
+      start_inference = ShouldStartInferenceUnlocked();
+    }
+    if (start_inference) {
+      StartInference();
+    }
     return;
   }
 
-  // Non-first block: wait for inference to finish on first block now,
+  // Other blocks: wait for inference to finish on the first blocks now,
   // without blocking a TaskGroup thread.
+  inference_done_.Wait();
   {
     std::unique_lock<std::mutex> lock(mutex_);
-    PrepareChunkUnlocked(0);
-    WaitForChunkUnlocked(0);
-    if (!chunks_[0].status().ok()) {
-      // Failed converting first chunk: bail out by marking EOF,
+    if (inference_failed_) {
+      // Failed converting the first chunks: bail out by marking EOF,
       // because we can't decide a type for the other chunks.
       SetChunkUnlocked(block_index, std::shared_ptr<Array>());
+      return;
     }
     DCHECK(type_frozen_);
   }
@@ -335,14 +409,32 @@ void InferringColumnDecoder::Insert(int64_t block_index,
   });
 }
 
+void InferringColumnDecoder::SetEOF(int64_t num_blocks) {
+  ConcreteColumnDecoder::SetEOF(num_blocks);
+
+  // Fewer blocks than the inference blocks: run inference over all of them
+  bool start_inference = false;
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (num_blocks < num_inference_blocks_) {
+      num_inference_blocks_ = num_blocks;
+      start_inference = ShouldStartInferenceUnlocked();
+    }
+  }
+  if (start_inference) {
+    StartInference();
+  }
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Factory functions
 
 Result<std::shared_ptr<ColumnDecoder>> ColumnDecoder::Make(
     MemoryPool* pool, int32_t col_index, const ConvertOptions& options,
-    std::shared_ptr<TaskGroup> task_group) {
-  auto ptr = std::make_shared<InferringColumnDecoder>(col_index, options, pool,
-                                                      std::move(task_group));
+    std::shared_ptr<TaskGroup> task_group, int64_t num_inference_blocks) {
+  DCHECK_GE(num_inference_blocks, 1);
+  auto ptr = std::make_shared<InferringColumnDecoder>(
+      col_index, options, pool, std::move(task_group), num_inference_blocks);
   RETURN_NOT_OK(ptr->Init());
   return ptr;
 }
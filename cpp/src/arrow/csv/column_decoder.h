@@ -59,10 +59,12 @@ class ARROW_EXPORT ColumnDecoder {
       const ConvertOptions& options, std::shared_ptr<internal::TaskGroup> task_group);
 
   /// Construct a type-inferring ColumnDecoder.
-  /// Inference will run only on the first block, the type will be frozen afterwards.
+  /// Inference will run on the first `num_inference_blocks` blocks, the type will
+  /// be frozen afterwards.  No chunk is available before all of those blocks were
+  /// inserted, or EOF was set.
   static Result<std::shared_ptr<ColumnDecoder>> Make(
       MemoryPool* pool, int32_t col_index, const ConvertOptions& options,
-      std::shared_ptr<internal::TaskGroup> task_group);
+      std::shared_ptr<internal::TaskGroup> task_group, int64_t num_inference_blocks = 1);
 
   /// Construct a ColumnDecoder for a column of nulls
   /// (i.e. not present in the CSV file).
@@ -320,9 +320,10 @@ class InferringColumnDecoderTest : public ColumnDecoderTest {
  public:
   InferringColumnDecoderTest() { tg_ = ExecutorType::task_group(); }
 
-  void MakeDecoder(const ConvertOptions& options) {
+  void MakeDecoder(const ConvertOptions& options, int64_t num_inference_blocks = 1) {
     ASSERT_OK_AND_ASSIGN(auto decoder,
-                         ColumnDecoder::Make(default_memory_pool(), 0, options, tg_));
+                         ColumnDecoder::Make(default_memory_pool(), 0, options, tg_,
+                                             num_inference_blocks));
     SetDecoder(decoder);
   }
 
@@ -395,6 +396,29 @@ class InferringColumnDecoderTest : public ColumnDecoderTest {
     AssertFetchEOF();
   }
 
+  void TestInferenceBlocks() {
+    auto type = float64();
+
+    // The type is loosened by the second block, the first one is converted again
+    MakeDecoder(default_options, /*num_inference_blocks=*/2);
+
+    AppendChunks({{"123", "456"}, {"7.5", "N/A"}, {"8"}});
+    SetEOF();
+    AssertFetch(ArrayFromJSON(type, "[123, 456]"));
+    AssertFetch(ArrayFromJSON(type, "[7.5, null]"));
+    AssertFetch(ArrayFromJSON(type, "[8]"));
+    AssertFetchEOF();
+
+    // Fewer blocks than the inference blocks
+    MakeDecoder(default_options, /*num_inference_blocks=*/3);
+
+    AppendChunks({{"123"}, {"N/A"}});
+    SetEOF();
+    AssertFetch(ArrayFromJSON(int64(), "[123]"));
+    AssertFetch(ArrayFromJSON(int64(), "[null]"));
+    AssertFetchEOF();
+  }
+
   void TestEmpty() {
     auto type = null();
 
@@ -421,6 +445,10 @@ TYPED_TEST(InferringColumnDecoderTest, Errors) { this->TestErrors(); }
 
 TYPED_TEST(InferringColumnDecoderTest, Empty) { this->TestEmpty(); }
 
+TYPED_TEST(InferringColumnDecoderTest, InferenceBlocks) {
+  this->TestInferenceBlocks();
+}
+
 // More inference tests are in InferringColumnBuilderTest
 
 }  // namespace csv
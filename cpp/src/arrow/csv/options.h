@@ -137,5 +137,25 @@ struct ARROW_EXPORT ReadOptions {
   static ReadOptions Defaults();
 };
 
+struct ARROW_EXPORT WriteOptions {
+  // Writer options
+
+  /// Whether to write a header line with the column names
+  bool include_header = true;
+  /// Field delimiter
+  char delimiter = ',';
+  /// Quoting character, used around string and binary values, column names,
+  /// and any other value containing the delimiter, quote or newline characters
+  char quote_char = '"';
+  /// Number of rows formatted at a time; also determines the size of the
+  /// slices formatted in parallel when use_threads is true
+  int32_t batch_size = 1024;
+  /// Whether to use the global CPU thread pool
+  bool use_threads = true;
+
+  /// Create write options with default values
+  static WriteOptions Defaults();
+};
+
 }  // namespace csv
 }  // namespace arrow
@@ -19,13 +19,16 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <limits>
 #include <utility>
 
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/simd.h"
 
 namespace arrow {
 namespace csv {
@@ -76,12 +79,33 @@ class PresizedDataWriter {
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
+  // Push `length` characters at once.  As the buffer is as large as the input,
+  // this may copy a few more characters than requested (which will be
+  // overwritten) as long as they are before `data_end`, avoiding a variable
+  // length memcpy() call for short runs.
+  void PushFieldChars(const char* data, int64_t length, const char* data_end) {
+    DCHECK_LE(parsed_size_ + length, parsed_capacity_);
+    uint8_t* out = parsed_ + parsed_size_;
+    parsed_size_ += length;
+    while (length > 0 && data_end - data >= kCopyWidth) {
+      std::memcpy(out, data, kCopyWidth);
+      out += kCopyWidth;
+      data += kCopyWidth;
+      length -= kCopyWidth;
+    }
+    if (length > 0) {
+      std::memcpy(out, data, static_cast<size_t>(length));
+    }
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
   int64_t size() { return parsed_size_; }
 
  protected:
+  static constexpr int64_t kCopyWidth = 16;
+
   std::shared_ptr<ResizableBuffer> parsed_buffer_;
   uint8_t* parsed_;
   int64_t parsed_size_;
@@ -168,6 +192,134 @@ class PresizedValueDescWriter : public ValueDescWriter<PresizedValueDescWriter>
   }
 };
 
+#if defined(ARROW_HAVE_AVX2)
+constexpr int64_t kBulkScanWidth = 32;
+#elif defined(ARROW_HAVE_SSE4_2)
+constexpr int64_t kBulkScanWidth = 16;
+#else
+constexpr int64_t kBulkScanWidth = 0;
+#endif
+
+// A helper class finding runs of regular characters inside fields, so that
+// they can be copied in bulk instead of going through the parsing state
+// machine character by character.
+//
+// The data is classified kBulkScanWidth bytes at a time using SIMD
+// comparisons, yielding the bitmasks of the characters which end a run in
+// a non-quoted field (delimiter, newlines and escape character) and in a
+// quoted field (quote and escape characters).  The bitmasks are kept for
+// the following fields until the whole block was consumed.
+template <typename SpecializedOptions>
+class BulkScanner {
+ public:
+  BulkScanner(const ParseOptions& options, const char* data_end)
+      : delimiter_(options.delimiter),
+        quote_char_(options.quote_char),
+        escape_char_(options.escape_char),
+        block_(data_end) {}
+
+  // Number of regular characters in a non-quoted field starting at `data`
+  int64_t UnquotedRunLength(const char* data, const char* data_end) {
+    return RunLength</*Quoted=*/false>(data, data_end);
+  }
+
+  // Number of regular characters in a quoted field starting at `data`
+  int64_t QuotedRunLength(const char* data, const char* data_end) {
+    return RunLength</*Quoted=*/true>(data, data_end);
+  }
+
+ private:
+  template <bool Quoted>
+  int64_t RunLength(const char* data, const char* data_end) {
+    if (kBulkScanWidth == 0) {
+      return 0;
+    }
+    // Fast path: the run ends inside the last classified block
+    uint64_t offset = static_cast<uint64_t>(data - block_);
+    if (ARROW_PREDICT_TRUE(offset < kBulkScanWidth)) {
+      const uint64_t mask = (Quoted ? quoted_mask_ : unquoted_mask_) >> offset;
+      if (ARROW_PREDICT_TRUE(mask != 0)) {
+        return BitUtil::CountTrailingZeros(mask);
+      }
+    }
+    int64_t length = 0;
+    while (true) {
+      offset = static_cast<uint64_t>(data - block_);
+      if (offset >= kBulkScanWidth) {
+        if (data_end - data < kBulkScanWidth) {
+          // Leave the tail of the data to the state machine
+          return length;
+        }
+        Classify(data);
+        offset = 0;
+      }
+      const uint64_t mask = (Quoted ? quoted_mask_ : unquoted_mask_) >> offset;
+      if (mask != 0) {
+        return length + BitUtil::CountTrailingZeros(mask);
+      }
+      length += kBulkScanWidth - offset;
+      data += kBulkScanWidth - offset;
+    }
+  }
+
+  void Classify(const char* data) {
+#if defined(ARROW_HAVE_AVX2)
+    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    auto match = [&](char c) { return _mm256_cmpeq_epi8(block, _mm256_set1_epi8(c)); };
+    __m256i unquoted =
+        _mm256_or_si256(match(delimiter_), _mm256_or_si256(match('\n'), match('\r')));
+    __m256i quoted = match(quote_char_);
+    if (SpecializedOptions::escaping) {
+      const __m256i escape = match(escape_char_);
+      unquoted = _mm256_or_si256(unquoted, escape);
+      quoted = _mm256_or_si256(quoted, escape);
+    }
+    unquoted_mask_ = static_cast<uint32_t>(_mm256_movemask_epi8(unquoted));
+    quoted_mask_ = static_cast<uint32_t>(_mm256_movemask_epi8(quoted));
+#elif defined(ARROW_HAVE_SSE4_2)
+    const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    auto match = [&](char c) { return _mm_cmpeq_epi8(block, _mm_set1_epi8(c)); };
+    __m128i unquoted =
+        _mm_or_si128(match(delimiter_), _mm_or_si128(match('\n'), match('\r')));
+    __m128i quoted = match(quote_char_);
+    if (SpecializedOptions::escaping) {
+      const __m128i escape = match(escape_char_);
+      unquoted = _mm_or_si128(unquoted, escape);
+      quoted = _mm_or_si128(quoted, escape);
+    }
+    unquoted_mask_ = static_cast<uint16_t>(_mm_movemask_epi8(unquoted));
+    quoted_mask_ = static_cast<uint16_t>(_mm_movemask_epi8(quoted));
+#endif
+    block_ = data;
+  }
+
+  char delimiter_;
+  char quote_char_;
+  char escape_char_;
+
+  // The start of the last classified block.  Initially, this points to the end of
+  // the data with all bits set in the masks, so that no run is ever found there.
+  const char* block_;
+  uint64_t unquoted_mask_ = ~uint64_t(0);
+  uint64_t quoted_mask_ = ~uint64_t(0);
+};
+
+// Whether fields at the start of the data are long enough on average for bulk
+// scanning to pay off.  On short fields, the extra work after each character
+// outweighs the bulk copies, so those are parsed character by character.
+bool HasLongFields(const ParseOptions& options, util::string_view data) {
+  constexpr size_t kSampleSize = 4096;
+  if (kBulkScanWidth == 0) {
+    return false;
+  }
+  const auto sample = data.substr(0, kSampleSize);
+  int64_t num_fields = 1;
+  for (const char c : sample) {
+    num_fields += (c == options.delimiter) | (c == '\n');
+  }
+  return static_cast<int64_t>(sample.size()) >= num_fields * kBulkScanWidth;
+}
+
 }  // namespace
 
 class BlockParserImpl {
@@ -178,10 +330,11 @@ class BlockParserImpl {
 
   const DataBatch& parsed_batch() const { return batch_; }
 
-  template <typename SpecializedOptions, typename ValueDescWriter, typename DataWriter>
+  template <typename SpecializedOptions, bool BulkScan, typename ValueDescWriter,
+            typename DataWriter>
   Status ParseLine(ValueDescWriter* values_writer, DataWriter* parsed_writer,
-                   const char* data, const char* data_end, bool is_final,
-                   const char** out_data) {
+                   BulkScanner<SpecializedOptions>* scanner, const char* data,
+                   const char* data_end, bool is_final, const char** out_data) {
     int32_t num_cols = 0;
     char c;
 
@@ -253,6 +406,11 @@ class BlockParserImpl {
       }
     }
     parsed_writer->PushFieldChar(c);
+    if (BulkScan) {
+      const int64_t run_length = scanner->UnquotedRunLength(data, data_end);
+      parsed_writer->PushFieldChars(data, run_length, data_end);
+      data += run_length;
+    }
     goto InField;
 
   InQuotedField:
@@ -280,6 +438,11 @@ class BlockParserImpl {
       }
     }
     parsed_writer->PushFieldChar(c);
+    if (BulkScan) {
+      const int64_t run_length = scanner->QuotedRunLength(data, data_end);
+      parsed_writer->PushFieldChars(data, run_length, data_end);
+      data += run_length;
+    }
     goto InQuotedField;
 
   FieldEnd:
@@ -333,23 +496,50 @@ class BlockParserImpl {
     return Status::OK();
   }
 
-  template <typename SpecializedOptions, typename ValueDescWriter, typename DataWriter>
-  Status ParseChunk(ValueDescWriter* values_writer, DataWriter* parsed_writer,
-                    const char* data, const char* data_end, bool is_final,
-                    int32_t rows_in_chunk, const char** out_data,
+  // Parse lines until `num_rows_deadline` rows are in the batch.  Each value of
+  // `BulkScan` gets its own loop, so that the character by character one is
+  // not slowed down by the registers taken by the bulk scanner.
+  template <typename SpecializedOptions, bool BulkScan, typename ValueDescWriter,
+            typename DataWriter>
+  Status ParseLines(ValueDescWriter* values_writer, DataWriter* parsed_writer,
+                    BulkScanner<SpecializedOptions>* scanner, const char** data,
+                    const char* data_end, bool is_final, int32_t num_rows_deadline,
                     bool* finished_parsing) {
-    int32_t num_rows_deadline = batch_.num_rows_ + rows_in_chunk;
-
-    while (data < data_end && batch_.num_rows_ < num_rows_deadline) {
-      const char* line_end = data;
-      RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, data,
-                                                  data_end, is_final, &line_end));
-      if (line_end == data) {
+    // Work on a local copy of the scanner, so that its state can be kept in
+    // registers rather than reloaded after each character written out
+    BulkScanner<SpecializedOptions> local_scanner = *scanner;
+
+    while (*data < data_end && batch_.num_rows_ < num_rows_deadline) {
+      const char* line_end = *data;
+      RETURN_NOT_OK((ParseLine<SpecializedOptions, BulkScan>(
+          values_writer, parsed_writer, &local_scanner, *data, data_end, is_final,
+          &line_end)));
+      if (line_end == *data) {
         // Cannot parse any further
         *finished_parsing = true;
         break;
       }
-      data = line_end;
+      *data = line_end;
+    }
+    *scanner = local_scanner;
+    return Status::OK();
+  }
+
+  template <typename SpecializedOptions, typename ValueDescWriter, typename DataWriter>
+  Status ParseChunk(ValueDescWriter* values_writer, DataWriter* parsed_writer,
+                    BulkScanner<SpecializedOptions>* scanner, const char* data,
+                    const char* data_end, bool is_final, int32_t rows_in_chunk,
+                    bool bulk_scan, const char** out_data, bool* finished_parsing) {
+    int32_t num_rows_deadline = batch_.num_rows_ + rows_in_chunk;
+
+    if (bulk_scan) {
+      RETURN_NOT_OK((ParseLines<SpecializedOptions, true>(
+          values_writer, parsed_writer, scanner, &data, data_end, is_final,
+          num_rows_deadline, finished_parsing)));
+    } else {
+      RETURN_NOT_OK((ParseLines<SpecializedOptions, false>(
+          values_writer, parsed_writer, scanner, &data, data_end, is_final,
+          num_rows_deadline, finished_parsing)));
     }
     // Append new buffers and update size
     std::shared_ptr<Buffer> values_buffer;
@@ -384,6 +574,8 @@ class BlockParserImpl {
       const char* data = view.data();
       const char* data_end = view.data() + view.length();
       bool finished_parsing = false;
+      BulkScanner<SpecializedOptions> scanner(options_, data_end);
+      const bool bulk_scan = HasLongFields(options_, view);
 
       if (batch_.num_cols_ == -1) {
         // Can't presize values when the number of columns is not known, first parse
@@ -392,9 +584,9 @@ class BlockParserImpl {
         ResizableValueDescWriter values_writer(pool_);
         values_writer.Start(parsed_writer);
 
-        RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                     data_end, is_final, rows_in_chunk,
-                                                     &data, &finished_parsing));
+        RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
+            &values_writer, &parsed_writer, &scanner, data, data_end, is_final,
+            rows_in_chunk, bulk_scan, &data, &finished_parsing));
         if (batch_.num_cols_ == -1) {
           return ParseError("Empty CSV file or block: cannot infer number of columns");
         }
@@ -417,9 +609,9 @@ class BlockParserImpl {
         PresizedValueDescWriter values_writer(pool_, rows_in_chunk, batch_.num_cols_);
         values_writer.Start(parsed_writer);
 
-        RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                     data_end, is_final, rows_in_chunk,
-                                                     &data, &finished_parsing));
+        RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
+            &values_writer, &parsed_writer, &scanner, data, data_end, is_final,
+            rows_in_chunk, bulk_scan, &data, &finished_parsing));
       }
       DCHECK_GE(data, view.data());
       DCHECK_LE(data, data_end);
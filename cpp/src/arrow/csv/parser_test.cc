@@ -623,5 +623,56 @@ TEST(BlockParser, QuotedEscape) {
   }
 }
 
+TEST(BlockParser, LongFields) {
+  // Fields spanning several SIMD blocks, with special characters at all
+  // positions relative to block boundaries.  The longest fields come first,
+  // so that the parser picks bulk scanning for the block.
+  auto options = ParseOptions::Defaults();
+  options.escaping = true;
+
+  std::string csv;
+  std::vector<std::string> unquoted, quoted;
+  for (int length = 99; length >= 0; --length) {
+    std::string value(length, 'x');
+    for (int i = 0; i < length; ++i) {
+      value[i] = static_cast<char>('a' + (i % 26));
+    }
+    if (length > 0) {
+      // Insert an escaped delimiter, resp. a doubled quote
+      unquoted.push_back(value.substr(0, length / 2) + "," + value.substr(length / 2));
+      quoted.push_back(value.substr(0, length / 2) + "\"" + value.substr(length / 2));
+      csv += value.substr(0, length / 2) + "\\," + value.substr(length / 2) + ",\"" +
+             value.substr(0, length / 2) + "\"\"" + value.substr(length / 2) + "\"\n";
+    } else {
+      unquoted.push_back("");
+      quoted.push_back("");
+      csv += ",\"\"\n";
+    }
+  }
+  std::vector<bool> unquoted_flags(unquoted.size(), false);
+  std::vector<bool> quoted_flags(quoted.size(), true);
+  {
+    BlockParser parser(options);
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {unquoted, quoted}, {unquoted_flags, quoted_flags});
+  }
+  {
+    // Same, split in two views
+    const size_t split = csv.find('\n', csv.size() / 3) + 1;
+    std::vector<util::string_view> views = {util::string_view(csv).substr(0, split),
+                                            util::string_view(csv).substr(split)};
+    BlockParser parser(options);
+    AssertParseOk(parser, views);
+    AssertColumnsEq(parser, {unquoted, quoted}, {unquoted_flags, quoted_flags});
+  }
+  {
+    // Truncated last line
+    BlockParser parser(options);
+    AssertParsePartial(parser, csv + std::string(50, 'x'),
+                       static_cast<uint32_t>(csv.size()));
+    AssertColumnsEq(parser, {unquoted, quoted}, {unquoted_flags, quoted_flags});
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -17,8 +17,10 @@
 
 #include "arrow/csv/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -40,6 +42,7 @@
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -554,9 +557,9 @@ class BaseStreamingReader : public ReaderMixin, public csv::StreamingReader {
                               ColumnDecoder::Make(pool_, column.type, column.index,
                                                   convert_options_, task_group_));
       } else {
-        ARROW_ASSIGN_OR_RAISE(
-            decoder,
-            ColumnDecoder::Make(pool_, column.index, convert_options_, task_group_));
+        ARROW_ASSIGN_OR_RAISE(decoder,
+                              ColumnDecoder::Make(pool_, column.index, convert_options_,
+                                                  task_group_, num_inference_blocks_));
       }
       column_decoders_.push_back(std::move(decoder));
     }
@@ -625,6 +628,8 @@ class BaseStreamingReader : public ReaderMixin, public csv::StreamingReader {
   std::shared_ptr<Schema> schema_;
   std::shared_ptr<RecordBatch> pending_batch_;
   bool eof_ = false;
+  // Number of first blocks over which the column types are inferred
+  int64_t num_inference_blocks_ = 1;
 };
 
 /////////////////////////////////////////////////////////////////////////
@@ -716,6 +721,148 @@ class SerialStreamingReader : public BaseStreamingReader {
   std::shared_ptr<SerialBlockReader> block_reader_;
 };
 
+/////////////////////////////////////////////////////////////////////////
+// Parallel StreamingReader implementation
+
+class ThreadedStreamingReader : public BaseStreamingReader {
+ public:
+  ThreadedStreamingReader(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                          const ReadOptions& read_options,
+                          const ParseOptions& parse_options,
+                          const ConvertOptions& convert_options, ThreadPool* thread_pool)
+      : BaseStreamingReader(pool, input, read_options, parse_options, convert_options),
+        thread_pool_(thread_pool) {}
+
+  ~ThreadedStreamingReader() override {
+    // Make sure all pending tasks are finished before we start destroying
+    // BaseStreamingReader members
+    for (auto& parsed_block : parsed_blocks_) {
+      parsed_block.Wait();
+    }
+    if (task_group_) {
+      ARROW_UNUSED(task_group_->Finish());
+    }
+  }
+
+  Status Init() override {
+    ARROW_ASSIGN_OR_RAISE(auto istream_it,
+                          io::MakeInputStreamIterator(input_, read_options_.block_size));
+
+    readahead_ = std::max(thread_pool_->GetCapacity(), 1);
+    // The blocks read ahead for the first batch are all parsed before it is
+    // yielded, so the column types are inferred over all of them
+    num_inference_blocks_ = readahead_;
+    ARROW_ASSIGN_OR_RAISE(auto rh_it,
+                          MakeReadaheadIterator(std::move(istream_it), readahead_));
+    buffer_iterator_ = CSVBufferIterator::Make(std::move(rh_it));
+    task_group_ = internal::TaskGroup::MakeThreaded(thread_pool_);
+
+    // Read schema from first batch
+    ARROW_ASSIGN_OR_RAISE(pending_batch_, ReadNext());
+    DCHECK_NE(schema_, nullptr);
+    return Status::OK();
+  }
+
+ protected:
+  Result<std::shared_ptr<RecordBatch>> ReadNext() override {
+    if (eof_) {
+      return nullptr;
+    }
+    if (block_reader_ == nullptr) {
+      Status st = SetupReader();
+      if (!st.ok()) {
+        // Can't setup reader => bail out
+        eof_ = true;
+        return st;
+      }
+    }
+    auto batch = std::move(pending_batch_);
+    if (batch != nullptr) {
+      return batch;
+    }
+
+    Status st = ReadAhead();
+    if (!st.ok()) {
+      // Read or parse error => bail out
+      eof_ = true;
+      return st;
+    }
+    ++num_batches_read_;
+    return DecodeNextBatch();
+  }
+
+  // Keep up to `readahead_` blocks being parsed or converted in the background,
+  // and make sure the block of the next batch was handed to the column decoders
+  Status ReadAhead() {
+    while (!source_eof_ && num_blocks_ - num_batches_read_ < readahead_) {
+      ARROW_ASSIGN_OR_RAISE(auto maybe_block, block_reader_->Next());
+      if (!maybe_block.has_value()) {
+        source_eof_ = true;
+        break;
+      }
+      DCHECK(!maybe_block->consume_bytes);
+      ++num_blocks_;
+
+      // Launch parse task
+      auto block = std::move(maybe_block).value();
+      ARROW_ASSIGN_OR_RAISE(auto parsed_block, thread_pool_->Submit([this, block] {
+        return Parse(block.partial, block.completion, block.buffer, block.block_index,
+                     block.is_final);
+      }));
+      parsed_blocks_.push_back(std::move(parsed_block));
+    }
+
+    // Hand the parsed blocks to the column decoders in order, from this thread
+    // as type inference waits for the inference blocks to be converted.  The
+    // inference blocks and the block of the next batch are waited for, the
+    // following ones only if ready.
+    while (!parsed_blocks_.empty() &&
+           (num_blocks_decoding_ < num_inference_blocks_ ||
+            num_blocks_decoding_ == num_batches_read_ ||
+            parsed_blocks_.front().is_finished())) {
+      auto parsed_block = std::move(parsed_blocks_.front());
+      parsed_blocks_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(auto result, parsed_block.result());
+      RETURN_NOT_OK(ProcessData(result.parser, num_blocks_decoding_++));
+    }
+    if (source_eof_ && parsed_blocks_.empty() && !decoders_eof_) {
+      decoders_eof_ = true;
+      for (auto& decoder : column_decoders_) {
+        decoder->SetEOF(num_blocks_);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status SetupReader() {
+    ARROW_ASSIGN_OR_RAISE(auto first_buffer, buffer_iterator_.Next());
+    if (first_buffer == nullptr) {
+      return Status::Invalid("Empty CSV file");
+    }
+    RETURN_NOT_OK(ProcessHeader(first_buffer, &first_buffer));
+    RETURN_NOT_OK(MakeColumnDecoders());
+
+    block_reader_ = std::make_shared<ThreadedBlockReader>(MakeChunker(parse_options_),
+                                                          std::move(buffer_iterator_),
+                                                          std::move(first_buffer));
+    return Status::OK();
+  }
+
+  ThreadPool* thread_pool_;
+  int32_t readahead_ = 1;
+  std::shared_ptr<ThreadedBlockReader> block_reader_;
+  // The blocks being parsed, in order
+  std::deque<Future<ParseResult>> parsed_blocks_;
+  bool source_eof_ = false;
+  bool decoders_eof_ = false;
+  // Number of blocks read from the source
+  int64_t num_blocks_ = 0;
+  // Number of blocks handed to the column decoders
+  int64_t num_blocks_decoding_ = 0;
+  // Number of batches requested from the column decoders
+  int64_t num_batches_read_ = 0;
+};
+
 /////////////////////////////////////////////////////////////////////////
 // Serial TableReader implementation
 
@@ -864,8 +1011,13 @@ Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
     const ReadOptions& read_options, const ParseOptions& parse_options,
     const ConvertOptions& convert_options) {
   std::shared_ptr<BaseStreamingReader> reader;
-  reader = std::make_shared<SerialStreamingReader>(pool, input, read_options,
-                                                   parse_options, convert_options);
+  if (read_options.use_threads) {
+    reader = std::make_shared<ThreadedStreamingReader>(
+        pool, input, read_options, parse_options, convert_options, GetCpuThreadPool());
+  } else {
+    reader = std::make_shared<SerialStreamingReader>(pool, input, read_options,
+                                                     parse_options, convert_options);
+  }
   RETURN_NOT_OK(reader->Init());
   return reader;
 }
@@ -56,8 +56,13 @@ class ARROW_EXPORT StreamingReader : public RecordBatchReader {
 
   /// Create a StreamingReader instance
   ///
-  /// Currently, the StreamingReader is always single-threaded (parallel
-  /// readahead is not supported).
+  /// If ReadOptions::use_threads is true, up to as many blocks as the capacity
+  /// of the CPU thread pool are read ahead, parsed and converted in parallel.
+  /// Batches are still yielded in order, one per block.
+  ///
+  /// The types of the columns are inferred from the blocks read ahead before
+  /// the first batch is yielded, i.e. from the first block only when
+  /// ReadOptions::use_threads is false.
   static Result<std::shared_ptr<StreamingReader>> Make(
       MemoryPool* pool, std::shared_ptr<io::InputStream> input, const ReadOptions&,
       const ParseOptions&, const ConvertOptions&);
@@ -0,0 +1,195 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace csv {
+
+class TestStreamingReader : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() override {
+    old_capacity_ = GetCpuThreadPoolCapacity();
+    ASSERT_OK(SetCpuThreadPoolCapacity(4));
+  }
+
+  void TearDown() override { ASSERT_OK(SetCpuThreadPoolCapacity(old_capacity_)); }
+
+  // A CSV file of many blocks with columns of various types
+  std::string MakeCSV(int num_rows) {
+    std::string csv = "i,f,s,b\n";
+    for (int i = 0; i < num_rows; ++i) {
+      csv += std::to_string(i - 100) + "," + std::to_string(i) + ".5,\"s" +
+             std::to_string(i % 17) + "\"," + (i % 3 ? "true" : "false") + "\n";
+    }
+    return csv;
+  }
+
+  ReadOptions MakeReadOptions() {
+    auto options = ReadOptions::Defaults();
+    options.use_threads = GetParam();
+    options.block_size = 1000;
+    return options;
+  }
+
+  Result<std::shared_ptr<StreamingReader>> MakeReader(
+      const std::string& csv, const ReadOptions& read_options,
+      const ConvertOptions& convert_options = ConvertOptions::Defaults()) {
+    auto input = std::make_shared<io::BufferReader>(Buffer::FromString(csv));
+    return StreamingReader::Make(default_memory_pool(), input, read_options,
+                                 ParseOptions::Defaults(), convert_options);
+  }
+
+ protected:
+  int old_capacity_;
+};
+
+TEST_P(TestStreamingReader, ReadAll) {
+  const std::string csv = MakeCSV(2000);
+  auto read_options = MakeReadOptions();
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(csv, read_options));
+
+  auto expected_schema = schema({field("i", int64()), field("f", float64()),
+                                 field("s", utf8()), field("b", boolean())});
+  AssertSchemaEqual(*expected_schema, *reader->schema());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  ASSERT_GT(batches.size(), 10);
+  for (const auto& batch : batches) {
+    ASSERT_OK(batch->ValidateFull());
+  }
+  // Reading past the end keeps returning null
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+
+  // Same data as the table reader
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(batches));
+  auto input = std::make_shared<io::BufferReader>(Buffer::FromString(csv));
+  ASSERT_OK_AND_ASSIGN(auto table_reader,
+                       TableReader::Make(default_memory_pool(), input, read_options,
+                                         ParseOptions::Defaults(),
+                                         ConvertOptions::Defaults()));
+  ASSERT_OK_AND_ASSIGN(auto expected, table_reader->Read());
+  AssertTablesEqual(*expected, *table, /*same_chunk_layout=*/false);
+}
+
+TEST_P(TestStreamingReader, ConversionError) {
+  std::string csv = MakeCSV(2000);
+  // An invalid integer in the middle of the file
+  csv.replace(csv.find("\n900,"), 5, "\nxxx,");
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader(csv, MakeReadOptions()));
+
+  std::shared_ptr<RecordBatch> batch;
+  int64_t num_rows = 0;
+  Status st;
+  while (true) {
+    st = reader->ReadNext(&batch);
+    if (!st.ok() || batch == nullptr) break;
+    num_rows += batch->num_rows();
+  }
+  ASSERT_RAISES(Invalid, st);
+  ASSERT_LT(num_rows, 1000);
+  ASSERT_GT(num_rows, 0);
+}
+
+// Integers in the first block, floats in the following ones
+static std::string MakeLooseningCSV() {
+  std::string csv = "x,s\n";
+  for (int i = 0; i < 100; ++i) {
+    csv += std::to_string(i) + (i < 30 ? "" : ".5") + "," + std::string(40, 'a') + "\n";
+  }
+  return csv;
+}
+
+TEST(TestStreamingReader, TypeOfFirstBlockSerial) {
+  // The serial reader only infers the types from the first block
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = false;
+  read_options.block_size = 1000;
+  auto input = std::make_shared<io::BufferReader>(Buffer::FromString(MakeLooseningCSV()));
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       StreamingReader::Make(default_memory_pool(), input, read_options,
+                                             ParseOptions::Defaults(),
+                                             ConvertOptions::Defaults()));
+  AssertSchemaEqual(*schema({field("x", int64()), field("s", utf8())}),
+                    *reader->schema());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_RAISES(Invalid, reader->ReadAll(&batches));
+}
+
+TEST(TestStreamingReader, TypeLoosenedAfterFirstBlockThreaded) {
+  // The threaded reader infers the types from the blocks read ahead
+  const int old_capacity = GetCpuThreadPoolCapacity();
+  ASSERT_OK(SetCpuThreadPoolCapacity(4));
+
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = true;
+  read_options.block_size = 1000;
+  auto input = std::make_shared<io::BufferReader>(Buffer::FromString(MakeLooseningCSV()));
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       StreamingReader::Make(default_memory_pool(), input, read_options,
+                                             ParseOptions::Defaults(),
+                                             ConvertOptions::Defaults()));
+  AssertSchemaEqual(*schema({field("x", float64()), field("s", utf8())}),
+                    *reader->schema());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  ASSERT_GT(batches.size(), 2);
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(batches));
+  ASSERT_OK(table->ValidateFull());
+  ASSERT_EQ(100, table->num_rows());
+
+  ASSERT_OK(SetCpuThreadPoolCapacity(old_capacity));
+}
+
+TEST_P(TestStreamingReader, EmptyFile) {
+  ASSERT_RAISES(Invalid, MakeReader("", MakeReadOptions()));
+}
+
+TEST_P(TestStreamingReader, HeaderOnly) {
+  ASSERT_OK_AND_ASSIGN(auto reader, MakeReader("a,b\n", MakeReadOptions()));
+  AssertSchemaEqual(*schema({field("a", null()), field("b", null())}),
+                    *reader->schema());
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+INSTANTIATE_TEST_SUITE_P(Serial, TestStreamingReader, ::testing::Values(false));
+INSTANTIATE_TEST_SUITE_P(Threaded, TestStreamingReader, ::testing::Values(true));
+
+}  // namespace csv
+}  // namespace arrow
@@ -19,9 +19,11 @@ namespace arrow {
 namespace csv {
 
 class TableReader;
+class CSVWriter;
 struct ConvertOptions;
 struct ReadOptions;
 struct ParseOptions;
+struct WriteOptions;
 
 }  // namespace csv
 }  // namespace arrow
@@ -0,0 +1,473 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/writer.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/future.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::GetCpuThreadPool;
+
+namespace csv {
+
+namespace {
+
+// The formatted values of a slice of a column, stored contiguously
+struct FormattedColumn {
+  std::string data;
+  // Offset of the end of each value in data
+  std::vector<int64_t> ends;
+
+  void EndValue() { ends.push_back(static_cast<int64_t>(data.size())); }
+};
+
+// Appends values to a formatted column, quoting them as needed
+class Quoter {
+ public:
+  explicit Quoter(const WriteOptions& options)
+      : quote_char_(options.quote_char),
+        special_chars_{options.delimiter, options.quote_char, '\n', '\r'} {}
+
+  // Append a value between quotes, doubling the quote characters it contains
+  void AppendQuoted(util::string_view value, std::string* out) const {
+    out->push_back(quote_char_);
+    while (!value.empty()) {
+      auto quote = static_cast<const char*>(
+          std::memchr(value.data(), quote_char_, value.size()));
+      if (quote == nullptr) {
+        out->append(value.data(), value.size());
+        break;
+      }
+      const size_t length = quote - value.data() + 1;
+      out->append(value.data(), length);
+      out->push_back(quote_char_);
+      value.remove_prefix(length);
+    }
+    out->push_back(quote_char_);
+  }
+
+  // Append a value, between quotes only if it contains a special character
+  void AppendMaybeQuoted(util::string_view value, std::string* out) const {
+    if (value.find_first_of(special_chars_.data(), 0, special_chars_.size()) ==
+        util::string_view::npos) {
+      out->append(value.data(), value.size());
+    } else {
+      AppendQuoted(value, out);
+    }
+  }
+
+ private:
+  char quote_char_;
+  std::array<char, 4> special_chars_;
+};
+
+class ColumnFormatter {
+ public:
+  explicit ColumnFormatter(const Quoter& quoter) : quoter_(quoter) {}
+  virtual ~ColumnFormatter() = default;
+
+  // Called with each column of a record batch before its slices are formatted
+  virtual Status Prepare(const Array& column) { return Status::OK(); }
+
+  // Append the formatted values of a slice of the column to out.  May be
+  // called concurrently for different slices.
+  virtual Status Format(const Array& slice, FormattedColumn* out) const = 0;
+
+ protected:
+  Quoter quoter_;
+};
+
+class NullFormatter : public ColumnFormatter {
+ public:
+  using ColumnFormatter::ColumnFormatter;
+
+  Status Format(const Array& slice, FormattedColumn* out) const override {
+    out->ends.resize(out->ends.size() + slice.length(),
+                     static_cast<int64_t>(out->data.size()));
+    return Status::OK();
+  }
+};
+
+// Numbers, booleans and temporal values, formatted with util/formatting.h
+template <typename T>
+class PrimitiveFormatter : public ColumnFormatter {
+ public:
+  using ColumnFormatter::ColumnFormatter;
+
+  Status Format(const Array& slice, FormattedColumn* out) const override {
+    internal::StringFormatter<T> formatter(slice.type());
+    auto append = [&](util::string_view formatted) {
+      quoter_.AppendMaybeQuoted(formatted, &out->data);
+    };
+    VisitArrayDataInline<T>(
+        *slice.data(),
+        [&](typename internal::StringFormatter<T>::value_type value) {
+          formatter(value, append);
+          out->EndValue();
+        },
+        [&]() { out->EndValue(); });
+    return Status::OK();
+  }
+};
+
+// String and binary values, which are always quoted
+template <typename T>
+class BinaryFormatter : public ColumnFormatter {
+ public:
+  using ColumnFormatter::ColumnFormatter;
+
+  Status Format(const Array& slice, FormattedColumn* out) const override {
+    VisitArrayDataInline<T>(
+        *slice.data(),
+        [&](util::string_view value) {
+          quoter_.AppendQuoted(value, &out->data);
+          out->EndValue();
+        },
+        [&]() { out->EndValue(); });
+    return Status::OK();
+  }
+};
+
+template <typename T>
+class DecimalFormatter : public ColumnFormatter {
+ public:
+  using ColumnFormatter::ColumnFormatter;
+
+  Status Format(const Array& slice, FormattedColumn* out) const override {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    const auto& array = checked_cast<const ArrayType&>(slice);
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (array.IsValid(i)) {
+        out->data += array.FormatValue(i);
+      }
+      out->EndValue();
+    }
+    return Status::OK();
+  }
+};
+
+// Dictionary values are formatted once per record batch, then copied for
+// each index
+class DictionaryFormatter : public ColumnFormatter {
+ public:
+  DictionaryFormatter(const Quoter& quoter,
+                      std::unique_ptr<ColumnFormatter> value_formatter)
+      : ColumnFormatter(quoter), value_formatter_(std::move(value_formatter)) {}
+
+  Status Prepare(const Array& column) override {
+    const auto& dictionary = *checked_cast<const DictionaryArray&>(column).dictionary();
+    if (dictionary.data() == dictionary_data_) {
+      return Status::OK();
+    }
+    formatted_dictionary_ = FormattedColumn();
+    RETURN_NOT_OK(value_formatter_->Prepare(dictionary));
+    RETURN_NOT_OK(value_formatter_->Format(dictionary, &formatted_dictionary_));
+    dictionary_data_ = dictionary.data();
+    return Status::OK();
+  }
+
+  Status Format(const Array& slice, FormattedColumn* out) const override {
+    const auto& array = checked_cast<const DictionaryArray&>(slice);
+    const auto& ends = formatted_dictionary_.ends;
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (array.IsValid(i)) {
+        const int64_t index = array.GetValueIndex(i);
+        if (index < 0 || index >= static_cast<int64_t>(ends.size())) {
+          return Status::IndexError("Dictionary index out of bounds: ", index);
+        }
+        const int64_t begin = index == 0 ? 0 : ends[index - 1];
+        out->data.append(formatted_dictionary_.data, begin, ends[index] - begin);
+      }
+      out->EndValue();
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::unique_ptr<ColumnFormatter> value_formatter_;
+  // The dictionary formatted_dictionary_ was computed from
+  std::shared_ptr<ArrayData> dictionary_data_;
+  FormattedColumn formatted_dictionary_;
+};
+
+struct ColumnFormatterFactory {
+  const Quoter& quoter;
+  std::unique_ptr<ColumnFormatter> out;
+
+  Status Visit(const NullType&) {
+    out.reset(new NullFormatter(quoter));
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_t<internal::is_formattable<T>::value, Status> Visit(const T&) {
+    out.reset(new PrimitiveFormatter<T>(quoter));
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_t<is_base_binary_type<T>::value ||
+                  std::is_same<T, FixedSizeBinaryType>::value,
+              Status>
+  Visit(const T&) {
+    out.reset(new BinaryFormatter<T>(quoter));
+    return Status::OK();
+  }
+
+  Status Visit(const Decimal128Type&) {
+    out.reset(new DecimalFormatter<Decimal128Type>(quoter));
+    return Status::OK();
+  }
+
+  Status Visit(const Decimal256Type&) {
+    out.reset(new DecimalFormatter<Decimal256Type>(quoter));
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType& type) {
+    ColumnFormatterFactory value_factory{quoter, nullptr};
+    RETURN_NOT_OK(VisitTypeInline(*type.value_type(), &value_factory));
+    out.reset(new DictionaryFormatter(quoter, std::move(value_factory.out)));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Unsupported type for CSV writing: ", type);
+  }
+};
+
+Result<std::unique_ptr<ColumnFormatter>> MakeColumnFormatter(const DataType& type,
+                                                             const Quoter& quoter) {
+  ColumnFormatterFactory factory{quoter, nullptr};
+  RETURN_NOT_OK(VisitTypeInline(type, &factory));
+  return std::move(factory.out);
+}
+
+class CSVWriterImpl : public CSVWriter {
+ public:
+  CSVWriterImpl(MemoryPool* pool, io::OutputStream* output,
+                std::shared_ptr<io::OutputStream> owned_output,
+                std::shared_ptr<Schema> schema, const WriteOptions& options)
+      : pool_(pool),
+        output_(output),
+        owned_output_(std::move(owned_output)),
+        schema_(std::move(schema)),
+        options_(options),
+        quoter_(options) {}
+
+  Status Init() {
+    if (options_.batch_size <= 0) {
+      return Status::Invalid("WriteOptions: batch_size must be at least 1: ",
+                             options_.batch_size);
+    }
+    if (options_.delimiter == options_.quote_char || options_.delimiter == '\n' ||
+        options_.delimiter == '\r') {
+      return Status::Invalid("WriteOptions: invalid delimiter");
+    }
+    if (options_.quote_char == '\n' || options_.quote_char == '\r') {
+      return Status::Invalid("WriteOptions: invalid quote_char");
+    }
+    for (const auto& field : schema_->fields()) {
+      ARROW_ASSIGN_OR_RAISE(auto formatter, MakeColumnFormatter(*field->type(), quoter_));
+      formatters_.push_back(std::move(formatter));
+    }
+    if (options_.include_header) {
+      RETURN_NOT_OK(WriteHeader());
+    }
+    return Status::OK();
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    if (!batch.schema()->Equals(*schema_, /*check_metadata=*/false)) {
+      return Status::Invalid("Record batch schema does not match the CSV writer schema");
+    }
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      RETURN_NOT_OK(formatters_[i]->Prepare(*batch.column(i)));
+    }
+
+    // Format the slices of the batch in a bounded window, writing them in order
+    // as they complete
+    const size_t max_pending =
+        options_.use_threads
+            ? static_cast<size_t>(std::max(GetCpuThreadPool()->GetCapacity(), 1)) * 2
+            : 1;
+    std::deque<Future<std::shared_ptr<Buffer>>> pending;
+    Status status;
+    for (int64_t offset = 0; offset < batch.num_rows() && status.ok();
+         offset += options_.batch_size) {
+      if (pending.size() >= max_pending) {
+        status = WriteNextSlice(&pending);
+        if (!status.ok()) break;
+      }
+      auto slice = batch.Slice(offset, options_.batch_size);
+      auto format_slice = [this, slice]() { return FormatSlice(*slice); };
+      if (options_.use_threads) {
+        auto maybe_future = GetCpuThreadPool()->Submit(std::move(format_slice));
+        if (!maybe_future.ok()) {
+          status = maybe_future.status();
+          break;
+        }
+        pending.push_back(maybe_future.MoveValueUnsafe());
+      } else {
+        pending.push_back(Future<std::shared_ptr<Buffer>>::MakeFinished(format_slice()));
+      }
+    }
+    // Even on error, wait for the pending slices as they refer to this writer
+    while (!pending.empty()) {
+      status &= WriteNextSlice(&pending);
+    }
+    return status;
+  }
+
+  Status WriteTable(const Table& table) override {
+    TableBatchReader reader(table);
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (batch == nullptr) {
+        return Status::OK();
+      }
+      RETURN_NOT_OK(WriteRecordBatch(*batch));
+    }
+  }
+
+ private:
+  Status WriteHeader() {
+    std::string header;
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      if (i > 0) {
+        header.push_back(options_.delimiter);
+      }
+      quoter_.AppendQuoted(schema_->field(i)->name(), &header);
+    }
+    header.push_back('\n');
+    return output_->Write(header.data(), static_cast<int64_t>(header.size()));
+  }
+
+  // Wait for the first pending slice to be formatted and write it
+  Status WriteNextSlice(std::deque<Future<std::shared_ptr<Buffer>>>* pending) {
+    auto maybe_buffer = pending->front().result();
+    pending->pop_front();
+    ARROW_ASSIGN_OR_RAISE(auto buffer, maybe_buffer);
+    return output_->Write(buffer);
+  }
+
+  // Format the rows of a record batch, column after column, then interleave
+  // the formatted values of each row
+  Result<std::shared_ptr<Buffer>> FormatSlice(const RecordBatch& slice) const {
+    const int num_columns = slice.num_columns();
+    const int64_t num_rows = slice.num_rows();
+    std::vector<FormattedColumn> columns(num_columns);
+    int64_t size = num_rows * num_columns;
+    for (int i = 0; i < num_columns; ++i) {
+      columns[i].ends.reserve(num_rows);
+      RETURN_NOT_OK(formatters_[i]->Format(*slice.column(i), &columns[i]));
+      DCHECK_EQ(static_cast<int64_t>(columns[i].ends.size()), num_rows);
+      size += static_cast<int64_t>(columns[i].data.size());
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(size, pool_));
+    char* cursor = reinterpret_cast<char*>(buffer->mutable_data());
+    for (int64_t row = 0; row < num_rows; ++row) {
+      for (int i = 0; i < num_columns; ++i) {
+        const FormattedColumn& column = columns[i];
+        const int64_t begin = row == 0 ? 0 : column.ends[row - 1];
+        const int64_t length = column.ends[row] - begin;
+        std::memcpy(cursor, column.data.data() + begin, static_cast<size_t>(length));
+        cursor += length;
+        *cursor++ = i + 1 == num_columns ? '\n' : options_.delimiter;
+      }
+    }
+    DCHECK_EQ(cursor, reinterpret_cast<char*>(buffer->mutable_data()) + size);
+    return std::move(buffer);
+  }
+
+  MemoryPool* pool_;
+  io::OutputStream* output_;
+  // The output stream, if owned by the writer
+  std::shared_ptr<io::OutputStream> owned_output_;
+  std::shared_ptr<Schema> schema_;
+  WriteOptions options_;
+  Quoter quoter_;
+  std::vector<std::unique_ptr<ColumnFormatter>> formatters_;
+};
+
+Result<std::unique_ptr<CSVWriterImpl>> MakeWriterImpl(
+    MemoryPool* pool, io::OutputStream* output,
+    std::shared_ptr<io::OutputStream> owned_output, std::shared_ptr<Schema> schema,
+    const WriteOptions& options) {
+  std::unique_ptr<CSVWriterImpl> writer(new CSVWriterImpl(
+      pool, output, std::move(owned_output), std::move(schema), options));
+  RETURN_NOT_OK(writer->Init());
+  return std::move(writer);
+}
+
+}  // namespace
+
+Result<std::shared_ptr<CSVWriter>> CSVWriter::Make(
+    MemoryPool* pool, std::shared_ptr<io::OutputStream> output,
+    std::shared_ptr<Schema> schema, const WriteOptions& options) {
+  io::OutputStream* raw_output = output.get();
+  ARROW_ASSIGN_OR_RAISE(auto writer, MakeWriterImpl(pool, raw_output, std::move(output),
+                                                    std::move(schema), options));
+  return std::shared_ptr<CSVWriter>(std::move(writer));
+}
+
+Status WriteCSV(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        MakeWriterImpl(pool, output, nullptr, table.schema(), options));
+  return writer->WriteTable(table);
+}
+
+Status WriteCSV(const RecordBatch& batch, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        MakeWriterImpl(pool, output, nullptr, batch.schema(), options));
+  return writer->WriteRecordBatch(batch);
+}
+
+}  // namespace csv
+}  // namespace arrow
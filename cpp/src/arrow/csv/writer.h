@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+class OutputStream;
+}  // namespace io
+
+namespace csv {
+
+/// \brief Write record batches to an output stream as CSV
+///
+/// Record batches are formatted column by column, in slices of
+/// WriteOptions::batch_size rows. If WriteOptions::use_threads is true, the
+/// slices are formatted in parallel on the CPU thread pool; they are always
+/// written in order.
+///
+/// Null values are written as empty fields. Nested types are not supported.
+class ARROW_EXPORT CSVWriter {
+ public:
+  virtual ~CSVWriter() = default;
+
+  /// Write a record batch, whose schema must be the one of the writer
+  virtual Status WriteRecordBatch(const RecordBatch& batch) = 0;
+
+  /// Write all the record batches of a table, whose schema must be the one
+  /// of the writer
+  virtual Status WriteTable(const Table& table) = 0;
+
+  /// Create a CSVWriter instance, writing the header line if
+  /// WriteOptions::include_header is true
+  static Result<std::shared_ptr<CSVWriter>> Make(MemoryPool* pool,
+                                                 std::shared_ptr<io::OutputStream> output,
+                                                 std::shared_ptr<Schema> schema,
+                                                 const WriteOptions&);
+};
+
+/// \brief Write a table to an output stream as CSV
+ARROW_EXPORT
+Status WriteCSV(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output);
+
+/// \brief Write a record batch to an output stream as CSV
+ARROW_EXPORT
+Status WriteCSV(const RecordBatch& batch, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output);
+
+}  // namespace csv
+}  // namespace arrow
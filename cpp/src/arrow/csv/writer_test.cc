@@ -0,0 +1,188 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/csv/writer.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace csv {
+
+Result<std::string> WriteToString(const RecordBatch& batch,
+                                  const WriteOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create());
+  RETURN_NOT_OK(WriteCSV(batch, options, default_memory_pool(), sink.get()));
+  ARROW_ASSIGN_OR_RAISE(auto buffer, sink->Finish());
+  return buffer->ToString();
+}
+
+TEST(CSVWriter, Basics) {
+  auto schema = arrow::schema({field("int", int32()), field("float", float64()),
+                               field("bool", boolean()), field("str", utf8()),
+                               field("date", date32()), field("null", null())});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    [1, 1.5, true, "a", 0, null],
+    [null, -2.0, false, "", 18262, null],
+    [-3, null, null, null, null, null]
+  ])");
+
+  auto options = WriteOptions::Defaults();
+  ASSERT_OK_AND_ASSIGN(auto csv, WriteToString(*batch, options));
+  ASSERT_EQ(csv,
+            "\"int\",\"float\",\"bool\",\"str\",\"date\",\"null\"\n"
+            "1,1.5,true,\"a\",1970-01-01,\n"
+            ",-2,false,\"\",2020-01-01,\n"
+            "-3,,,,,\n");
+
+  options.include_header = false;
+  options.delimiter = ';';
+  ASSERT_OK_AND_ASSIGN(csv, WriteToString(*batch, options));
+  ASSERT_EQ(csv,
+            "1;1.5;true;\"a\";1970-01-01;\n"
+            ";-2;false;\"\";2020-01-01;\n"
+            "-3;;;;;\n");
+}
+
+TEST(CSVWriter, Quoting) {
+  auto schema = arrow::schema({field("a \"quoted\" name", utf8()),
+                               field("ts", timestamp(TimeUnit::SECOND))});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    ["with, comma", 0],
+    ["with \"quotes\"", 1],
+    ["with\nnewline", 2]
+  ])");
+
+  auto options = WriteOptions::Defaults();
+  ASSERT_OK_AND_ASSIGN(auto csv, WriteToString(*batch, options));
+  ASSERT_EQ(csv,
+            "\"a \"\"quoted\"\" name\",\"ts\"\n"
+            "\"with, comma\",1970-01-01 00:00:00\n"
+            "\"with \"\"quotes\"\"\",1970-01-01 00:00:01\n"
+            "\"with\nnewline\",1970-01-01 00:00:02\n");
+
+  // Values of other types are quoted if they contain the delimiter
+  options.include_header = false;
+  options.delimiter = ' ';
+  ASSERT_OK_AND_ASSIGN(csv, WriteToString(*batch->Slice(0, 1), options));
+  ASSERT_EQ(csv, "\"with, comma\" \"1970-01-01 00:00:00\"\n");
+}
+
+TEST(CSVWriter, Dictionary) {
+  auto type = dictionary(int8(), utf8());
+  auto dict = ArrayFromJSON(utf8(), R"(["foo", "bar"])");
+  auto indices = ArrayFromJSON(int8(), "[1, null, 0, 1]");
+  ASSERT_OK_AND_ASSIGN(auto column, DictionaryArray::FromArrays(type, indices, dict));
+  auto batch = RecordBatch::Make(schema({field("dict", type)}), 4, {column});
+
+  ASSERT_OK_AND_ASSIGN(auto csv, WriteToString(*batch, WriteOptions::Defaults()));
+  ASSERT_EQ(csv, "\"dict\"\n\"bar\"\n\n\"foo\"\n\"bar\"\n");
+}
+
+TEST(CSVWriter, InvalidInput) {
+  auto options = WriteOptions::Defaults();
+  auto batch = RecordBatchFromJSON(schema({field("list", list(int32()))}), "[[[1]]]");
+  ASSERT_RAISES(NotImplemented, WriteToString(*batch, options));
+
+  batch = RecordBatchFromJSON(schema({field("int", int32())}), "[[1]]");
+  options.batch_size = 0;
+  ASSERT_RAISES(Invalid, WriteToString(*batch, options));
+  options = WriteOptions::Defaults();
+  options.delimiter = '"';
+  ASSERT_RAISES(Invalid, WriteToString(*batch, options));
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       CSVWriter::Make(default_memory_pool(), sink, batch->schema(),
+                                       WriteOptions::Defaults()));
+  auto other_batch = RecordBatchFromJSON(schema({field("str", utf8())}), "[[\"a\"]]");
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*other_batch));
+}
+
+class TestCSVWriterRoundtrip : public ::testing::TestWithParam<bool> {};
+
+TEST_P(TestCSVWriterRoundtrip, Table) {
+  const bool use_threads = GetParam();
+  const int old_capacity = GetCpuThreadPoolCapacity();
+  ASSERT_OK(SetCpuThreadPoolCapacity(4));
+
+  auto schema = arrow::schema({field("i", int64()), field("d", float64()),
+                               field("s", utf8()), field("b", boolean())});
+  random::RandomArrayGenerator rng(42);
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int64_t length : {1000, 0, 2500}) {
+    batches.push_back(RecordBatch::Make(
+        schema, length,
+        {rng.Int64(length, -1000000, 1000000, /*null_probability=*/0.1),
+         rng.Float64(length, -1e10, 1e10, /*null_probability=*/0.1),
+         rng.String(length, 0, 20, /*null_probability=*/0),
+         rng.Boolean(length, 0.5, /*null_probability=*/0.1)}));
+  }
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(batches));
+
+  auto write_options = WriteOptions::Defaults();
+  write_options.batch_size = 100;
+  write_options.use_threads = use_threads;
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, CSVWriter::Make(default_memory_pool(), sink, schema,
+                                                    write_options));
+  ASSERT_OK(writer->WriteTable(*table));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  // The output doesn't depend on threading nor on the slicing of the input
+  std::string expected;
+  write_options.use_threads = false;
+  write_options.batch_size = 1 << 20;
+  ASSERT_OK_AND_ASSIGN(auto combined, table->CombineChunks());
+  ASSERT_OK_AND_ASSIGN(auto combined_batch, TableBatchReader(*combined).Next());
+  ASSERT_OK_AND_ASSIGN(expected, WriteToString(*combined_batch, write_options));
+  ASSERT_EQ(buffer->ToString(), expected);
+
+  auto read_options = ReadOptions::Defaults();
+  auto convert_options = ConvertOptions::Defaults();
+  for (const auto& field : schema->fields()) {
+    convert_options.column_types[field->name()] = field->type();
+  }
+  ASSERT_OK_AND_ASSIGN(
+      auto reader,
+      TableReader::Make(default_memory_pool(), std::make_shared<io::BufferReader>(buffer),
+                        read_options, ParseOptions::Defaults(), convert_options));
+  ASSERT_OK_AND_ASSIGN(auto read_table, reader->Read());
+  AssertTablesEqual(*table, *read_table, /*same_chunk_layout=*/false);
+
+  ASSERT_OK(SetCpuThreadPoolCapacity(old_capacity));
+}
+
+INSTANTIATE_TEST_SUITE_P(CSVWriter, TestCSVWriterRoundtrip,
+                         ::testing::Values(false, true));
+
+}  // namespace csv
+}  // namespace arrow
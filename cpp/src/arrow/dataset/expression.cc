@@ -17,6 +17,8 @@
 
 #include "arrow/dataset/expression.h"
 
+#include <algorithm>
+#include <cstring>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -27,6 +29,9 @@
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/util/atomic_shared_ptr.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_generate.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/optional.h"
@@ -627,6 +632,377 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const Datum& input
 
 namespace {
 
+// A filter is evaluated as a tree of connectives whose leaves are either comparisons
+// of numeric arrays or boolean Datums computed by ExecuteScalarExpression. Instead of
+// tracking Kleene truth values, evaluation of a node asks for the rows where it is
+// known to be true (or known to be false); null rows belong to neither, so the rows
+// known to be true at the root are exactly the rows selected by the filter.
+
+constexpr int64_t kFilterBlockSize = 1024;
+
+struct FusedFilterNode;
+
+// Write the bits of rows [offset, offset + length) for which the values of a
+// comparison's operands compare `want`, ignoring nulls
+using FusedComparison = void (*)(const FusedFilterNode&, bool want, int64_t offset,
+                                 int64_t length, uint8_t* out);
+
+struct FusedFilterNode {
+  enum Kind { AND, OR, NOT, COMPARISON, BOOLEAN };
+
+  Kind kind;
+  std::vector<FusedFilterNode> children;
+  // The operands of a COMPARISON (left is always an array) or the value of a BOOLEAN
+  Datum left, right;
+  FusedComparison compare = NULLPTR;
+};
+
+struct CompareEqual {
+  template <typename T>
+  static bool Call(T l, T r) {
+    return l == r;
+  }
+};
+
+struct CompareNotEqual {
+  template <typename T>
+  static bool Call(T l, T r) {
+    return l != r;
+  }
+};
+
+struct CompareLess {
+  template <typename T>
+  static bool Call(T l, T r) {
+    return l < r;
+  }
+};
+
+struct CompareLessEqual {
+  template <typename T>
+  static bool Call(T l, T r) {
+    return l <= r;
+  }
+};
+
+struct CompareGreater {
+  template <typename T>
+  static bool Call(T l, T r) {
+    return l > r;
+  }
+};
+
+struct CompareGreaterEqual {
+  template <typename T>
+  static bool Call(T l, T r) {
+    return l >= r;
+  }
+};
+
+template <typename CType>
+struct ArrayOperand {
+  ArrayOperand(const Datum& datum, int64_t offset)
+      : values(datum.array()->GetValues<CType>(1) + offset) {}
+
+  CType Next() { return *values++; }
+
+  const CType* values;
+};
+
+template <typename CType>
+struct ScalarOperand {
+  ScalarOperand(const Datum& datum, int64_t)
+      : value(*reinterpret_cast<const CType*>(
+            checked_cast<const internal::PrimitiveScalarBase&>(*datum.scalar())
+                .data())) {}
+
+  CType Next() { return value; }
+
+  CType value;
+};
+
+template <typename Op, typename CType, template <typename> class RightOperand>
+void CompareBlock(const FusedFilterNode& node, bool want, int64_t offset,
+                  int64_t length, uint8_t* out) {
+  ArrayOperand<CType> left(node.left, offset);
+  RightOperand<CType> right(node.right, offset);
+  // Negate the comparison rather than using its complement, which differs for NaN
+  if (want) {
+    internal::GenerateBitsUnrolled(
+        out, 0, length, [&] { return Op::Call(left.Next(), right.Next()); });
+  } else {
+    internal::GenerateBitsUnrolled(
+        out, 0, length, [&] { return !Op::Call(left.Next(), right.Next()); });
+  }
+}
+
+template <typename CType, template <typename> class RightOperand>
+FusedComparison GetFusedComparison(Comparison::type op) {
+  switch (op) {
+    case Comparison::EQUAL:
+      return CompareBlock<CompareEqual, CType, RightOperand>;
+    case Comparison::NOT_EQUAL:
+      return CompareBlock<CompareNotEqual, CType, RightOperand>;
+    case Comparison::LESS:
+      return CompareBlock<CompareLess, CType, RightOperand>;
+    case Comparison::LESS_EQUAL:
+      return CompareBlock<CompareLessEqual, CType, RightOperand>;
+    case Comparison::GREATER:
+      return CompareBlock<CompareGreater, CType, RightOperand>;
+    case Comparison::GREATER_EQUAL:
+      return CompareBlock<CompareGreaterEqual, CType, RightOperand>;
+    case Comparison::NA:
+      break;
+  }
+  return NULLPTR;
+}
+
+// Returns null if values of the given type cannot be compared by a fused comparison
+template <template <typename> class RightOperand>
+FusedComparison GetFusedComparison(Comparison::type op, const DataType& type) {
+  switch (type.id()) {
+    case Type::INT8:
+      return GetFusedComparison<int8_t, RightOperand>(op);
+    case Type::INT16:
+      return GetFusedComparison<int16_t, RightOperand>(op);
+    case Type::INT32:
+    case Type::DATE32:
+    case Type::TIME32:
+      return GetFusedComparison<int32_t, RightOperand>(op);
+    case Type::INT64:
+    case Type::DATE64:
+    case Type::TIME64:
+    case Type::TIMESTAMP:
+    case Type::DURATION:
+      return GetFusedComparison<int64_t, RightOperand>(op);
+    case Type::UINT8:
+      return GetFusedComparison<uint8_t, RightOperand>(op);
+    case Type::UINT16:
+      return GetFusedComparison<uint16_t, RightOperand>(op);
+    case Type::UINT32:
+      return GetFusedComparison<uint32_t, RightOperand>(op);
+    case Type::UINT64:
+      return GetFusedComparison<uint64_t, RightOperand>(op);
+    case Type::FLOAT:
+      return GetFusedComparison<float, RightOperand>(op);
+    case Type::DOUBLE:
+      return GetFusedComparison<double, RightOperand>(op);
+    default:
+      break;
+  }
+  return NULLPTR;
+}
+
+Result<FusedFilterNode> FuseFilter(const Expression& expr, const Datum& input,
+                                   compute::ExecContext* exec_context) {
+  FusedFilterNode node;
+
+  if (auto call = expr.call()) {
+    if (call->function_name == "and_kleene" || call->function_name == "or_kleene") {
+      node.kind = call->function_name == "and_kleene" ? FusedFilterNode::AND
+                                                       : FusedFilterNode::OR;
+      for (const auto& argument : call->arguments) {
+        ARROW_ASSIGN_OR_RAISE(auto child, FuseFilter(argument, input, exec_context));
+        if (child.kind != node.kind) {
+          node.children.push_back(std::move(child));
+          continue;
+        }
+        // flatten nested connectives so that any term can short circuit the rest
+        for (auto& grandchild : child.children) {
+          node.children.push_back(std::move(grandchild));
+        }
+      }
+      return node;
+    }
+
+    if (call->function_name == "invert") {
+      node.kind = FusedFilterNode::NOT;
+      ARROW_ASSIGN_OR_RAISE(auto child,
+                            FuseFilter(call->arguments[0], input, exec_context));
+      node.children.push_back(std::move(child));
+      return node;
+    }
+
+    auto cmp = Comparison::Get(call->function_name);
+    auto type = cmp ? call->arguments[0].descr().type : NULLPTR;
+    if (cmp && type->Equals(*call->arguments[1].descr().type) &&
+        GetFusedComparison<ArrayOperand>(*cmp, *type) != NULLPTR) {
+      auto op = *cmp;
+      ARROW_ASSIGN_OR_RAISE(node.left,
+                            ExecuteScalarExpression(call->arguments[0], input,
+                                                    exec_context));
+      ARROW_ASSIGN_OR_RAISE(node.right,
+                            ExecuteScalarExpression(call->arguments[1], input,
+                                                    exec_context));
+      if (node.left.is_scalar() && node.right.is_array()) {
+        std::swap(node.left, node.right);
+        op = Comparison::GetFlipped(op);
+      }
+
+      if (node.left.is_array() && node.right.is_array()) {
+        node.kind = FusedFilterNode::COMPARISON;
+        node.compare = GetFusedComparison<ArrayOperand>(op, *type);
+        return node;
+      }
+
+      if (node.left.is_array() && node.right.is_scalar()) {
+        if (!node.right.scalar()->is_valid) {
+          // comparison with null is null everywhere
+          node.kind = FusedFilterNode::BOOLEAN;
+          node.left = MakeNullScalar(boolean());
+          node.right = Datum{};
+          return node;
+        }
+        node.kind = FusedFilterNode::COMPARISON;
+        node.compare = GetFusedComparison<ScalarOperand>(op, *type);
+        return node;
+      }
+    }
+  }
+
+  node.kind = FusedFilterNode::BOOLEAN;
+  ARROW_ASSIGN_OR_RAISE(node.left, ExecuteScalarExpression(expr, input, exec_context));
+  node.right = Datum{};
+  if (!node.left.is_array() && !node.left.is_scalar()) {
+    return Status::NotImplemented("Fused evaluation of filter ", expr.ToString(),
+                                  " producing ", node.left.ToString());
+  }
+  return node;
+}
+
+// The length of the arrays referenced by a fused filter, or -1 if it references none
+int64_t FusedFilterLength(const FusedFilterNode& node) {
+  if (node.left.is_array()) return node.left.length();
+  for (const auto& child : node.children) {
+    auto length = FusedFilterLength(child);
+    if (length != -1) return length;
+  }
+  return -1;
+}
+
+void AndValidity(const Datum& operand, int64_t offset, int64_t length, uint8_t* out) {
+  if (!operand.is_array()) return;
+
+  const ArrayData& data = *operand.array();
+  if (!data.MayHaveNulls()) return;
+  internal::BitmapAnd(out, 0, data.buffers[0]->data(), data.offset + offset, length, 0,
+                      out);
+}
+
+// Write the bits of rows [offset, offset + length) for which node is known to be
+// `want` to out
+void EvaluateFusedFilter(const FusedFilterNode& node, bool want, int64_t offset,
+                         int64_t length, uint8_t* out) {
+  switch (node.kind) {
+    case FusedFilterNode::NOT:
+      return EvaluateFusedFilter(node.children[0], !want, offset, length, out);
+
+    case FusedFilterNode::AND:
+    case FusedFilterNode::OR: {
+      // A conjunction is known true where all of its terms are and known false where
+      // any of them is; dually for a disjunction.
+      bool intersect = (node.kind == FusedFilterNode::AND) == want;
+
+      EvaluateFusedFilter(node.children[0], want, offset, length, out);
+
+      uint64_t term_words[kFilterBlockSize / 64];
+      auto term = reinterpret_cast<uint8_t*>(term_words);
+      for (size_t i = 1; i < node.children.size(); ++i) {
+        auto set_count = internal::CountSetBits(out, 0, length);
+        if (set_count == (intersect ? 0 : length)) {
+          // the block is decided, skip the remaining terms
+          return;
+        }
+
+        EvaluateFusedFilter(node.children[i], want, offset, length, term);
+        if (intersect) {
+          internal::BitmapAnd(out, 0, term, 0, length, 0, out);
+        } else {
+          internal::BitmapOr(out, 0, term, 0, length, 0, out);
+        }
+      }
+      return;
+    }
+
+    case FusedFilterNode::COMPARISON:
+      node.compare(node, want, offset, length, out);
+      AndValidity(node.left, offset, length, out);
+      AndValidity(node.right, offset, length, out);
+      return;
+
+    case FusedFilterNode::BOOLEAN: {
+      if (node.left.is_scalar()) {
+        const auto& scalar = node.left.scalar_as<BooleanScalar>();
+        bool set = scalar.is_valid && scalar.value == want;
+        std::memset(out, set ? 0xFF : 0, BitUtil::BytesForBits(length));
+        return;
+      }
+
+      const ArrayData& values = *node.left.array();
+      if (want) {
+        internal::CopyBitmap(values.buffers[1]->data(), values.offset + offset, length,
+                             out, 0);
+      } else {
+        internal::InvertBitmap(values.buffers[1]->data(), values.offset + offset,
+                               length, out, 0);
+      }
+      AndValidity(node.left, offset, length, out);
+      return;
+    }
+  }
+}
+
+}  // namespace
+
+Result<Datum> ExecuteFilterExpression(const Expression& expr, const Datum& input,
+                                      compute::ExecContext* exec_context) {
+  if (exec_context == nullptr) {
+    compute::ExecContext exec_context;
+    return ExecuteFilterExpression(expr, input, &exec_context);
+  }
+
+  if (!expr.IsBound()) {
+    return Status::Invalid("Cannot Execute unbound expression.");
+  }
+
+  if (!expr.IsScalarExpression()) {
+    return Status::Invalid(
+        "ExecuteFilterExpression cannot Execute non-scalar expression ",
+        expr.ToString());
+  }
+
+  if (expr.descr().type->id() != Type::BOOL) {
+    return Status::TypeError("Filter expression must evaluate to bool, not ",
+                             *expr.descr().type);
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto root, FuseFilter(expr, input, exec_context));
+
+  auto length = FusedFilterLength(root);
+  if (length == -1) {
+    uint8_t selected = 0;
+    EvaluateFusedFilter(root, /*want=*/true, 0, 1, &selected);
+    return Datum(BitUtil::GetBit(&selected, 0));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto bitmap,
+                        AllocateBitmap(length, exec_context->memory_pool()));
+  if (length > 0) {
+    // zero the padding of the last byte
+    bitmap->mutable_data()[BitUtil::BytesForBits(length) - 1] = 0;
+  }
+
+  // blocks begin on byte boundaries, so each is evaluated directly into the bitmap
+  for (int64_t offset = 0; offset < length; offset += kFilterBlockSize) {
+    EvaluateFusedFilter(root, /*want=*/true, offset,
+                        std::min(kFilterBlockSize, length - offset),
+                        bitmap->mutable_data() + offset / 8);
+  }
+  return Datum(std::make_shared<BooleanArray>(length, std::move(bitmap)));
+}
+
+namespace {
+
 std::array<std::pair<const Expression&, const Expression&>, 2>
 ArgumentsAndFlippedArguments(const Expression::Call& call) {
   DCHECK_EQ(call.arguments.size(), 2);
@@ -210,6 +210,23 @@ ARROW_DS_EXPORT
 Result<Datum> ExecuteScalarExpression(const Expression&, const Datum& input,
                                       compute::ExecContext* = NULLPTR);
 
+/// Execute a boolean filter expression against the provided input Datum, producing a
+/// selection mask which is true where the filter is true and false where it is false
+/// or null. This expression must be bound.
+///
+/// Comparisons of numeric or temporal values and the and_/or_/not_ connectives
+/// combining them are evaluated together in a single pass over blocks of rows, writing
+/// straight into the selection bitmap without materializing intermediate boolean
+/// arrays. Once a block is decided (all false under an and_, all true under an or_)
+/// the remaining terms of that connective are skipped for the block. Other
+/// subexpressions are evaluated with ExecuteScalarExpression.
+///
+/// The mask is a BooleanArray with no nulls, or a BooleanScalar if the filter is known
+/// to have the same value for every row (for example a comparison with null).
+ARROW_DS_EXPORT
+Result<Datum> ExecuteFilterExpression(const Expression&, const Datum& input,
+                                      compute::ExecContext* = NULLPTR);
+
 // Serialization
 
 ARROW_DS_EXPORT
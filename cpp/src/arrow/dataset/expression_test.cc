@@ -30,6 +30,7 @@
 #include "arrow/dataset/expression_internal.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 
 using testing::HasSubstr;
 using testing::UnorderedElementsAreArray;
@@ -1026,6 +1027,119 @@ TEST(Expression, Filter) {
   ])");
 }
 
+// ExecuteFilterExpression must select exactly the rows where ExecuteScalarExpression
+// evaluates to true
+void AssertExecuteFilter(Expression filter, const std::shared_ptr<RecordBatch>& batch) {
+  ASSERT_OK_AND_ASSIGN(filter, filter.Bind(*batch->schema()));
+  ASSERT_OK_AND_ASSIGN(Datum mask, ExecuteFilterExpression(filter, batch));
+  ASSERT_OK_AND_ASSIGN(Datum expected, ExecuteScalarExpression(filter, batch));
+
+  if (expected.is_scalar()) {
+    const auto& expected_scalar = expected.scalar_as<BooleanScalar>();
+    AssertDatumsEqual(Datum(expected_scalar.is_valid && expected_scalar.value), mask);
+    return;
+  }
+
+  auto expected_mask = expected.make_array();
+  const auto& expected_values = checked_cast<const BooleanArray&>(*expected_mask);
+  BooleanBuilder builder;
+  for (int64_t i = 0; i < expected_values.length(); ++i) {
+    ASSERT_OK(builder.Append(expected_values.IsValid(i) && expected_values.Value(i)));
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected_selection, builder.Finish());
+
+  if (mask.is_scalar()) {
+    // the filter is the same for every row
+    ASSERT_OK_AND_ASSIGN(auto broadcast,
+                         MakeArrayFromScalar(*mask.scalar(), expected_values.length()));
+    AssertArraysEqual(*expected_selection, *broadcast, /*verbose=*/true);
+    return;
+  }
+  ASSERT_OK(mask.make_array()->ValidateFull());
+  ASSERT_EQ(mask.null_count(), 0);
+  AssertArraysEqual(*expected_selection, *mask.make_array(), /*verbose=*/true);
+}
+
+TEST(Expression, ExecuteFilter) {
+  auto s = schema({field("i32", int32()), field("i32_b", int32()), field("u8", uint8()),
+                   field("f64", float64()), field("bool", boolean()),
+                   field("str", utf8())});
+
+  // several blocks, the last one partial
+  constexpr int64_t kLength = 5000;
+  random::RandomArrayGenerator rng(0x5EED);
+  auto batch = RecordBatch::Make(
+      s, kLength,
+      {rng.Int32(kLength, 0, 100, /*null_probability=*/0.1),
+       rng.Int32(kLength, 0, 100, /*null_probability=*/0.2), rng.UInt8(kLength, 0, 8),
+       rng.Float64(kLength, -1, 1, /*null_probability=*/0.1, /*nan_probability=*/0.1),
+       rng.Boolean(kLength, /*true_probability=*/0.5, /*null_probability=*/0.1),
+       rng.String(kLength, 0, 3, /*null_probability=*/0.1)});
+
+  for (auto filter : {
+           equal(field_ref("i32"), literal(50)),
+           not_equal(field_ref("f64"), literal(0.5)),
+           less(field_ref("i32"), field_ref("i32_b")),
+           less_equal(literal(3), field_ref("i32")),
+           greater(field_ref("u8"), literal(uint8_t(4))),
+           greater_equal(field_ref("f64"), literal(0.0)),
+           equal(field_ref("i32"), literal(MakeNullScalar(int32()))),
+           not_(less(field_ref("f64"), literal(0.0))),
+           and_(greater(field_ref("i32"), literal(10)),
+                less(field_ref("f64"), literal(0.5))),
+           or_(equal(field_ref("u8"), literal(uint8_t(0))), field_ref("bool")),
+           not_(and_(field_ref("bool"), less(field_ref("i32"), literal(50)))),
+           // the first term is false throughout, so the rest are short circuited
+           and_({greater(field_ref("i32"), literal(1000)), field_ref("bool"),
+                 less(field_ref("f64"), literal(0.0))}),
+           or_({less(field_ref("i32"), literal(1000)), field_ref("bool")}),
+           or_(and_(field_ref("bool"), not_(field_ref("bool"))),
+               not_equal(field_ref("i32"), field_ref("i32_b"))),
+           // subexpressions which are not fused
+           equal(field_ref("str"), literal("a")),
+           and_(call("is_valid", {field_ref("str")}),
+                less(field_ref("i32"), literal(50))),
+           greater(call("multiply", {field_ref("f64"), field_ref("f64")}), literal(0.25)),
+           greater(field_ref("i32"), literal(int64_t(20))),
+           // no references to the input
+           literal(true),
+           and_(literal(true), literal(MakeNullScalar(boolean()))),
+       }) {
+    AssertExecuteFilter(filter, batch);
+    AssertExecuteFilter(filter, batch->Slice(1000, 3000));
+    AssertExecuteFilter(filter, batch->Slice(kLength));
+  }
+
+  ASSERT_RAISES(TypeError, ExecuteFilterExpression(
+                               field_ref("i32").Bind(*s).ValueOrDie(), batch));
+  ASSERT_RAISES(Invalid, ExecuteFilterExpression(field_ref("bool"), batch));
+}
+
+TEST(Expression, ExecuteFilterNulls) {
+  auto s = schema({field("a", int32()), field("b", boolean())});
+  auto batch = RecordBatchFromJSON(s, R"([
+      {"a": 1,    "b": true},
+      {"a": null, "b": false},
+      {"a": 3,    "b": null},
+      {"a": null, "b": null}
+  ])");
+
+  auto ExpectSelection = [&](Expression filter, std::string json) {
+    ASSERT_OK_AND_ASSIGN(filter, filter.Bind(*s));
+    ASSERT_OK_AND_ASSIGN(Datum mask, ExecuteFilterExpression(filter, batch));
+    AssertDatumsEqual(ArrayFromJSON(boolean(), json), mask, /*verbose=*/true);
+  };
+
+  // null is neither true nor false, so neither a predicate nor its negation selects it
+  ExpectSelection(greater(field_ref("a"), literal(0)), "[true, false, true, false]");
+  ExpectSelection(not_(greater(field_ref("a"), literal(0))),
+                  "[false, false, false, false]");
+  ExpectSelection(or_(field_ref("b"), greater(field_ref("a"), literal(2))),
+                  "[true, false, true, false]");
+  ExpectSelection(not_(and_(field_ref("b"), greater(field_ref("a"), literal(2)))),
+                  "[true, true, false, false]");
+}
+
 TEST(Expression, SerializationRoundTrips) {
   auto ExpectRoundTrips = [](const Expression& expr) {
     ASSERT_OK_AND_ASSIGN(auto serialized, Serialize(expr));
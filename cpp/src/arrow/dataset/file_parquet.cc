@@ -17,15 +17,22 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/exec.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/io/caching.h"
 #include "arrow/table.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
@@ -34,7 +41,9 @@
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 
@@ -49,17 +58,349 @@ using parquet::arrow::SchemaField;
 using parquet::arrow::SchemaManifest;
 using parquet::arrow::StatisticsAsScalars;
 
+using ParquetReaderFactory =
+    std::function<Result<std::shared_ptr<parquet::arrow::FileReader>>()>;
+
+static util::optional<Expression> StatisticsAsExpression(
+    const SchemaField& schema_field, const parquet::Statistics& statistics);
+
+static void AddColumnIndices(const SchemaField& schema_field,
+                             std::vector<int>* column_projection);
+
+static std::vector<parquet::RowRange> IntersectRowRanges(
+    const std::vector<parquet::RowRange>& left,
+    const std::vector<parquet::RowRange>& right) {
+  std::vector<parquet::RowRange> out;
+  auto l = left.begin(), r = right.begin();
+  while (l != left.end() && r != right.end()) {
+    int64_t begin = std::max(l->offset, r->offset);
+    int64_t end = std::min(l->end(), r->end());
+    if (begin < end) out.push_back({begin, end - begin});
+    // Advance the range which ends first
+    if (l->end() < r->end()) {
+      ++l;
+    } else {
+      ++r;
+    }
+  }
+  return out;
+}
+
+/// \brief Compute the rows of a row group which may satisfy a predicate, given
+/// the per-page statistics of the ColumnIndexes of the fields it references.
+///
+/// Returns nullopt if no page could be excluded.
+static Result<util::optional<std::vector<parquet::RowRange>>> FilterPages(
+    const Expression& predicate, const Schema& physical_schema,
+    const SchemaManifest& manifest, parquet::RowGroupReader* row_group) {
+  const int64_t num_rows = row_group->metadata()->num_rows();
+  std::vector<parquet::RowRange> selected = {{0, num_rows}};
+
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(physical_schema));
+    if (match.empty()) continue;
+
+    // For now, only leaf (primitive) types are supported.
+    const SchemaField& schema_field = manifest.schema_fields[match[0]];
+    if (!schema_field.is_leaf()) continue;
+
+    std::shared_ptr<parquet::ColumnIndex> column_index;
+    std::shared_ptr<parquet::OffsetIndex> offset_index;
+    try {
+      column_index = row_group->GetColumnIndex(schema_field.column_index);
+      offset_index = row_group->GetOffsetIndex(schema_field.column_index);
+    } catch (const ::parquet::ParquetException& e) {
+      return Status::IOError("Could not read parquet page index: ", e.what());
+    }
+    if (column_index == nullptr || offset_index == nullptr ||
+        column_index->num_pages() != offset_index->num_pages()) {
+      continue;
+    }
+
+    std::vector<parquet::RowRange> field_selected;
+    for (int page = 0; page < offset_index->num_pages(); ++page) {
+      int64_t first_row = offset_index->page_locations()[page].first_row_index;
+      int64_t page_num_rows = offset_index->page_num_rows(page, num_rows);
+
+      auto statistics = column_index->page_statistics(page, page_num_rows);
+      if (auto minmax = StatisticsAsExpression(schema_field, *statistics)) {
+        ARROW_ASSIGN_OR_RAISE(auto guarantee, minmax->Bind(physical_schema));
+        ARROW_ASSIGN_OR_RAISE(auto page_predicate,
+                              SimplifyWithGuarantee(predicate, guarantee));
+        if (!page_predicate.IsSatisfiable()) continue;
+      }
+
+      if (!field_selected.empty() && field_selected.back().end() == first_row) {
+        field_selected.back().length += page_num_rows;
+      } else {
+        field_selected.push_back({first_row, page_num_rows});
+      }
+    }
+    selected = IntersectRowRanges(selected, field_selected);
+  }
+
+  if (selected.size() == 1 && selected[0] == parquet::RowRange{0, num_rows}) {
+    return util::nullopt;
+  }
+  return selected;
+}
+
+/// \brief Hash a value as the Bloom filter of a column chunk would, i.e. by the
+/// plain encoding of the value stored in the column.
+///
+/// Returns nullopt for null values and for values whose type is not stored
+/// unchanged in the column.
+static util::optional<uint64_t> BloomFilterHash(const parquet::BloomFilter& filter,
+                                                const parquet::ColumnDescriptor& descr,
+                                                const DataType& field_type,
+                                                const Scalar& value) {
+  if (!value.is_valid || !value.type->Equals(field_type)) return util::nullopt;
+
+  auto IntegerValue = [&](int64_t* out) {
+    const void* data = checked_cast<const internal::PrimitiveScalarBase&>(value).data();
+    switch (value.type->id()) {
+      case Type::INT8:
+        *out = *reinterpret_cast<const int8_t*>(data);
+        return true;
+      case Type::UINT8:
+        *out = *reinterpret_cast<const uint8_t*>(data);
+        return true;
+      case Type::INT16:
+        *out = *reinterpret_cast<const int16_t*>(data);
+        return true;
+      case Type::UINT16:
+        *out = *reinterpret_cast<const uint16_t*>(data);
+        return true;
+      case Type::INT32:
+      case Type::DATE32:
+      case Type::TIME32:
+        *out = *reinterpret_cast<const int32_t*>(data);
+        return true;
+      case Type::UINT32:
+        *out = *reinterpret_cast<const uint32_t*>(data);
+        return true;
+      case Type::INT64:
+      case Type::UINT64:
+      case Type::TIME64:
+      case Type::TIMESTAMP:
+        *out = *reinterpret_cast<const int64_t*>(data);
+        return true;
+      default:
+        return false;
+    }
+  };
+
+  switch (descr.physical_type()) {
+    case parquet::Type::INT32: {
+      int64_t integer;
+      if (!IntegerValue(&integer)) return util::nullopt;
+      // Unsigned values are stored by their bit pattern
+      return filter.Hash(static_cast<int32_t>(integer));
+    }
+    case parquet::Type::INT64: {
+      int64_t integer;
+      if (!IntegerValue(&integer)) return util::nullopt;
+      return filter.Hash(integer);
+    }
+    // Floating point values are hashed by their bit pattern, but -0.0 and 0.0
+    // compare equal: a row group holding either may match a zero
+    case parquet::Type::FLOAT: {
+      if (value.type->id() != Type::FLOAT) return util::nullopt;
+      const float f = checked_cast<const FloatScalar&>(value).value;
+      if (f == 0.0f) return util::nullopt;
+      return filter.Hash(f);
+    }
+    case parquet::Type::DOUBLE: {
+      if (value.type->id() != Type::DOUBLE) return util::nullopt;
+      const double d = checked_cast<const DoubleScalar&>(value).value;
+      if (d == 0.0) return util::nullopt;
+      return filter.Hash(d);
+    }
+    case parquet::Type::BYTE_ARRAY: {
+      if (!is_base_binary_like(value.type->id())) return util::nullopt;
+      const auto& buffer = *checked_cast<const BaseBinaryScalar&>(value).value;
+      parquet::ByteArray byte_array(static_cast<uint32_t>(buffer.size()), buffer.data());
+      return filter.Hash(&byte_array);
+    }
+    case parquet::Type::FIXED_LEN_BYTE_ARRAY: {
+      if (value.type->id() != Type::FIXED_SIZE_BINARY) return util::nullopt;
+      const auto& buffer = *checked_cast<const BaseBinaryScalar&>(value).value;
+      parquet::FLBA flba(buffer.data());
+      return filter.Hash(&flba, static_cast<uint32_t>(buffer.size()));
+    }
+    default:
+      return util::nullopt;
+  }
+}
+
+static void CollectConjunctionMembers(const Expression& expr,
+                                      std::vector<const Expression*>* members) {
+  auto call = expr.call();
+  if (call && call->function_name == "and_kleene") {
+    for (const Expression& argument : call->arguments) {
+      CollectConjunctionMembers(argument, members);
+    }
+  } else {
+    members->push_back(&expr);
+  }
+}
+
+/// \brief Exclude the row groups in which the Bloom filter of a field rules out
+/// all of the values which the predicate requires that field to equal, through
+/// equal() or is_in().
+static Result<std::vector<int>> FilterRowGroupsByBloomFilters(
+    const Expression& predicate, const Schema& physical_schema,
+    const SchemaManifest& manifest, parquet::ParquetFileReader* reader,
+    std::vector<int> row_groups) {
+  struct Lookup {
+    const SchemaField* schema_field;
+    std::vector<std::shared_ptr<Scalar>> values;
+  };
+  std::vector<Lookup> lookups;
+
+  std::vector<const Expression*> members;
+  CollectConjunctionMembers(predicate, &members);
+  for (const Expression* member : members) {
+    auto call = member->call();
+    if (!call) continue;
+
+    const FieldRef* ref = nullptr;
+    Lookup lookup;
+    if (call->function_name == "equal" && call->arguments.size() == 2) {
+      // The literal may be on either side
+      for (int i = 0; i < 2; ++i) {
+        auto lit = call->arguments[1 - i].literal();
+        if (call->arguments[i].field_ref() && lit && lit->is_scalar()) {
+          ref = call->arguments[i].field_ref();
+          lookup.values = {lit->scalar()};
+        }
+      }
+    } else if (call->function_name == "is_in") {
+      const auto& options =
+          checked_cast<const compute::SetLookupOptions&>(*call->options);
+      ref = call->arguments[0].field_ref();
+      if (!options.value_set.is_array()) continue;
+      auto value_set = options.value_set.make_array();
+      for (int64_t i = 0; i < value_set->length(); ++i) {
+        ARROW_ASSIGN_OR_RAISE(auto value, value_set->GetScalar(i));
+        // Nulls which are skipped never match
+        if (value->is_valid || !options.skip_nulls) {
+          lookup.values.push_back(std::move(value));
+        }
+      }
+    }
+    if (ref == nullptr) continue;
+
+    ARROW_ASSIGN_OR_RAISE(auto match, ref->FindOneOrNone(physical_schema));
+    if (match.empty()) continue;
+
+    // For now, only leaf (primitive) types are supported.
+    lookup.schema_field = &manifest.schema_fields[match[0]];
+    if (!lookup.schema_field->is_leaf()) continue;
+    lookups.push_back(std::move(lookup));
+  }
+  if (lookups.empty()) return row_groups;
+
+  std::vector<int> selected;
+  try {
+    for (int row_group : row_groups) {
+      auto row_group_reader = reader->RowGroup(row_group);
+      bool excluded = false;
+      for (const auto& lookup : lookups) {
+        int column_index = lookup.schema_field->column_index;
+        auto bloom_filter = row_group_reader->GetColumnBloomFilter(column_index);
+        if (bloom_filter == nullptr) continue;
+
+        const auto& descr = *reader->metadata()->schema()->Column(column_index);
+        const auto& field_type = *lookup.schema_field->field->type();
+        excluded = std::none_of(
+            lookup.values.begin(), lookup.values.end(),
+            [&](const std::shared_ptr<Scalar>& value) {
+              auto hash = BloomFilterHash(*bloom_filter, descr, field_type, *value);
+              return !hash.has_value() || bloom_filter->FindHash(*hash);
+            });
+        if (excluded) break;
+      }
+      if (!excluded) selected.push_back(row_group);
+    }
+  } catch (const ::parquet::ParquetException& e) {
+    return Status::IOError("Could not read parquet bloom filter: ", e.what());
+  }
+  return selected;
+}
+
+/// \brief Compute the columns to read to evaluate a predicate, ahead of the
+/// other columns.
+///
+/// Returns nullopt if the predicate references no field, or a field which is
+/// not in the file.
+static util::optional<std::vector<int>> PredicateColumnProjection(
+    const Expression& predicate, const Schema& physical_schema,
+    const SchemaManifest& manifest) {
+  std::vector<FieldRef> refs = FieldsInExpression(predicate);
+  if (refs.empty()) return util::nullopt;
+
+  std::vector<int> columns;
+  std::unordered_set<int> fields;
+  for (const FieldRef& ref : refs) {
+    // The predicate is evaluated on a batch of the referenced fields only
+    if (!ref.IsName()) return util::nullopt;
+    auto maybe_match = ref.FindOneOrNone(physical_schema);
+    if (!maybe_match.ok() || maybe_match.ValueUnsafe().empty()) return util::nullopt;
+    int field_index = maybe_match.ValueUnsafe()[0];
+    if (fields.insert(field_index).second) {
+      AddColumnIndices(manifest.schema_fields[field_index], &columns);
+    }
+  }
+  return columns;
+}
+
 /// \brief A ScanTask backed by a parquet file and a RowGroup within a parquet file.
 class ParquetScanTask : public ScanTask {
  public:
   ParquetScanTask(int row_group, std::vector<int> column_projection,
                   std::shared_ptr<parquet::arrow::FileReader> reader,
+                  ParquetReaderFactory open_reader, Expression predicate,
+                  std::shared_ptr<Schema> physical_schema, bool late_materialization,
                   std::shared_ptr<ScanOptions> options,
                   std::shared_ptr<ScanContext> context)
       : ScanTask(std::move(options), std::move(context)),
         row_group_(row_group),
         column_projection_(std::move(column_projection)),
-        reader_(std::move(reader)) {}
+        reader_(std::move(reader)),
+        open_reader_(std::move(open_reader)),
+        predicate_(std::move(predicate)),
+        physical_schema_(std::move(physical_schema)),
+        late_materialization_(late_materialization) {}
+
+  Future<> Prefetch(const io::AsyncContext& io_context) override {
+    // The buffered ranges of a ParquetFileReader are replaced by each PreBuffer(), so
+    // this task buffers its row group with a reader of its own.  Opening it does not
+    // read anything, since it is given the already parsed FileMetaData.
+    auto maybe_reader = open_reader_();
+    if (!maybe_reader.ok()) {
+      return Future<>::MakeFinished(maybe_reader.status());
+    }
+    prefetched_reader_ = maybe_reader.MoveValueUnsafe();
+    auto parquet_reader = prefetched_reader_->parquet_reader();
+    try {
+      parquet_reader->PreBuffer({row_group_}, column_projection_, io_context,
+                                io::CacheOptions::Defaults());
+    } catch (const ::parquet::ParquetException& e) {
+      return Future<>::MakeFinished(
+          Status::IOError("Could not prefetch parquet row group: ", e.what()));
+    }
+    return parquet_reader->WhenBuffered();
+  }
+
+  int64_t EstimatedPrefetchBytes() const override {
+    auto row_group = reader_->parquet_reader()->metadata()->RowGroup(row_group_);
+    int64_t bytes = 0;
+    for (int column : column_projection_) {
+      bytes += row_group->ColumnChunk(column)->total_compressed_size();
+    }
+    return bytes;
+  }
 
   Result<RecordBatchIterator> Execute() override {
     // The construction of parquet's RecordBatchReader is deferred here to
@@ -79,16 +420,76 @@ class ParquetScanTask : public ScanTask {
       std::unique_ptr<RecordBatchReader> record_batch_reader;
     } NextBatch;
 
-    NextBatch.file_reader = reader_;
-    RETURN_NOT_OK(reader_->GetRecordBatchReader({row_group_}, column_projection_,
-                                                &NextBatch.record_batch_reader));
+    // Read from the buffered row group if it was prefetched
+    NextBatch.file_reader =
+        prefetched_reader_ != nullptr ? std::move(prefetched_reader_) : reader_;
+
+    // Only read the pages which may hold rows satisfying the filter; the
+    // filter is still applied to the rows which are read
+    const auto& file_reader = NextBatch.file_reader;
+    auto row_group = file_reader->parquet_reader()->RowGroup(row_group_);
+    ARROW_ASSIGN_OR_RAISE(auto row_ranges,
+                          FilterPages(predicate_, *physical_schema_,
+                                      file_reader->manifest(), row_group.get()));
+
+    if (late_materialization_) {
+      if (auto filter_columns = PredicateColumnProjection(
+              predicate_, *physical_schema_, file_reader->manifest())) {
+        std::vector<parquet::RowRange> selected_ranges = {
+            {0, row_group->metadata()->num_rows()}};
+        if (row_ranges) selected_ranges = std::move(*row_ranges);
+        return ExecuteFiltered(std::move(NextBatch.file_reader), selected_ranges,
+                               *filter_columns);
+      }
+    }
+
+    if (row_ranges) {
+      RETURN_NOT_OK(NextBatch.file_reader->GetRecordBatchReader(
+          row_group_, column_projection_, *row_ranges, &NextBatch.record_batch_reader));
+    } else {
+      RETURN_NOT_OK(NextBatch.file_reader->GetRecordBatchReader(
+          {row_group_}, column_projection_, &NextBatch.record_batch_reader));
+    }
     return MakeFunctionIterator(std::move(NextBatch));
   }
 
  private:
+  // Read the rows of the row group satisfying the predicate, decoding the
+  // columns not referenced by the predicate only at these rows
+  Result<RecordBatchIterator> ExecuteFiltered(
+      std::shared_ptr<parquet::arrow::FileReader> file_reader,
+      const std::vector<parquet::RowRange>& row_ranges,
+      const std::vector<int>& filter_columns) {
+    MemoryPool* pool = context_->pool;
+    const Expression& predicate = predicate_;
+    auto filter = [&](const std::shared_ptr<RecordBatch>& batch)
+        -> Result<std::shared_ptr<Array>> {
+      compute::ExecContext exec_context(pool);
+      ARROW_ASSIGN_OR_RAISE(
+          Datum mask, ExecuteFilterExpression(predicate, Datum(batch), &exec_context));
+      if (mask.is_scalar()) {
+        return MakeArrayFromScalar(*mask.scalar(), batch->num_rows(), pool);
+      }
+      return mask.make_array();
+    };
+
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(file_reader->ReadFilteredRowGroup(
+        row_group_, row_ranges, column_projection_, filter_columns, filter, &table));
+    auto table_reader = std::make_shared<TableBatchReader>(*table);
+    table_reader->set_chunksize(options_->batch_size);
+    // NB: table_reader does not own the table
+    return MakeFunctionIterator([table, table_reader] { return table_reader->Next(); });
+  }
+
   int row_group_;
   std::vector<int> column_projection_;
   std::shared_ptr<parquet::arrow::FileReader> reader_;
+  ParquetReaderFactory open_reader_;
+  std::shared_ptr<parquet::arrow::FileReader> prefetched_reader_;
+  Expression predicate_;
+  std::shared_ptr<Schema> physical_schema_;
+  bool late_materialization_;
 };
 
 static parquet::ReaderProperties MakeReaderProperties(
@@ -124,34 +525,19 @@ static Result<std::shared_ptr<SchemaManifest>> GetSchemaManifest(
   return manifest;
 }
 
-static util::optional<Expression> ColumnChunkStatisticsAsExpression(
-    const SchemaField& schema_field, const parquet::RowGroupMetaData& metadata) {
-  // For the remaining of this function, failure to extract/parse statistics
-  // are ignored by returning nullptr. The goal is two fold. First
-  // avoid an optimization which breaks the computation. Second, allow the
-  // following columns to maybe succeed in extracting column statistics.
-
-  // For now, only leaf (primitive) types are supported.
-  if (!schema_field.is_leaf()) {
-    return util::nullopt;
-  }
-
-  auto column_metadata = metadata.ColumnChunk(schema_field.column_index);
-  auto statistics = column_metadata->statistics();
-  if (statistics == nullptr) {
-    return util::nullopt;
-  }
-
+static util::optional<Expression> StatisticsAsExpression(
+    const SchemaField& schema_field, const parquet::Statistics& statistics) {
   const auto& field = schema_field.field;
   auto field_expr = field_ref(field->name());
 
-  // Optimize for corner case where all values are nulls
-  if (statistics->num_values() == statistics->null_count()) {
+  // Optimize for corner case where all values are nulls. Note num_values()
+  // only counts the non-null values.
+  if (statistics.num_values() == 0 && statistics.null_count() > 0) {
     return equal(std::move(field_expr), literal(MakeNullScalar(field->type())));
   }
 
   std::shared_ptr<Scalar> min, max;
-  if (!StatisticsAsScalars(*statistics, &min, &max).ok()) {
+  if (!StatisticsAsScalars(statistics, &min, &max).ok()) {
     return util::nullopt;
   }
 
@@ -167,6 +553,27 @@ static util::optional<Expression> ColumnChunkStatisticsAsExpression(
   return util::nullopt;
 }
 
+static util::optional<Expression> ColumnChunkStatisticsAsExpression(
+    const SchemaField& schema_field, const parquet::RowGroupMetaData& metadata) {
+  // For the remaining of this function, failure to extract/parse statistics
+  // are ignored by returning nullptr. The goal is two fold. First
+  // avoid an optimization which breaks the computation. Second, allow the
+  // following columns to maybe succeed in extracting column statistics.
+
+  // For now, only leaf (primitive) types are supported.
+  if (!schema_field.is_leaf()) {
+    return util::nullopt;
+  }
+
+  auto column_metadata = metadata.ColumnChunk(schema_field.column_index);
+  auto statistics = column_metadata->statistics();
+  if (statistics == nullptr) {
+    return util::nullopt;
+  }
+
+  return StatisticsAsExpression(schema_field, *statistics);
+}
+
 static void AddColumnIndices(const SchemaField& schema_field,
                              std::vector<int>* column_projection) {
   if (schema_field.is_leaf()) {
@@ -216,7 +623,9 @@ bool ParquetFileFormat::Equals(const FileFormat& other) const {
   // FIXME extract these to scan time options so comparison is unnecessary
   return reader_options.use_buffered_stream == other_reader_options.use_buffered_stream &&
          reader_options.buffer_size == other_reader_options.buffer_size &&
-         reader_options.dict_columns == other_reader_options.dict_columns;
+         reader_options.dict_columns == other_reader_options.dict_columns &&
+         reader_options.enable_late_materialization ==
+             other_reader_options.enable_late_materialization;
 }
 
 ParquetFileFormat::ParquetFileFormat(const parquet::ReaderProperties& reader_properties) {
@@ -252,22 +661,26 @@ Result<std::shared_ptr<Schema>> ParquetFileFormat::Inspect(
   return schema;
 }
 
-Result<std::unique_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader(
-    const FileSource& source, ScanOptions* options, ScanContext* context) const {
+// Open a FileReader on an opened input, parsing its FileMetaData unless given
+static Result<std::unique_ptr<parquet::arrow::FileReader>> OpenReader(
+    const ParquetFileFormat& format, const FileSource& source,
+    std::shared_ptr<io::RandomAccessFile> input, ScanOptions* options,
+    ScanContext* context, std::shared_ptr<parquet::FileMetaData> metadata = nullptr) {
+  const auto& reader_options = format.reader_options;
   MemoryPool* pool = context ? context->pool : default_memory_pool();
-  auto properties = MakeReaderProperties(*this, pool);
+  auto properties = MakeReaderProperties(format, pool);
 
-  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
   std::unique_ptr<parquet::ParquetFileReader> reader;
   try {
-    reader = parquet::ParquetFileReader::Open(std::move(input), std::move(properties));
+    reader = parquet::ParquetFileReader::Open(std::move(input), std::move(properties),
+                                              std::move(metadata));
   } catch (const ::parquet::ParquetException& e) {
     return Status::IOError("Could not open parquet input source '", source.path(),
                            "': ", e.what());
   }
 
-  std::shared_ptr<parquet::FileMetaData> metadata = reader->metadata();
-  auto arrow_properties = MakeArrowReaderProperties(*this, *metadata);
+  metadata = reader->metadata();
+  auto arrow_properties = MakeArrowReaderProperties(format, *metadata);
 
   if (options) {
     arrow_properties.set_batch_size(options->batch_size);
@@ -283,6 +696,12 @@ Result<std::unique_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
   return std::move(arrow_reader);
 }
 
+Result<std::unique_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader(
+    const FileSource& source, ScanOptions* options, ScanContext* context) const {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+  return OpenReader(*this, source, std::move(input), options, context);
+}
+
 Result<ScanTaskIterator> ParquetFileFormat::ScanFile(std::shared_ptr<ScanOptions> options,
                                                      std::shared_ptr<ScanContext> context,
                                                      FileFragment* fragment) const {
@@ -300,12 +719,15 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(std::shared_ptr<ScanOptions
     ARROW_ASSIGN_OR_RAISE(row_groups, parquet_fragment->FilterRowGroups(options->filter));
 
     pre_filtered = true;
-    if (row_groups.empty()) MakeEmpty();
+    if (row_groups.empty()) return MakeEmpty();
   }
 
   // Open the reader and pay the real IO cost.
-  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<parquet::arrow::FileReader> reader,
-                        GetReader(fragment->source(), options.get(), context.get()));
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<io::RandomAccessFile> input,
+                        fragment->source().Open());
+  ARROW_ASSIGN_OR_RAISE(
+      std::shared_ptr<parquet::arrow::FileReader> reader,
+      OpenReader(*this, fragment->source(), input, options.get(), context.get()));
 
   // Ensure that parquet_fragment has FileMetaData
   RETURN_NOT_OK(parquet_fragment->EnsureCompleteMetadata(reader.get()));
@@ -314,15 +736,38 @@ Result<ScanTaskIterator> ParquetFileFormat::ScanFile(std::shared_ptr<ScanOptions
     // row groups were not already filtered; do this now
     ARROW_ASSIGN_OR_RAISE(row_groups, parquet_fragment->FilterRowGroups(options->filter));
 
-    if (row_groups.empty()) MakeEmpty();
+    if (row_groups.empty()) return MakeEmpty();
   }
 
+  // The filter used to prune the row groups by their Bloom filters and the
+  // pages of each row group by their ColumnIndexes
+  ARROW_ASSIGN_OR_RAISE(auto physical_schema, fragment->ReadPhysicalSchema());
+  ARROW_ASSIGN_OR_RAISE(
+      auto predicate,
+      SimplifyWithGuarantee(options->filter, fragment->partition_expression()));
+
+  ARROW_ASSIGN_OR_RAISE(row_groups, FilterRowGroupsByBloomFilters(
+                                        predicate, *physical_schema, reader->manifest(),
+                                        reader->parquet_reader(), std::move(row_groups)));
+  if (row_groups.empty()) return MakeEmpty();
+
   auto column_projection = InferColumnProjection(*reader, *options);
   ScanTaskVector tasks(row_groups.size());
 
+  // Open further readers sharing the input and the parsed FileMetaData
+  auto format = checked_pointer_cast<const ParquetFileFormat>(shared_from_this());
+  auto metadata = reader->parquet_reader()->metadata();
+  auto source = fragment->source();
+  ParquetReaderFactory open_reader =
+      [format, source, input, metadata, options,
+       context]() -> Result<std::shared_ptr<parquet::arrow::FileReader>> {
+    return OpenReader(*format, source, input, options.get(), context.get(), metadata);
+  };
+
   for (size_t i = 0; i < row_groups.size(); ++i) {
-    tasks[i] = std::make_shared<ParquetScanTask>(row_groups[i], column_projection, reader,
-                                                 options, context);
+    tasks[i] = std::make_shared<ParquetScanTask>(
+        row_groups[i], column_projection, reader, open_reader, predicate, physical_schema,
+        reader_options.enable_late_materialization, options, context);
   }
 
   return MakeVectorIterator(std::move(tasks));
@@ -380,8 +825,7 @@ ParquetFileWriter::ParquetFileWriter(std::shared_ptr<parquet::arrow::FileWriter>
       parquet_writer_(std::move(writer)) {}
 
 Status ParquetFileWriter::Write(const std::shared_ptr<RecordBatch>& batch) {
-  ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(batch->schema(), {batch}));
-  return parquet_writer_->WriteTable(*table, batch->num_rows());
+  return parquet_writer_->WriteRecordBatch(*batch);
 }
 
 Status ParquetFileWriter::Finish() { return parquet_writer_->Close(); }
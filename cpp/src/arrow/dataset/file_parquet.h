@@ -101,6 +101,12 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
     /// option will be removed after support is added for simultaneous parallelization
     /// across files and columns.
     bool enable_parallel_column_conversion = false;
+
+    /// EXPERIMENTAL: Read the columns referenced by the filter first, then decode the
+    /// other columns only at the rows satisfying it, skipping the pages which hold none
+    /// of these rows. Each RowGroup is then read whole rather than batch by batch, which
+    /// pays off with selective filters on wide tables.
+    bool enable_late_materialization = false;
   } reader_options;
 
   Result<bool> IsSupported(const FileSource& source) const override;
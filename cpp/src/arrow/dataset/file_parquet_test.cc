@@ -21,6 +21,9 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api_scalar.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/record_batch.h"
@@ -445,6 +448,244 @@ TEST_F(TestParquetFileFormat, PredicatePushdown) {
                             kNumRowGroups - 5);
 }
 
+TEST_F(TestParquetFileFormat, PredicatePushdownPages) {
+  // A single row group of sorted values, whose pages each hold a few hundred
+  // rows of the dictionary encoded "sorted" column and 100 rows of the PLAIN
+  // encoded "doubled" column
+  constexpr int64_t kNumSortedRows = 10000;
+  std::vector<int64_t> sorted(kNumSortedRows), doubled(kNumSortedRows);
+  for (int64_t i = 0; i < kNumSortedRows; ++i) {
+    sorted[i] = i;
+    doubled[i] = 2 * i;
+  }
+  schema_ = schema({field("sorted", int64()), field("doubled", int64())});
+  std::shared_ptr<Array> sorted_array, doubled_array;
+  ArrayFromVector<Int64Type>(sorted, &sorted_array);
+  ArrayFromVector<Int64Type>(doubled, &doubled_array);
+  auto table = Table::Make(schema_, {sorted_array, doubled_array});
+  auto properties = WriterProperties::Builder()
+                        .write_batch_size(100)
+                        ->data_pagesize(400)
+                        ->disable_dictionary("doubled")
+                        ->enable_write_page_index()
+                        ->build();
+
+  auto sink = CreateOutputStream();
+  TableBatchReader table_reader(*table);
+  ASSERT_OK(WriteRecordBatchReader(&table_reader, default_memory_pool(), sink,
+                                   properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  opts_ = ScanOptions::Make(schema_);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+
+  auto CountRows = [&](Expression filter) {
+    SetFilter(std::move(filter));
+    int64_t num_rows = 0;
+    for (auto maybe_batch : Batches(fragment.get())) {
+      EXPECT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      // Both columns are read from the same rows
+      auto sorted = checked_pointer_cast<Int64Array>(batch->column(0));
+      auto doubled = checked_pointer_cast<Int64Array>(batch->column(1));
+      for (int64_t i = 0; i < batch->num_rows(); ++i) {
+        EXPECT_EQ(sorted->Value(i) * 2, doubled->Value(i));
+      }
+      num_rows += batch->num_rows();
+    }
+    return num_rows;
+  };
+
+  ASSERT_EQ(CountRows(literal(true)), kNumSortedRows);
+
+  // Only the pages which may hold the row are read
+  auto num_rows = CountRows(equal(field_ref("sorted"), literal<int64_t>(1234)));
+  ASSERT_GT(num_rows, 0);
+  ASSERT_LT(num_rows, kNumSortedRows / 4);
+
+  num_rows = CountRows(greater_equal(field_ref("doubled"), literal<int64_t>(19900)));
+  ASSERT_GE(num_rows, 50);
+  ASSERT_LT(num_rows, kNumSortedRows / 4);
+
+  // Pages are pruned by both columns
+  num_rows = CountRows(and_(less(field_ref("sorted"), literal<int64_t>(5000)),
+                            greater(field_ref("doubled"), literal<int64_t>(9000))));
+  ASSERT_GE(num_rows, 499);
+  ASSERT_LT(num_rows, kNumSortedRows / 4);
+
+  ASSERT_EQ(CountRows(equal(field_ref("sorted"), literal<int64_t>(-1))), 0);
+}
+
+TEST_F(TestParquetFileFormat, LateMaterialization) {
+  // A single row group of ids, with a string column whose pages hold 100 rows
+  constexpr int64_t kNumIdRows = 10000;
+  Int64Builder id_builder;
+  StringBuilder name_builder;
+  for (int64_t i = 0; i < kNumIdRows; ++i) {
+    ASSERT_OK(id_builder.Append(i));
+    ASSERT_OK(i % 3 == 0 ? name_builder.AppendNull()
+                         : name_builder.Append("name" + std::to_string(i)));
+  }
+  ASSERT_OK_AND_ASSIGN(auto id_array, id_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto name_array, name_builder.Finish());
+  schema_ = schema({field("id", int64()), field("name", utf8())});
+  auto table = Table::Make(schema_, {id_array, name_array});
+  auto properties = WriterProperties::Builder()
+                        .write_batch_size(100)
+                        ->data_pagesize(400)
+                        ->disable_dictionary("name")
+                        ->enable_write_page_index()
+                        ->build();
+
+  auto sink = CreateOutputStream();
+  TableBatchReader table_reader(*table);
+  ASSERT_OK(WriteRecordBatchReader(&table_reader, default_memory_pool(), sink,
+                                   properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  FileSource source(buffer);
+
+  format_->reader_options.enable_late_materialization = true;
+  opts_ = ScanOptions::Make(schema_);
+  opts_->batch_size = 64;
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(source));
+
+  // Only the rows satisfying the filter are returned by the scan tasks
+  auto ScanIds = [&](Expression filter) {
+    SetFilter(std::move(filter));
+    std::vector<int64_t> ids;
+    for (auto maybe_batch : Batches(fragment.get())) {
+      EXPECT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      EXPECT_LE(batch->num_rows(), 64);
+      auto id = checked_pointer_cast<Int64Array>(batch->column(0));
+      auto name = checked_pointer_cast<StringArray>(batch->column(1));
+      for (int64_t i = 0; i < batch->num_rows(); ++i) {
+        if (id->Value(i) % 3 == 0) {
+          EXPECT_TRUE(name->IsNull(i));
+        } else {
+          EXPECT_EQ("name" + std::to_string(id->Value(i)), name->GetString(i));
+        }
+        ids.push_back(id->Value(i));
+      }
+    }
+    return ids;
+  };
+
+  ASSERT_EQ(ScanIds(literal(true)).size(), kNumIdRows);
+  ASSERT_EQ(ScanIds(equal(field_ref("id"), literal<int64_t>(1234))),
+            std::vector<int64_t>{1234});
+  ASSERT_EQ(ScanIds(equal(field_ref("id"), literal<int64_t>(-1))),
+            std::vector<int64_t>{});
+
+  auto ids = ScanIds(or_(less(field_ref("id"), literal<int64_t>(150)),
+                         and_(greater_equal(field_ref("id"), literal<int64_t>(5000)),
+                              less(field_ref("id"), literal<int64_t>(5300)))));
+  ASSERT_EQ(ids.size(), 450);
+  ASSERT_EQ(ids[149], 149);
+  ASSERT_EQ(ids[150], 5000);
+  ASSERT_EQ(ids.back(), 5299);
+
+  // Filters on the projected string column work as well
+  ids = ScanIds(equal(field_ref("name"), literal("name4321")));
+  ASSERT_EQ(ids, std::vector<int64_t>{4321});
+}
+
+TEST_F(TestParquetFileFormat, PredicatePushdownBloomFilter) {
+  // Four row groups of interleaved ids, i.e. with overlapping min/max, where
+  // row group r holds the ids 8 * i + r
+  constexpr int kNumRowGroups = 4;
+  constexpr int64_t kRowGroupSize = 1000;
+  schema_ = schema({field("id", int64()), field("name", utf8())});
+  RecordBatchVector batches;
+  for (int r = 0; r < kNumRowGroups; ++r) {
+    std::vector<int64_t> ids;
+    std::vector<std::string> names;
+    for (int64_t i = 0; i < kRowGroupSize; ++i) {
+      ids.push_back(8 * i + r);
+      names.push_back("name" + std::to_string(ids.back()));
+    }
+    std::shared_ptr<Array> id_array, name_array;
+    ArrayFromVector<Int64Type>(ids, &id_array);
+    ArrayFromVector<StringType, std::string>(names, &name_array);
+    batches.push_back(RecordBatch::Make(schema_, kRowGroupSize, {id_array, name_array}));
+  }
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make(batches, schema_));
+
+  auto WriteFragment = [&](std::shared_ptr<WriterProperties> properties) {
+    auto sink = CreateOutputStream();
+    ARROW_EXPECT_OK(WriteRecordBatchReader(reader.get(), default_memory_pool(), sink,
+                                           properties));
+    EXPECT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+    EXPECT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+    return fragment;
+  };
+  auto fragment = WriteFragment(WriterProperties::Builder()
+                                    .enable_bloom_filter("id", kRowGroupSize)
+                                    ->enable_bloom_filter("name", kRowGroupSize)
+                                    ->build());
+  opts_ = ScanOptions::Make(schema_);
+
+  SetFilter(literal(true));
+  CountRowsAndBatchesInScan(fragment, kNumRowGroups * kRowGroupSize, kNumRowGroups);
+
+  SetFilter(equal(field_ref("id"), literal<int64_t>(42)));
+  CountRowsAndBatchesInScan(fragment, kRowGroupSize, 1);
+
+  // No row group holds the ids 8 * i + 4 to 8 * i + 7
+  SetFilter(equal(field_ref("id"), literal<int64_t>(45)));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+
+  SetFilter(call("is_in", {field_ref("name")},
+                 compute::SetLookupOptions{
+                     ArrayFromJSON(utf8(), R"(["name42", "name43", "name44"])")}));
+  CountRowsAndBatchesInScan(fragment, 2 * kRowGroupSize, 2);
+
+  SetFilter(and_(equal(field_ref("id"), literal<int64_t>(40)),
+                 equal(field_ref("name"), literal("name41"))));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+
+  // A null never equals any value
+  SetFilter(call("is_in", {field_ref("name")},
+                 compute::SetLookupOptions{ArrayFromJSON(utf8(), R"(["name45", null])"),
+                                           /*skip_nulls=*/true}));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+
+  // Without Bloom filters, every row group is read
+  reader = RecordBatchReader::Make(batches, schema_).ValueOrDie();
+  fragment = WriteFragment(default_writer_properties());
+  SetFilter(equal(field_ref("id"), literal<int64_t>(42)));
+  CountRowsAndBatchesInScan(fragment, kNumRowGroups * kRowGroupSize, kNumRowGroups);
+}
+
+TEST_F(TestParquetFileFormat, PredicatePushdownBloomFilterSignedZero) {
+  // -0.0 and 0.0 compare equal, but their bit patterns hash differently
+  schema_ = schema({field("f", float32()), field("d", float64())});
+  auto batch = RecordBatchFromJSON(schema_, R"([{"f": -0.0, "d": -0.0},
+                                                {"f": 1.5, "d": 1.5},
+                                                {"f": 2.5, "d": 2.5}])");
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make({batch}, schema_));
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteRecordBatchReader(reader.get(), default_memory_pool(), sink,
+                                   WriterProperties::Builder()
+                                       .enable_bloom_filter("f", 3)
+                                       ->enable_bloom_filter("d", 3)
+                                       ->build()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+  opts_ = ScanOptions::Make(schema_);
+
+  SetFilter(equal(field_ref("f"), literal(0.0f)));
+  CountRowsAndBatchesInScan(fragment, 3, 1);
+  SetFilter(equal(field_ref("d"), literal(0.0)));
+  CountRowsAndBatchesInScan(fragment, 3, 1);
+  SetFilter(call("is_in", {field_ref("d")},
+                 compute::SetLookupOptions{ArrayFromJSON(float64(), "[0.0, 7.5]")}));
+  CountRowsAndBatchesInScan(fragment, 3, 1);
+
+  // Other values are still looked up in the Bloom filters
+  SetFilter(equal(field_ref("d"), literal(1.0)));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+}
+
 TEST_F(TestParquetFileFormat, PredicatePushdownRowGroupFragments) {
   constexpr int64_t kNumRowGroups = 16;
 
@@ -571,9 +812,81 @@ TEST_F(TestParquetFileFormat, ExplicitRowGroupSelection) {
       row_groups_fragment({kNumRowGroups + 1})->Scan(opts_, ctx_));
 }
 
+TEST_F(TestParquetFileFormat, PrefetchRowGroups) {
+  constexpr int64_t kNumRowGroups = 16;
+
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+
+  opts_ = ScanOptions::Make(reader->schema());
+  schema_ = reader->schema();
+  SetFilter(literal(true));
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(opts_, ctx_));
+  ASSERT_OK_AND_ASSIGN(auto scan_tasks, scan_task_it.ToVector());
+  ASSERT_EQ(scan_tasks.size(), kNumRowGroups);
+
+  // Prefetch every row group up front, then read them from their buffers
+  std::vector<Future<>> prefetched;
+  for (const auto& scan_task : scan_tasks) {
+    ASSERT_GT(scan_task->EstimatedPrefetchBytes(), 0);
+    prefetched.push_back(scan_task->Prefetch(io::AsyncContext()));
+  }
+  for (int i = 0; i < kNumRowGroups; ++i) {
+    ASSERT_OK(prefetched[i].status());
+    ASSERT_OK_AND_ASSIGN(auto batch_it, scan_tasks[i]->Execute());
+    ASSERT_OK_AND_ASSIGN(auto batches, batch_it.ToVector());
+    ASSERT_EQ(batches.size(), 1);
+    ASSERT_EQ(batches[0]->num_rows(), i + 1);
+  }
+}
+
+TEST_F(TestParquetFileFormat, ScanBatchesAsync) {
+  constexpr int64_t kNumRowGroups = 16;
+
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+
+  opts_ = ScanOptions::Make(reader->schema());
+  schema_ = reader->schema();
+  SetFilter(greater(field_ref("i64"), literal(3)));
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+    opts_->scan_task_readahead = 4;
+    Scanner scanner(fragment, opts_, ctx_);
+    ASSERT_OK_AND_ASSIGN(auto batches, scanner.ScanBatchesAsync());
+
+    // Row group i holds i + 1 rows of value i + 1
+    int64_t expected_value = 4;
+    while (true) {
+      auto next = batches();
+      ASSERT_OK_AND_ASSIGN(auto batch, next.result());
+      if (batch == nullptr) break;
+      ASSERT_EQ(batch->num_rows(), expected_value);
+      ++expected_value;
+    }
+    ASSERT_EQ(expected_value, kNumRowGroups + 1);
+  }
+}
+
 TEST_F(TestParquetFileFormat, WriteRecordBatchReader) {
+  // Batches are buffered in row groups bounded by max_row_group_bytes rather
+  // than written as a row group each
   std::shared_ptr<RecordBatchReader> reader = GetRecordBatchReader();
-  auto source = GetFileSource(reader.get());
+  EXPECT_OK_AND_ASSIGN(auto expected_sink, GetFileSink());
+  std::unique_ptr<parquet::arrow::FileWriter> parquet_writer;
+  ASSERT_OK(parquet::arrow::FileWriter::Open(*reader->schema(), default_memory_pool(),
+                                             expected_sink, default_writer_properties(),
+                                             default_arrow_writer_properties(),
+                                             &parquet_writer));
+  ASSERT_OK(MakeFunctionIterator([&] { return reader->Next(); })
+                .Visit([&](std::shared_ptr<RecordBatch> batch) {
+                  return parquet_writer->WriteRecordBatch(*batch);
+                }));
+  ASSERT_OK(parquet_writer->Close());
+  EXPECT_OK_AND_ASSIGN(auto expected, expected_sink->Finish());
   reader = GetRecordBatchReader();
 
   opts_ = ScanOptions::Make(reader->schema());
@@ -587,7 +900,7 @@ TEST_F(TestParquetFileFormat, WriteRecordBatchReader) {
 
   EXPECT_OK_AND_ASSIGN(auto written, sink->Finish());
 
-  AssertBufferEqual(*written, *source->buffer());
+  AssertBufferEqual(*written, *expected);
 }
 
 TEST_F(TestParquetFileFormat, WriteRecordBatchReaderCustomOptions) {
@@ -18,15 +18,22 @@
 #include "arrow/dataset/scanner.h"
 
 #include <algorithm>
+#include <deque>
 #include <memory>
 #include <mutex>
+#include <vector>
 
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/exec/exec_plan.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/scanner_internal.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
 
@@ -41,6 +48,10 @@ std::shared_ptr<ScanOptions> ScanOptions::ReplaceSchema(
   auto copy = ScanOptions::Make(std::move(schema));
   copy->filter = filter;
   copy->batch_size = batch_size;
+  copy->fragment_readahead = fragment_readahead;
+  copy->scan_task_readahead = scan_task_readahead;
+  copy->readahead_bytes = readahead_bytes;
+  copy->preserve_order = preserve_order;
   return copy;
 }
 
@@ -59,6 +70,8 @@ std::vector<std::string> ScanOptions::MaterializedFields() const {
   return fields;
 }
 
+Future<> ScanTask::Prefetch(const io::AsyncContext&) { return Future<>::MakeFinished(); }
+
 Result<RecordBatchIterator> InMemoryScanTask::Execute() {
   return MakeVectorIterator(record_batches_);
 }
@@ -82,6 +95,295 @@ Result<ScanTaskIterator> Scanner::Scan() {
   return GetScanTaskIterator(std::move(fragment_it), scan_options_, scan_context_);
 }
 
+namespace {
+
+Result<RecordBatchVector> ExecuteToVector(const std::shared_ptr<ScanTask>& task) {
+  ARROW_ASSIGN_OR_RAISE(auto batches, task->Execute());
+  return batches.ToVector();
+}
+
+// The size of the buffers referenced by an array.  Buffers shared with other arrays
+// (e.g. by slices) are counted for each of them.
+int64_t DataBytes(const ArrayData& data) {
+  int64_t bytes = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != NULLPTR) bytes += buffer->size();
+  }
+  for (const auto& child : data.child_data) {
+    bytes += DataBytes(*child);
+  }
+  if (data.dictionary != NULLPTR) {
+    bytes += DataBytes(*data.dictionary);
+  }
+  return bytes;
+}
+
+int64_t BatchBytes(const RecordBatch& batch) {
+  int64_t bytes = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    bytes += DataBytes(*batch.column_data(i));
+  }
+  return bytes;
+}
+
+// The state of an asynchronous scan.  Fragments are opened, and their ScanTasks
+// prefetched (and with use_threads executed), ahead of the consumer within the
+// readahead limits of the ScanOptions.  Progress is driven by the consumer's calls
+// to Next(), which yields the batches of each ScanTask in order, or as ScanTasks
+// complete if the order needn't be preserved.  Decoded batches which are not
+// consumed yet count against readahead_bytes, so a slow consumer holds back the scan.
+class AsyncScanState : public std::enable_shared_from_this<AsyncScanState> {
+ public:
+  AsyncScanState(FragmentIterator fragments, std::shared_ptr<ScanOptions> options,
+                 std::shared_ptr<ScanContext> context)
+      : fragments_(std::move(fragments)),
+        options_(std::move(options)),
+        context_(std::move(context)),
+        cpu_executor_(context_->use_threads ? internal::GetCpuThreadPool() : NULLPTR) {}
+
+  Future<std::shared_ptr<RecordBatch>> Next() {
+    using BatchFuture = Future<std::shared_ptr<RecordBatch>>;
+    auto self = shared_from_this();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      // Consumed batches may have freed some of the budget
+      Status st = Pump();
+      if (!st.ok()) {
+        return BatchFuture::MakeFinished(std::move(st));
+      }
+
+      if (batch_index_ < batches_.size()) {
+        auto batch = std::move(batches_[batch_index_++]);
+        bytes_in_flight_ -= BatchBytes(*batch);
+        return BatchFuture::MakeFinished(std::move(batch));
+      }
+
+      if (tasks_.empty()) {
+        if (fragment_scans_.empty()) {
+          return BatchFuture::MakeFinished(std::shared_ptr<RecordBatch>());
+        }
+        auto opened = WaitForFragment();
+        lock.unlock();
+        return opened.Then([self](const detail::Empty&) { return self->Next(); });
+      }
+
+      auto ready = FindReadyTask();
+      if (ready == tasks_.end()) {
+        auto waited = WaitForTask();
+        lock.unlock();
+        return waited.Then([self](const detail::Empty&) { return self->Next(); });
+      }
+      InFlightTask task = std::move(*ready);
+      tasks_.erase(ready);
+      bytes_in_flight_ -= task.bytes;
+
+      Result<RecordBatchVector> batches;
+      if (cpu_executor_ != NULLPTR) {
+        batches = task.batches.result();
+      } else if (!task.ready.status().ok()) {
+        batches = task.ready.status();
+      } else {
+        // Without use_threads, ScanTasks are executed by the consumer
+        lock.unlock();
+        batches = ExecuteToVector(task.task);
+        lock.lock();
+      }
+      if (!batches.ok()) {
+        return BatchFuture::MakeFinished(batches.status());
+      }
+      batches_ = batches.MoveValueUnsafe();
+      batch_index_ = 0;
+      for (const auto& batch : batches_) {
+        bytes_in_flight_ += BatchBytes(*batch);
+      }
+    }
+  }
+
+ private:
+  struct InFlightTask {
+    std::shared_ptr<ScanTask> task;
+    // Estimated prefetched bytes, or decoded bytes once measured
+    int64_t bytes;
+    bool decoded = false;
+    // Completes once the task can be consumed: once prefetched, or with use_threads
+    // once executed
+    Future<> ready;
+    // Only with use_threads
+    Future<RecordBatchVector> batches;
+  };
+
+  // Open Fragments and start ScanTasks up to the readahead limits.  Must be called
+  // with mutex_ held.
+  Status Pump() {
+    UpdateDecodedBytes();
+
+    bool progress = true;
+    while (progress) {
+      progress = false;
+
+      while (!fragments_done_ && static_cast<int32_t>(fragment_scans_.size()) <
+                                     options_->fragment_readahead) {
+        ARROW_ASSIGN_OR_RAISE(auto fragment, fragments_.Next());
+        if (fragment == nullptr) {
+          fragments_done_ = true;
+          break;
+        }
+        auto options = options_;
+        auto context = context_;
+        fragment_scans_.push_back(DeferNotOk(context_->io_context.executor->Submit(
+            [fragment, options, context]() -> Result<ScanTaskVector> {
+              ARROW_ASSIGN_OR_RAISE(auto scan_tasks,
+                                    ScanFragment(fragment, options, context));
+              return scan_tasks.ToVector();
+            })));
+      }
+
+      // The ScanTasks of one opened Fragment are started at a time, in order.  If
+      // the order is preserved, that is the first Fragment.
+      if (pending_tasks_.empty()) {
+        auto opened = std::find_if(
+            fragment_scans_.begin(), fragment_scans_.end(),
+            [](const Future<ScanTaskVector>& scan) { return scan.is_finished(); });
+        if (options_->preserve_order && opened != fragment_scans_.begin()) {
+          opened = fragment_scans_.end();
+        }
+        if (opened != fragment_scans_.end()) {
+          ARROW_ASSIGN_OR_RAISE(auto tasks, opened->result());
+          fragment_scans_.erase(opened);
+          pending_tasks_.assign(tasks.begin(), tasks.end());
+          progress = true;
+        }
+      }
+
+      while (!pending_tasks_.empty() &&
+             (tasks_.empty() ||
+              (static_cast<int32_t>(tasks_.size()) < options_->scan_task_readahead &&
+               bytes_in_flight_ < options_->readahead_bytes))) {
+        StartTask(std::move(pending_tasks_.front()));
+        pending_tasks_.pop_front();
+      }
+    }
+    return Status::OK();
+  }
+
+  void StartTask(std::shared_ptr<ScanTask> task) {
+    InFlightTask in_flight;
+    in_flight.bytes = task->EstimatedPrefetchBytes();
+    in_flight.ready = task->Prefetch(context_->io_context);
+    if (cpu_executor_ != NULLPTR) {
+      auto executor = cpu_executor_;
+      in_flight.batches = in_flight.ready.Then(
+          [task, executor](const detail::Empty&) -> Future<RecordBatchVector> {
+            return DeferNotOk(executor->Submit([task] { return ExecuteToVector(task); }));
+          });
+      in_flight.ready = in_flight.batches.Then([](const RecordBatchVector&) {});
+    }
+    in_flight.task = std::move(task);
+    bytes_in_flight_ += in_flight.bytes;
+    tasks_.push_back(std::move(in_flight));
+  }
+
+  // With use_threads, the decoded batches of executed ScanTasks count against the
+  // budget in place of their prefetched data
+  void UpdateDecodedBytes() {
+    if (cpu_executor_ == NULLPTR) return;
+    for (auto& task : tasks_) {
+      if (task.decoded || !task.batches.is_finished()) continue;
+      task.decoded = true;
+      const auto& batches = task.batches.result();
+      if (!batches.ok()) continue;
+      bytes_in_flight_ -= task.bytes;
+      task.bytes = 0;
+      for (const auto& batch : *batches) {
+        task.bytes += BatchBytes(*batch);
+      }
+      bytes_in_flight_ += task.bytes;
+    }
+  }
+
+  std::deque<InFlightTask>::iterator FindReadyTask() {
+    if (options_->preserve_order) {
+      return tasks_.front().ready.is_finished() ? tasks_.begin() : tasks_.end();
+    }
+    return std::find_if(tasks_.begin(), tasks_.end(), [](const InFlightTask& task) {
+      return task.ready.is_finished();
+    });
+  }
+
+  Future<> WaitForTask() {
+    if (options_->preserve_order) {
+      return tasks_.front().ready;
+    }
+    std::vector<Future<>> ready;
+    for (const auto& task : tasks_) {
+      ready.push_back(task.ready);
+    }
+    return AnyComplete(ready);
+  }
+
+  Future<> WaitForFragment() {
+    std::vector<Future<>> opened;
+    for (const auto& scan : fragment_scans_) {
+      opened.push_back(scan.Then([](const ScanTaskVector&) {}));
+      if (options_->preserve_order) break;
+    }
+    return AnyComplete(opened);
+  }
+
+  std::mutex mutex_;
+  FragmentIterator fragments_;
+  bool fragments_done_ = false;
+  std::shared_ptr<ScanOptions> options_;
+  std::shared_ptr<ScanContext> context_;
+  internal::Executor* cpu_executor_;
+
+  // Fragments being opened, in order
+  std::deque<Future<ScanTaskVector>> fragment_scans_;
+  // ScanTasks of an opened Fragment which are not started yet
+  std::deque<std::shared_ptr<ScanTask>> pending_tasks_;
+  // Started ScanTasks, in order
+  std::deque<InFlightTask> tasks_;
+  int64_t bytes_in_flight_ = 0;
+
+  // The batches of the last consumed ScanTask
+  RecordBatchVector batches_;
+  size_t batch_index_ = 0;
+};
+
+class ScannerRecordBatchReader : public RecordBatchReader {
+ public:
+  ScannerRecordBatchReader(std::shared_ptr<Schema> schema, RecordBatchGenerator batches)
+      : schema_(std::move(schema)), batches_(std::move(batches)) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    auto next = batches_();
+    ARROW_ASSIGN_OR_RAISE(*batch, next.result());
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  RecordBatchGenerator batches_;
+};
+
+}  // namespace
+
+Result<RecordBatchGenerator> Scanner::ScanBatchesAsync() {
+  ARROW_ASSIGN_OR_RAISE(auto fragments, GetFragments());
+  auto state = std::make_shared<AsyncScanState>(std::move(fragments), scan_options_,
+                                                scan_context_);
+  return [state] { return state->Next(); };
+}
+
+Result<std::shared_ptr<RecordBatchReader>> Scanner::ToRecordBatchReader() {
+  ARROW_ASSIGN_OR_RAISE(auto batches, ScanBatchesAsync());
+  return std::make_shared<ScannerRecordBatchReader>(scan_options_->schema(),
+                                                    std::move(batches));
+}
+
 Result<ScanTaskIterator> ScanTaskIteratorFromRecordBatch(
     std::vector<std::shared_ptr<RecordBatch>> batches,
     std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext> context) {
@@ -142,6 +444,38 @@ Status ScannerBuilder::BatchSize(int64_t batch_size) {
   return Status::OK();
 }
 
+Status ScannerBuilder::FragmentReadahead(int32_t fragment_readahead) {
+  if (fragment_readahead <= 0) {
+    return Status::Invalid("FragmentReadahead must be greater than 0, got ",
+                           fragment_readahead);
+  }
+  scan_options_->fragment_readahead = fragment_readahead;
+  return Status::OK();
+}
+
+Status ScannerBuilder::ScanTaskReadahead(int32_t scan_task_readahead) {
+  if (scan_task_readahead <= 0) {
+    return Status::Invalid("ScanTaskReadahead must be greater than 0, got ",
+                           scan_task_readahead);
+  }
+  scan_options_->scan_task_readahead = scan_task_readahead;
+  return Status::OK();
+}
+
+Status ScannerBuilder::ReadaheadBytes(int64_t readahead_bytes) {
+  if (readahead_bytes < 0) {
+    return Status::Invalid("ReadaheadBytes must not be negative, got ",
+                           readahead_bytes);
+  }
+  scan_options_->readahead_bytes = readahead_bytes;
+  return Status::OK();
+}
+
+Status ScannerBuilder::PreserveOrder(bool preserve_order) {
+  scan_options_->preserve_order = preserve_order;
+  return Status::OK();
+}
+
 Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() const {
   std::shared_ptr<ScanOptions> scan_options;
   if (has_projection_ && !project_columns_.empty()) {
@@ -196,6 +530,18 @@ struct TableAssemblyState {
 };
 
 Result<std::shared_ptr<Table>> Scanner::ToTable() {
+  if (scan_context_->use_threads) {
+    ARROW_ASSIGN_OR_RAISE(auto batches, ScanBatchesAsync());
+    RecordBatchVector collected;
+    while (true) {
+      auto next = batches();
+      ARROW_ASSIGN_OR_RAISE(auto batch, next.result());
+      if (batch == nullptr) break;
+      collected.push_back(std::move(batch));
+    }
+    return Table::FromRecordBatches(scan_options_->schema(), std::move(collected));
+  }
+
   ARROW_ASSIGN_OR_RAISE(auto scan_task_it, Scan());
   auto task_group = scan_context_->TaskGroup();
 
@@ -224,5 +570,226 @@ Result<std::shared_ptr<Table>> Scanner::ToTable() {
                                   FlattenRecordBatchVector(std::move(state->batches)));
 }
 
+namespace {
+
+// Pulls the batches of an asynchronous scan, sliced into morsels
+class ScanMorselGenerator : public std::enable_shared_from_this<ScanMorselGenerator> {
+ public:
+  explicit ScanMorselGenerator(RecordBatchGenerator batches)
+      : batches_(std::move(batches)) {}
+
+  Future<util::optional<compute::ExecBatch>> Next() {
+    using MorselFuture = Future<util::optional<compute::ExecBatch>>;
+    while (true) {
+      if (batch_ != nullptr && offset_ < batch_->num_rows()) {
+        auto morsel = batch_->Slice(offset_, compute::kDefaultExecChunksize);
+        offset_ += morsel->num_rows();
+        return MorselFuture::MakeFinished(compute::ExecBatch(*morsel));
+      }
+
+      auto next = batches_();
+      if (!next.is_finished()) {
+        auto self = shared_from_this();
+        return next.Then([self](const std::shared_ptr<RecordBatch>& batch) {
+          return self->SetBatch(batch) ? self->Next()
+                                       : MorselFuture::MakeFinished(util::nullopt);
+        });
+      }
+      if (!next.status().ok()) {
+        return MorselFuture::MakeFinished(next.status());
+      }
+      if (!SetBatch(next.result().ValueUnsafe())) {
+        return MorselFuture::MakeFinished(util::nullopt);
+      }
+    }
+  }
+
+ private:
+  // Return false at the end of the scan
+  bool SetBatch(std::shared_ptr<RecordBatch> batch) {
+    batch_ = std::move(batch);
+    offset_ = 0;
+    return batch_ != nullptr;
+  }
+
+  RecordBatchGenerator batches_;
+  std::shared_ptr<RecordBatch> batch_;
+  int64_t offset_ = 0;
+};
+
+// Bind an expression, rejecting references to missing fields rather than
+// treating them as null
+Result<Expression> BindToSchema(const Expression& expr, const Schema& schema,
+                                compute::ExecContext* exec_context) {
+  for (const auto& ref : FieldsInExpression(expr)) {
+    RETURN_NOT_OK(ref.FindOne(schema));
+  }
+  return expr.Bind(schema, exec_context);
+}
+
+Status ValidateInput(const compute::ExecNode* input) {
+  if (input == nullptr) {
+    return Status::Invalid("ExecNode input must not be null");
+  }
+  return Status::OK();
+}
+
+// The input columns referenced by some expressions.  Expressions bound to the
+// schema of only these columns can be evaluated against the selected rows of
+// these columns, so a selective filter on a wide batch does not copy the rest.
+struct ReferencedColumns {
+  static Result<ReferencedColumns> Make(const std::vector<Expression>& exprs,
+                                        const std::shared_ptr<Schema>& input_schema) {
+    ReferencedColumns columns;
+    std::vector<bool> referenced(input_schema->num_fields(), false);
+    bool all_names = true;
+    for (const auto& expr : exprs) {
+      for (const auto& ref : FieldsInExpression(expr)) {
+        ARROW_ASSIGN_OR_RAISE(auto path, ref.FindOne(*input_schema));
+        referenced[path[0]] = true;
+        // Positional references would not survive narrowing the schema
+        all_names = all_names && ref.IsName();
+      }
+    }
+
+    FieldVector fields;
+    for (int i = 0; i < input_schema->num_fields(); ++i) {
+      if (referenced[i] || !all_names) {
+        columns.indices.push_back(i);
+        fields.push_back(input_schema->field(i));
+      }
+    }
+    columns.schema = arrow::schema(std::move(fields));
+    return columns;
+  }
+
+  // Gather the selected rows of the referenced columns
+  Result<std::shared_ptr<RecordBatch>> Gather(const compute::ExecBatch& batch,
+                                              compute::ExecContext* exec_context) const {
+    compute::ExecBatch narrowed({}, batch.length);
+    for (int i : indices) {
+      narrowed.values.push_back(batch.values[i]);
+    }
+    narrowed.selection_vector = batch.selection_vector;
+    return narrowed.ToRecordBatch(schema, exec_context->memory_pool());
+  }
+
+  std::vector<int> indices;
+  std::shared_ptr<Schema> schema;
+};
+
+// Compose a selection of rows of a batch with the selection it already has
+Result<std::shared_ptr<compute::SelectionVector>> ComposeSelection(
+    const compute::ExecBatch& batch, std::shared_ptr<compute::SelectionVector> selection,
+    compute::ExecContext* exec_context) {
+  if (batch.selection_vector == nullptr) {
+    return std::move(selection);
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum composed,
+                        compute::Take(batch.selection_vector->data(), selection->data(),
+                                      compute::TakeOptions::NoBoundsCheck(),
+                                      exec_context));
+  return std::make_shared<compute::SelectionVector>(composed.array());
+}
+
+}  // namespace
+
+Result<compute::ExecNode*> MakeScanNode(compute::ExecPlan* plan,
+                                        std::shared_ptr<Scanner> scanner,
+                                        std::string label) {
+  ARROW_ASSIGN_OR_RAISE(auto batches, scanner->ScanBatchesAsync());
+  auto generator = std::make_shared<ScanMorselGenerator>(std::move(batches));
+
+  return compute::MakeSourceNode(plan, std::move(label), scanner->schema(),
+                                 [generator] { return generator->Next(); });
+}
+
+Result<compute::ExecNode*> MakeFilterNode(compute::ExecNode* input, std::string label,
+                                          Expression filter) {
+  RETURN_NOT_OK(ValidateInput(input));
+  auto exec_context = input->plan()->exec_context();
+  auto schema = input->output_schema();
+
+  ARROW_ASSIGN_OR_RAISE(auto columns, ReferencedColumns::Make({filter}, schema));
+  ARROW_ASSIGN_OR_RAISE(filter, BindToSchema(filter, *columns.schema, exec_context));
+  if (filter.descr().type->id() != Type::BOOL) {
+    return Status::TypeError("Filter expression must evaluate to bool, but ",
+                             filter.ToString(), " evaluates to ",
+                             filter.descr().type->ToString());
+  }
+
+  // The filter is not applied to the batch: its selection vector is narrowed
+  // instead, deferring materialization to the end of the plan
+  return compute::MakeMapNode(
+      input, std::move(label), schema,
+      [=](compute::ExecBatch batch) -> Result<compute::ExecBatch> {
+        ARROW_ASSIGN_OR_RAISE(auto in, columns.Gather(batch, exec_context));
+        ARROW_ASSIGN_OR_RAISE(Datum mask,
+                              ExecuteFilterExpression(filter, Datum(in), exec_context));
+
+        std::shared_ptr<compute::SelectionVector> selection;
+        if (mask.is_scalar()) {
+          if (mask.scalar_as<BooleanScalar>().value) {
+            return batch;
+          }
+          ARROW_ASSIGN_OR_RAISE(auto none,
+                                MakeArrayOfNull(int32(), 0, exec_context->memory_pool()));
+          selection = std::make_shared<compute::SelectionVector>(*none);
+        } else {
+          ARROW_ASSIGN_OR_RAISE(selection, compute::SelectionVector::FromMask(
+                                               BooleanArray(mask.array()),
+                                               exec_context->memory_pool()));
+          if (selection->length() == in->num_rows()) {
+            return batch;
+          }
+        }
+
+        ARROW_ASSIGN_OR_RAISE(
+            batch.selection_vector,
+            ComposeSelection(batch, std::move(selection), exec_context));
+        batch.length = batch.selection_vector->length();
+        return batch;
+      });
+}
+
+Result<compute::ExecNode*> MakeProjectNode(compute::ExecNode* input, std::string label,
+                                           std::vector<Expression> exprs,
+                                           std::vector<std::string> names) {
+  RETURN_NOT_OK(ValidateInput(input));
+  auto exec_context = input->plan()->exec_context();
+  auto input_schema = input->output_schema();
+
+  if (names.empty()) {
+    for (const auto& expr : exprs) {
+      names.push_back(expr.ToString());
+    }
+  } else if (names.size() != exprs.size()) {
+    return Status::Invalid("Got ", names.size(), " names for ", exprs.size(),
+                           " expressions");
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto columns, ReferencedColumns::Make(exprs, input_schema));
+
+  FieldVector fields(exprs.size());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(exprs[i],
+                          BindToSchema(exprs[i], *columns.schema, exec_context));
+    fields[i] = field(std::move(names[i]), exprs[i].descr().type);
+  }
+
+  return compute::MakeMapNode(
+      input, std::move(label), schema(std::move(fields)),
+      [=](compute::ExecBatch batch) -> Result<compute::ExecBatch> {
+        // Expressions are only evaluated on the selected rows
+        ARROW_ASSIGN_OR_RAISE(auto in, columns.Gather(batch, exec_context));
+        std::vector<Datum> values(exprs.size());
+        for (size_t i = 0; i < exprs.size(); ++i) {
+          ARROW_ASSIGN_OR_RAISE(
+              values[i], ExecuteScalarExpression(exprs[i], Datum(in), exec_context));
+        }
+        return compute::ExecBatch(std::move(values), batch.length);
+      });
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -29,14 +30,19 @@
 #include "arrow/dataset/projector.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/future.h"
 #include "arrow/util/type_fwd.h"
 
 namespace arrow {
 namespace dataset {
 
 constexpr int64_t kDefaultBatchSize = 1 << 20;
+constexpr int32_t kDefaultFragmentReadahead = 4;
+constexpr int32_t kDefaultScanTaskReadahead = 16;
+constexpr int64_t kDefaultReadaheadBytes = 64 << 20;
 
 /// \brief Shared state for a Scan operation
 struct ARROW_DS_EXPORT ScanContext {
@@ -46,6 +52,9 @@ struct ARROW_DS_EXPORT ScanContext {
   /// Indicate if the Scanner should make use of a ThreadPool.
   bool use_threads = false;
 
+  /// Where fragments are opened and their data prefetched by an asynchronous scan.
+  io::AsyncContext io_context;
+
   /// Return a threaded or serial TaskGroup according to use_threads.
   std::shared_ptr<internal::TaskGroup> TaskGroup() const;
 };
@@ -74,6 +83,22 @@ class ARROW_DS_EXPORT ScanOptions {
   // Maximum row count for scanned batches.
   int64_t batch_size = kDefaultBatchSize;
 
+  // Readahead of an asynchronous scan (see Scanner::ScanBatchesAsync).
+  //
+  // Maximum number of Fragments being opened ahead of the one being consumed.
+  int32_t fragment_readahead = kDefaultFragmentReadahead;
+  // Maximum number of ScanTasks (e.g. Parquet row groups) being prefetched or
+  // decoded ahead of the one being consumed.
+  int32_t scan_task_readahead = kDefaultScanTaskReadahead;
+  // Budget of bytes in flight: prefetched data of ScanTasks not executed yet and
+  // decoded batches not consumed yet. No further ScanTask is started while it is
+  // exceeded, but one is always in flight.
+  int64_t readahead_bytes = kDefaultReadaheadBytes;
+  // Whether batches are yielded in the order of Fragments and of their ScanTasks
+  // (e.g. Parquet row groups). Otherwise each ScanTask's batches are yielded as soon
+  // as it completes.
+  bool preserve_order = true;
+
   // Return a vector of fields that requires materialization.
   //
   // This is usually the union of the fields referenced in the projection and the
@@ -104,6 +129,16 @@ class ARROW_DS_EXPORT ScanTask {
   /// particular ScanTask implementation
   virtual Result<RecordBatchIterator> Execute() = 0;
 
+  /// \brief Start fetching the data which Execute() will read, without blocking.
+  ///
+  /// The returned Future completes once Execute() can proceed without waiting on
+  /// I/O.  The default implementation fetches nothing and returns a finished Future.
+  virtual Future<> Prefetch(const io::AsyncContext& io_context);
+
+  /// \brief Estimate the bytes held in memory by Prefetch() until the task is
+  /// consumed, or 0 if unknown.
+  virtual int64_t EstimatedPrefetchBytes() const { return 0; }
+
   virtual ~ScanTask() = default;
 
   const std::shared_ptr<ScanOptions>& options() const { return options_; }
@@ -136,6 +171,11 @@ ARROW_DS_EXPORT Result<ScanTaskIterator> ScanTaskIteratorFromRecordBatch(
     std::vector<std::shared_ptr<RecordBatch>> batches,
     std::shared_ptr<ScanOptions> options, std::shared_ptr<ScanContext>);
 
+/// \brief An asynchronous stream of RecordBatches: each call returns a Future of the
+/// next batch, or of null at the end of the stream.  The next call must not be made
+/// before the previous Future completed.
+using RecordBatchGenerator = std::function<Future<std::shared_ptr<RecordBatch>>()>;
+
 /// \brief Scanner is a materialized scan operation with context and options
 /// bound. A scanner is the class that glues ScanTask, Fragment,
 /// and Dataset. In python pseudo code, it performs the following:
@@ -163,10 +203,31 @@ class ARROW_DS_EXPORT Scanner {
   /// in a concurrent fashion and outlive the iterator.
   Result<ScanTaskIterator> Scan();
 
+  /// \brief Scan asynchronously, yielding the scanned batches in order unless
+  /// ScanOptions::preserve_order is false.
+  ///
+  /// Fragments are opened and ScanTasks prefetched on the ScanContext's io_context
+  /// ahead of the consumer, within the readahead limits of the ScanOptions, so that
+  /// I/O overlaps with decoding.  With use_threads, ScanTasks are executed on the CPU
+  /// thread pool as soon as their data is prefetched; otherwise each is executed by
+  /// the call which consumes it.
+  ///
+  /// Only the consumer's calls start further ScanTasks, so a slow consumer holds
+  /// back the scan: at most readahead_bytes of prefetched data and decoded batches
+  /// are in flight, plus the ScanTask which exceeded the budget.
+  Result<RecordBatchGenerator> ScanBatchesAsync();
+
+  /// \brief Stream the scanned batches through a RecordBatchReader.
+  ///
+  /// The reader wraps ScanBatchesAsync, blocking in ReadNext until the next batch is
+  /// available, so that a scan can be streamed out without materializing it.
+  Result<std::shared_ptr<RecordBatchReader>> ToRecordBatchReader();
+
   /// \brief Convert a Scanner into a Table.
   ///
-  /// Use this convenience utility with care. This will serially materialize the
-  /// Scan result in memory before creating the Table.
+  /// Use this convenience utility with care. This will materialize the whole Scan
+  /// result in memory before creating the Table.  With use_threads the asynchronous
+  /// scan is used.
   Result<std::shared_ptr<Table>> ToTable();
 
   /// \brief GetFragments returns an iterator over all Fragments in this scan.
@@ -234,6 +295,26 @@ class ARROW_DS_EXPORT ScannerBuilder {
   /// This option provides a control limiting the memory owned by any RecordBatch.
   Status BatchSize(int64_t batch_size);
 
+  /// \brief Set the number of Fragments an asynchronous scan opens ahead.
+  ///
+  /// \returns An error if the number is not greater than 0.
+  Status FragmentReadahead(int32_t fragment_readahead);
+
+  /// \brief Set the number of ScanTasks an asynchronous scan prefetches ahead.
+  ///
+  /// \returns An error if the number is not greater than 0.
+  Status ScanTaskReadahead(int32_t scan_task_readahead);
+
+  /// \brief Set the budget of bytes an asynchronous scan holds in flight, counting
+  /// both prefetched data and decoded batches which are not consumed yet.
+  ///
+  /// \returns An error if the number of bytes is negative.
+  Status ReadaheadBytes(int64_t readahead_bytes);
+
+  /// \brief Indicate if an asynchronous scan should yield batches in the order of
+  ///        Fragments and ScanTasks, rather than as soon as they are available.
+  Status PreserveOrder(bool preserve_order = true);
+
   /// \brief Return the constructed now-immutable Scanner object
   Result<std::shared_ptr<Scanner>> Finish() const;
 
@@ -249,5 +330,47 @@ class ARROW_DS_EXPORT ScannerBuilder {
   std::vector<std::string> project_columns_;
 };
 
+/// \defgroup dataset-exec-nodes ExecPlan nodes for datasets
+///
+/// @{
+
+/// \brief Add a source node to an ExecPlan which pushes the batches of a Scanner.
+///
+/// The Scanner's filter and projection are applied by its ScanTasks, so the
+/// node's output schema is the Scanner's schema.  The Scanner is scanned
+/// asynchronously (see Scanner::ScanBatchesAsync), and each scanned batch is
+/// sliced into morsels of at most compute::kDefaultExecChunksize rows before
+/// being pushed, so that downstream nodes work on cache-sized batches
+/// regardless of the Scanner's batch_size.
+ARROW_DS_EXPORT
+Result<compute::ExecNode*> MakeScanNode(compute::ExecPlan* plan,
+                                        std::shared_ptr<Scanner> scanner,
+                                        std::string label = "scan");
+
+/// \brief Add a node which keeps the rows of each batch for which a filter
+/// expression evaluates to true.
+///
+/// The kept rows are not copied out. Instead each batch is forwarded with a
+/// selection vector (composed with any selection it already carried), and rows
+/// are gathered only where a downstream node needs them materialized.
+ARROW_DS_EXPORT
+Result<compute::ExecNode*> MakeFilterNode(compute::ExecNode* input, std::string label,
+                                          Expression filter);
+
+/// \brief Add a node which evaluates one expression per output column on
+/// each batch.
+///
+/// \param[in] input the node to project
+/// \param[in] label the node's label
+/// \param[in] exprs the scalar expressions to evaluate
+/// \param[in] names the output field names, defaulting to the expressions'
+///            string representations
+ARROW_DS_EXPORT
+Result<compute::ExecNode*> MakeProjectNode(compute::ExecNode* input, std::string label,
+                                           std::vector<Expression> exprs,
+                                           std::vector<std::string> names = {});
+
+/// @}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -30,26 +30,32 @@
 namespace arrow {
 namespace dataset {
 
+/// \brief Return the rows of a RecordBatch for which a bound filter is true
+inline Result<std::shared_ptr<RecordBatch>> FilterSingleBatch(
+    std::shared_ptr<RecordBatch> in, const Expression& filter,
+    compute::ExecContext* exec_context) {
+  ARROW_ASSIGN_OR_RAISE(Datum mask,
+                        ExecuteFilterExpression(filter, Datum(in), exec_context));
+
+  if (mask.is_scalar()) {
+    if (mask.scalar_as<BooleanScalar>().value) {
+      return std::move(in);
+    }
+    return in->Slice(0, 0);
+  }
+
+  ARROW_ASSIGN_OR_RAISE(
+      Datum filtered,
+      compute::Filter(in, mask, compute::FilterOptions::Defaults(), exec_context));
+  return filtered.record_batch();
+}
+
 inline RecordBatchIterator FilterRecordBatch(RecordBatchIterator it, Expression filter,
                                              MemoryPool* pool) {
   return MakeMaybeMapIterator(
       [=](std::shared_ptr<RecordBatch> in) -> Result<std::shared_ptr<RecordBatch>> {
         compute::ExecContext exec_context{pool};
-        ARROW_ASSIGN_OR_RAISE(Datum mask,
-                              ExecuteScalarExpression(filter, Datum(in), &exec_context));
-
-        if (mask.is_scalar()) {
-          const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
-          if (mask_scalar.is_valid && mask_scalar.value) {
-            return std::move(in);
-          }
-          return in->Slice(0, 0);
-        }
-
-        ARROW_ASSIGN_OR_RAISE(
-            Datum filtered,
-            compute::Filter(in, mask, compute::FilterOptions::Defaults(), &exec_context));
-        return filtered.record_batch();
+        return FilterSingleBatch(std::move(in), filter, &exec_context);
       },
       std::move(it));
 }
@@ -92,6 +98,14 @@ class FilterAndProjectScanTask : public ScanTask {
     return ProjectRecordBatch(std::move(filter_it), &projector_, context_->pool);
   }
 
+  Future<> Prefetch(const io::AsyncContext& io_context) override {
+    return task_->Prefetch(io_context);
+  }
+
+  int64_t EstimatedPrefetchBytes() const override {
+    return task_->EstimatedPrefetchBytes();
+  }
+
  private:
   std::shared_ptr<ScanTask> task_;
   Expression partition_;
@@ -99,6 +113,25 @@ class FilterAndProjectScanTask : public ScanTask {
   RecordBatchProjector projector_;
 };
 
+/// \brief Scan a Fragment, wrapping its ScanTasks so that they yield filtered and
+/// projected RecordBatches.
+inline Result<ScanTaskIterator> ScanFragment(const std::shared_ptr<Fragment>& fragment,
+                                             std::shared_ptr<ScanOptions> options,
+                                             std::shared_ptr<ScanContext> context) {
+  ARROW_ASSIGN_OR_RAISE(auto scan_task_it,
+                        fragment->Scan(std::move(options), std::move(context)));
+
+  auto partition = fragment->partition_expression();
+  // Apply the filter and/or projection to incoming RecordBatches by
+  // wrapping the ScanTask with a FilterAndProjectScanTask
+  auto wrap_scan_task =
+      [partition](std::shared_ptr<ScanTask> task) -> std::shared_ptr<ScanTask> {
+    return std::make_shared<FilterAndProjectScanTask>(std::move(task), partition);
+  };
+
+  return MakeMapIterator(wrap_scan_task, std::move(scan_task_it));
+}
+
 /// \brief GetScanTaskIterator transforms an Iterator<Fragment> in a
 /// flattened Iterator<ScanTask>.
 inline Result<ScanTaskIterator> GetScanTaskIterator(
@@ -107,17 +140,7 @@ inline Result<ScanTaskIterator> GetScanTaskIterator(
   // Fragment -> ScanTaskIterator
   auto fn = [options,
              context](std::shared_ptr<Fragment> fragment) -> Result<ScanTaskIterator> {
-    ARROW_ASSIGN_OR_RAISE(auto scan_task_it, fragment->Scan(options, context));
-
-    auto partition = fragment->partition_expression();
-    // Apply the filter and/or projection to incoming RecordBatches by
-    // wrapping the ScanTask with a FilterAndProjectScanTask
-    auto wrap_scan_task =
-        [partition](std::shared_ptr<ScanTask> task) -> std::shared_ptr<ScanTask> {
-      return std::make_shared<FilterAndProjectScanTask>(std::move(task), partition);
-    };
-
-    return MakeMapIterator(wrap_scan_task, std::move(scan_task_it));
+    return ScanFragment(fragment, options, context);
   };
 
   // Iterator<Iterator<ScanTask>>
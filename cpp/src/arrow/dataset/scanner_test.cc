@@ -17,8 +17,13 @@
 
 #include "arrow/dataset/scanner.h"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <string>
+#include <vector>
 
+#include "arrow/compute/exec/exec_plan.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
@@ -54,6 +59,35 @@ class TestScanner : public DatasetFixtureMixin {
     // Verifies that the unified BatchReader is equivalent to flattening all the
     // structures of the scanner, i.e. Scanner[Dataset[ScanTask[RecordBatch]]]
     AssertScannerEquals(expected.get(), &scanner);
+
+    // The asynchronous scan yields the same batches in the same order
+    for (bool use_threads : {false, true}) {
+      scanner.context()->use_threads = use_threads;
+      expected = ConstantArrayGenerator::Repeat(total_batches, batch);
+      AssertScanBatchesAsyncEquals(expected.get(), &scanner);
+
+      expected = ConstantArrayGenerator::Repeat(total_batches, batch);
+      ASSERT_OK_AND_ASSIGN(auto reader, scanner.ToRecordBatchReader());
+      AssertReaderEquals(expected.get(), reader.get());
+
+      // All batches are equal, so their order doesn't matter
+      scanner.options()->preserve_order = false;
+      expected = ConstantArrayGenerator::Repeat(total_batches, batch);
+      AssertScanBatchesAsyncEquals(expected.get(), &scanner);
+      scanner.options()->preserve_order = true;
+    }
+  }
+
+  void AssertReaderEquals(RecordBatchReader* expected, RecordBatchReader* actual) {
+    std::shared_ptr<RecordBatch> lhs, rhs;
+    while (true) {
+      ASSERT_OK(expected->ReadNext(&lhs));
+      ASSERT_OK(actual->ReadNext(&rhs));
+      if (lhs == nullptr) break;
+      ASSERT_NE(rhs, nullptr);
+      AssertBatchesEqual(*lhs, *rhs);
+    }
+    ASSERT_EQ(rhs, nullptr);
   }
 };
 
@@ -146,6 +180,414 @@ TEST_F(TestScanner, ToTable) {
   AssertTablesEqual(*expected, *actual);
 }
 
+// A ScanTask whose prefetch is completed by the test
+class ManualPrefetchScanTask : public ScanTask {
+ public:
+  ManualPrefetchScanTask(std::shared_ptr<RecordBatch> batch, int64_t bytes,
+                         std::shared_ptr<ScanOptions> options,
+                         std::shared_ptr<ScanContext> context)
+      : ScanTask(std::move(options), std::move(context)),
+        batch_(std::move(batch)),
+        bytes_(bytes),
+        prefetched_(Future<>::Make()) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    if (!prefetched_.is_finished()) {
+      return Status::Invalid("Executed before the prefetch completed");
+    }
+    return MakeVectorIterator(RecordBatchVector{batch_});
+  }
+
+  Future<> Prefetch(const io::AsyncContext&) override {
+    started_ = true;
+    return prefetched_;
+  }
+
+  int64_t EstimatedPrefetchBytes() const override { return bytes_; }
+
+  bool started() const { return started_; }
+  void Complete(Status st = Status::OK()) {
+    if (!prefetched_.is_finished()) prefetched_.MarkFinished(std::move(st));
+  }
+
+ private:
+  std::shared_ptr<RecordBatch> batch_;
+  int64_t bytes_;
+  Future<> prefetched_;
+  std::atomic<bool> started_{false};
+};
+
+class ManualPrefetchFragment : public Fragment {
+ public:
+  explicit ManualPrefetchFragment(std::vector<std::shared_ptr<ScanTask>> tasks)
+      : tasks_(std::move(tasks)) {}
+
+  Result<ScanTaskIterator> Scan(std::shared_ptr<ScanOptions>,
+                                std::shared_ptr<ScanContext>) override {
+    return MakeVectorIterator(tasks_);
+  }
+
+  bool splittable() const override { return false; }
+  std::string type_name() const override { return "manual-prefetch"; }
+
+ protected:
+  Result<std::shared_ptr<Schema>> ReadPhysicalSchemaImpl() override {
+    return Status::NotImplemented("physical schema");
+  }
+
+  std::vector<std::shared_ptr<ScanTask>> tasks_;
+};
+
+class TestAsyncScanner : public TestScanner {
+ protected:
+  void SetUp() override { SetSchema({field("i32", int32())}); }
+
+  void MakeTasks(int num_tasks, int64_t bytes_per_task) {
+    for (int i = 0; i < num_tasks; ++i) {
+      auto batch = RecordBatchFromJSON(schema_, "[{\"i32\": " + std::to_string(i) + "}]");
+      tasks_.push_back(std::make_shared<ManualPrefetchScanTask>(batch, bytes_per_task,
+                                                                options_, ctx_));
+    }
+    std::vector<std::shared_ptr<ScanTask>> tasks(tasks_.begin(), tasks_.end());
+    scanner_ = std::make_shared<Scanner>(
+        std::make_shared<ManualPrefetchFragment>(std::move(tasks)), options_, ctx_);
+  }
+
+  int NumStarted() {
+    int started = 0;
+    for (const auto& task : tasks_) {
+      started += task->started();
+    }
+    return started;
+  }
+
+  // Opening fragments is asynchronous, so the first prefetches start in the
+  // background
+  void WaitForStarted(int expected) {
+    for (int i = 0; i < 10000 && NumStarted() < expected; ++i) {
+      SleepFor(1e-3);
+    }
+    // Make sure no more than expected are started
+    SleepFor(1e-2);
+    ASSERT_EQ(NumStarted(), expected);
+  }
+
+  void CompleteAll() {
+    for (const auto& task : tasks_) {
+      if (task->started()) task->Complete();
+    }
+  }
+
+  std::vector<std::shared_ptr<ManualPrefetchScanTask>> tasks_;
+  std::shared_ptr<Scanner> scanner_;
+};
+
+TEST_F(TestAsyncScanner, ReadaheadLimits) {
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+    options_->scan_task_readahead = 3;
+    options_->readahead_bytes = 1000;
+    tasks_.clear();
+    MakeTasks(8, 100);
+    ASSERT_OK_AND_ASSIGN(auto batches, scanner_->ScanBatchesAsync());
+
+    auto next = batches();
+    WaitForStarted(3);
+    ASSERT_FALSE(next.is_finished());
+
+    // Batches are yielded in order, even if later prefetches complete first
+    tasks_[1]->Complete();
+    tasks_[0]->Complete();
+    ASSERT_OK_AND_ASSIGN(auto batch, next.result());
+    AssertBatchesEqual(*RecordBatchFromJSON(schema_, R"([{"i32": 0}])"), *batch);
+
+    // Each consumed task makes room for another
+    next = batches();
+    ASSERT_OK_AND_ASSIGN(batch, next.result());
+    AssertBatchesEqual(*RecordBatchFromJSON(schema_, R"([{"i32": 1}])"), *batch);
+    ASSERT_EQ(NumStarted(), 5);
+
+    for (int i = 2; i < 8; ++i) {
+      next = batches();
+      tasks_[i]->Complete();
+      ASSERT_OK_AND_ASSIGN(batch, next.result());
+      ASSERT_EQ(batch->num_rows(), 1);
+    }
+    next = batches();
+    ASSERT_OK_AND_ASSIGN(batch, next.result());
+    ASSERT_EQ(batch, nullptr);
+  }
+}
+
+TEST_F(TestAsyncScanner, ReadaheadBytes) {
+  options_->scan_task_readahead = 100;
+  options_->readahead_bytes = 150;
+  MakeTasks(4, 100);
+  ASSERT_OK_AND_ASSIGN(auto batches, scanner_->ScanBatchesAsync());
+
+  // The budget is exceeded once two tasks are started
+  auto next = batches();
+  WaitForStarted(2);
+
+  // Consuming a task releases its bytes
+  tasks_[0]->Complete();
+  ASSERT_OK(next.status());
+  next = batches();
+  ASSERT_EQ(NumStarted(), 3);
+
+  CompleteAll();
+  ASSERT_OK(next.status());
+}
+
+TEST_F(TestAsyncScanner, ReadaheadBytesBelowTaskSize) {
+  // A task is always in flight, even if it exceeds the budget alone
+  options_->readahead_bytes = 0;
+  MakeTasks(4, 100);
+  ASSERT_OK_AND_ASSIGN(auto batches, scanner_->ScanBatchesAsync());
+
+  auto next = batches();
+  WaitForStarted(1);
+  CompleteAll();
+  ASSERT_OK(next.status());
+}
+
+TEST_F(TestAsyncScanner, DecodedBytes) {
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+    options_->scan_task_readahead = 2;
+    options_->readahead_bytes = 1;
+    tasks_.clear();
+    MakeTasks(4, 0);
+    ASSERT_OK_AND_ASSIGN(auto batches, scanner_->ScanBatchesAsync());
+
+    auto next = batches();
+    WaitForStarted(2);
+    CompleteAll();
+    ASSERT_OK(next.status());
+    // Decoded batches which are not consumed yet hold back further tasks
+    WaitForStarted(2);
+
+    for (int i = 1; i < 4; ++i) {
+      next = batches();
+      CompleteAll();
+      ASSERT_OK_AND_ASSIGN(auto batch, next.result());
+      ASSERT_NE(batch, nullptr);
+    }
+    next = batches();
+    ASSERT_OK_AND_ASSIGN(auto batch, next.result());
+    ASSERT_EQ(batch, nullptr);
+  }
+}
+
+TEST_F(TestAsyncScanner, Unordered) {
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+    options_->preserve_order = false;
+    tasks_.clear();
+    MakeTasks(3, 0);
+    ASSERT_OK_AND_ASSIGN(auto batches, scanner_->ScanBatchesAsync());
+
+    // Batches are yielded as their tasks complete
+    auto next = batches();
+    WaitForStarted(3);
+    tasks_[2]->Complete();
+    ASSERT_OK_AND_ASSIGN(auto batch, next.result());
+    AssertBatchesEqual(*RecordBatchFromJSON(schema_, R"([{"i32": 2}])"), *batch);
+
+    next = batches();
+    tasks_[0]->Complete();
+    ASSERT_OK_AND_ASSIGN(batch, next.result());
+    AssertBatchesEqual(*RecordBatchFromJSON(schema_, R"([{"i32": 0}])"), *batch);
+
+    next = batches();
+    tasks_[1]->Complete();
+    ASSERT_OK_AND_ASSIGN(batch, next.result());
+    AssertBatchesEqual(*RecordBatchFromJSON(schema_, R"([{"i32": 1}])"), *batch);
+
+    next = batches();
+    ASSERT_OK_AND_ASSIGN(batch, next.result());
+    ASSERT_EQ(batch, nullptr);
+  }
+}
+
+TEST_F(TestAsyncScanner, RecordBatchReader) {
+  ctx_->use_threads = true;
+  options_->scan_task_readahead = 1;
+  MakeTasks(3, 0);
+  for (const auto& task : tasks_) {
+    task->Complete();
+  }
+  ASSERT_OK_AND_ASSIGN(auto reader, scanner_->ToRecordBatchReader());
+  AssertSchemaEqual(*schema_, *reader->schema());
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatchReader(reader.get()));
+  AssertTablesEqual(*TableFromJSON(schema_, {R"([{"i32": 0}, {"i32": 1}, {"i32": 2}])"}),
+                    *table, /*same_chunk_layout=*/false);
+}
+
+TEST_F(TestAsyncScanner, PrefetchError) {
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+    tasks_.clear();
+    MakeTasks(3, 0);
+    ASSERT_OK_AND_ASSIGN(auto batches, scanner_->ScanBatchesAsync());
+    tasks_[0]->Complete();
+    tasks_[1]->Complete(Status::IOError("prefetch failed"));
+    tasks_[2]->Complete();
+
+    auto next = batches();
+    ASSERT_OK(next.status());
+    next = batches();
+    ASSERT_RAISES(IOError, next.status());
+  }
+}
+
+TEST_F(TestScanner, ExecPlanScanFilterProjectAggregate) {
+  SetSchema({field("i32", int32()), field("f64", float64())});
+  int32_t i = 0;
+  ASSERT_OK_AND_ASSIGN(auto i32, ArrayFromBuilderVisitor(int32(), kBatchSize,
+                                                         [&](Int32Builder* builder) {
+                                                           builder->UnsafeAppend(i++);
+                                                         }));
+  double value = 0;
+  ASSERT_OK_AND_ASSIGN(auto f64, ArrayFromBuilderVisitor(float64(), kBatchSize,
+                                                         [&](DoubleBuilder* builder) {
+                                                           builder->UnsafeAppend(value);
+                                                           value += 0.5;
+                                                         }));
+  auto batch = RecordBatch::Make(schema_, kBatchSize, {i32, f64});
+  auto scanner = std::make_shared<Scanner>(MakeScanner(batch));
+
+  for (bool use_threads : {false, true}) {
+    compute::ExecContext exec_context;
+    exec_context.set_use_threads(use_threads);
+    ASSERT_OK_AND_ASSIGN(auto plan, compute::ExecPlan::Make(&exec_context));
+
+    ASSERT_OK_AND_ASSIGN(auto scan, MakeScanNode(plan.get(), scanner));
+    ASSERT_OK_AND_ASSIGN(
+        auto filter,
+        MakeFilterNode(scan, "filter", less(field_ref("i32"), literal(100))));
+    ASSERT_OK_AND_ASSIGN(
+        auto project,
+        MakeProjectNode(filter, "project",
+                        {call("multiply", {field_ref("f64"), literal(2.0)}),
+                         field_ref("i32")},
+                        {"f64_x2", "i32"}));
+    ASSERT_OK_AND_ASSIGN(auto aggregate,
+                         compute::MakeScalarAggregateNode(
+                             project, "aggregate", {{"sum", nullptr}, {"sum", nullptr}}));
+
+    std::vector<compute::ExecBatch> results;
+    ASSERT_OK(compute::MakeSinkNode(aggregate, "sink", [&](compute::ExecBatch batch) {
+                results.push_back(std::move(batch));
+                return Status::OK();
+              }).status());
+
+    ASSERT_OK(plan->StartProducing());
+    auto finished = plan->finished();
+    finished.Wait();
+    ASSERT_OK(finished.status());
+
+    const int64_t expected_sum = 4950 * kNumberChildDatasets * kNumberBatches;
+    ASSERT_EQ(results.size(), 1);
+    AssertScalarsEqual(DoubleScalar(static_cast<double>(expected_sum)),
+                       *results[0].values[0].scalar());
+    AssertScalarsEqual(Int64Scalar(expected_sum), *results[0].values[1].scalar());
+  }
+}
+
+TEST_F(TestScanner, ExecPlanChainedFilters) {
+  SetSchema({field("i32", int32()), field("f64", float64()), field("str", utf8())});
+  auto batch = RecordBatchFromJSON(schema_, R"([
+    {"i32": 0, "f64": 0.5, "str": "a"},
+    {"i32": 1, "f64": 1.5, "str": "b"},
+    {"i32": 2, "f64": null, "str": "c"},
+    {"i32": 3, "f64": 3.5, "str": null},
+    {"i32": 4, "f64": 4.5, "str": "e"},
+    {"i32": null, "f64": 5.5, "str": "f"},
+    {"i32": 6, "f64": 6.5, "str": "g"}
+  ])");
+  auto dataset = std::make_shared<InMemoryDataset>(schema_, RecordBatchVector{batch});
+  auto scanner = std::make_shared<Scanner>(dataset, options_, ctx_);
+
+  ASSERT_OK_AND_ASSIGN(auto plan, compute::ExecPlan::Make());
+  ASSERT_OK_AND_ASSIGN(auto scan, MakeScanNode(plan.get(), scanner));
+  ASSERT_OK_AND_ASSIGN(
+      auto first, MakeFilterNode(scan, "first", greater(field_ref("i32"), literal(0))));
+  // The second filter's selection is composed with the first's
+  ASSERT_OK_AND_ASSIGN(auto second,
+                       MakeFilterNode(first, "second",
+                                      not_equal(field_ref("f64"), literal(4.5))));
+  ASSERT_OK_AND_ASSIGN(
+      auto project,
+      MakeProjectNode(second, "project",
+                      {field_ref("str"), call("add", {field_ref("i32"), literal(10)})},
+                      {"str", "i32"}));
+
+  std::vector<compute::ExecBatch> results;
+  ASSERT_OK(compute::MakeSinkNode(project, "sink", [&](compute::ExecBatch batch) {
+              results.push_back(std::move(batch));
+              return Status::OK();
+            }).status());
+  ASSERT_OK(plan->StartProducing());
+  auto finished = plan->finished();
+  finished.Wait();
+  ASSERT_OK(finished.status());
+
+  ASSERT_EQ(results.size(), 1);
+  auto out_schema = schema({field("str", utf8()), field("i32", int32())});
+  ASSERT_OK_AND_ASSIGN(auto actual, results[0].ToRecordBatch(out_schema));
+  AssertBatchesEqual(*RecordBatchFromJSON(out_schema, R"([
+    {"str": "b", "i32": 11},
+    {"str": null, "i32": 13},
+    {"str": "g", "i32": 16}
+  ])"),
+                     *actual);
+}
+
+TEST_F(TestScanner, ExecPlanScanMorsels) {
+  SetSchema({field("i32", int32())});
+  const int64_t length = compute::kDefaultExecChunksize + 10;
+  auto batch = ConstantArrayGenerator::Zeroes(length, schema_);
+  auto dataset = std::make_shared<InMemoryDataset>(schema_, RecordBatchVector{batch});
+  auto scanner = std::make_shared<Scanner>(dataset, options_, ctx_);
+
+  ASSERT_OK_AND_ASSIGN(auto plan, compute::ExecPlan::Make());
+  ASSERT_OK_AND_ASSIGN(auto scan, MakeScanNode(plan.get(), scanner));
+  AssertSchemaEqual(*schema_, *scan->output_schema());
+
+  std::vector<int64_t> lengths;
+  ASSERT_OK(compute::MakeSinkNode(scan, "sink", [&](compute::ExecBatch batch) {
+              lengths.push_back(batch.length);
+              return Status::OK();
+            }).status());
+  ASSERT_OK(plan->StartProducing());
+  auto finished = plan->finished();
+  finished.Wait();
+  ASSERT_OK(finished.status());
+
+  std::sort(lengths.begin(), lengths.end());
+  ASSERT_EQ(lengths, (std::vector<int64_t>{10, compute::kDefaultExecChunksize}));
+}
+
+TEST_F(TestScanner, ExecPlanNodeErrors) {
+  SetSchema({field("i32", int32())});
+  auto scanner = std::make_shared<Scanner>(
+      MakeScanner(ConstantArrayGenerator::Zeroes(kBatchSize, schema_)));
+  ASSERT_OK_AND_ASSIGN(auto plan, compute::ExecPlan::Make());
+  ASSERT_OK_AND_ASSIGN(auto scan, MakeScanNode(plan.get(), scanner));
+
+  ASSERT_RAISES(TypeError, MakeFilterNode(scan, "filter", field_ref("i32")));
+  ASSERT_RAISES(Invalid, MakeFilterNode(scan, "filter", field_ref("nonexistent")));
+  ASSERT_RAISES(Invalid,
+                MakeProjectNode(scan, "project", {field_ref("i32")}, {"a", "b"}));
+  ASSERT_RAISES(Invalid, MakeFilterNode(nullptr, "filter", literal(true)));
+
+  ASSERT_OK_AND_ASSIGN(auto project,
+                       MakeProjectNode(scan, "project", {field_ref("i32")}));
+  AssertSchemaEqual(*schema({field(field_ref("i32").ToString(), int32())}),
+                    *project->output_schema());
+}
+
 class TestScannerBuilder : public ::testing::Test {
   void SetUp() override {
     DatasetVector sources;
@@ -181,6 +181,28 @@ class DatasetFixtureMixin : public ::testing::Test {
     }
   }
 
+  /// \brief Ensure that record batches found in reader are equals to the
+  /// record batches yielded by a scanner's asynchronous scan.
+  void AssertScanBatchesAsyncEquals(RecordBatchReader* expected, Scanner* scanner,
+                                    bool ensure_drained = true) {
+    ASSERT_OK_AND_ASSIGN(auto batches, scanner->ScanBatchesAsync());
+
+    while (true) {
+      auto next = batches();
+      ASSERT_OK_AND_ASSIGN(auto rhs, next.result());
+      if (rhs == nullptr) break;
+
+      std::shared_ptr<RecordBatch> lhs;
+      ASSERT_OK(expected->ReadNext(&lhs));
+      ASSERT_NE(lhs, nullptr);
+      AssertBatchesEqual(*lhs, *rhs);
+    }
+
+    if (ensure_drained) {
+      EnsureRecordBatchReaderDrained(expected);
+    }
+  }
+
   /// \brief Ensure that record batches found in reader are equals to the
   /// record batches yielded by a dataset.
   void AssertDatasetEquals(RecordBatchReader* expected, Dataset* dataset,
@@ -30,6 +30,8 @@ namespace arrow {
 namespace compute {
 
 class ExecContext;
+class ExecNode;
+class ExecPlan;
 
 }  // namespace compute
 
@@ -193,6 +193,15 @@ Result<std::shared_ptr<Buffer>> ReadRangeCache::Read(ReadRange range) {
   return Status::Invalid("ReadRangeCache did not find matching cache entry");
 }
 
+Future<> ReadRangeCache::Wait() {
+  std::vector<Future<>> futures;
+  futures.reserve(impl_->entries.size());
+  for (const auto& entry : impl_->entries) {
+    futures.emplace_back(entry.future);
+  }
+  return AllComplete(futures);
+}
+
 }  // namespace internal
 }  // namespace io
 }  // namespace arrow
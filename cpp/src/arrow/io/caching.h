@@ -99,6 +99,12 @@ class ARROW_EXPORT ReadRangeCache {
   /// \brief Read a range previously given to Cache().
   Result<std::shared_ptr<Buffer>> Read(ReadRange range);
 
+  /// \brief Return a Future which completes once all ranges given to Cache() so
+  /// far have been read.
+  ///
+  /// After it completes successfully, Read() does not block on I/O.
+  Future<> Wait();
+
  protected:
   struct Impl;
   std::unique_ptr<Impl> impl_;
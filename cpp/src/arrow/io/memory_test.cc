@@ -729,6 +729,19 @@ TEST(RangeReadCache, Basics) {
   ASSERT_RAISES(Invalid, cache.Read({25, 2}));
 }
 
+TEST(RangeReadCache, Wait) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  auto file = std::make_shared<BufferReader>(Buffer(data));
+  internal::ReadRangeCache cache(file, {}, CacheOptions::Defaults());
+  ASSERT_OK(cache.Wait().status());
+
+  ASSERT_OK(cache.Cache({{1, 2}, {20, 2}}));
+  ASSERT_OK(cache.Wait().status());
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({20, 2}));
+  AssertBufferEqual(*buf, "uv");
+}
+
 TEST(CacheOptions, Basics) {
   auto check = [](const CacheOptions actual, const double expected_hole_size_limit_MiB,
                   const double expected_range_size_limit_MiB) -> void {
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <vector>
 
+#include "arrow/io/caching.h"
 #include "arrow/ipc/type_fwd.h"
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
@@ -113,12 +114,28 @@ struct ARROW_EXPORT IpcReadOptions {
   ///
   /// If empty (the default), return all deserialized fields.
   /// If non-empty, the values are the indices of fields in the top-level schema.
+  /// RecordBatchFileReader then only reads the buffers of these fields from
+  /// the file.
   std::vector<int> included_fields;
 
   /// \brief Use global CPU thread pool to parallelize any computational tasks
   /// like decompression
   bool use_threads = true;
 
+  /// \brief Number of record batches read ahead by RecordBatchFileReader
+  ///
+  /// If greater than zero, reading a record batch from a file also starts
+  /// reading the following ones in the background. The reads of their blocks
+  /// are coalesced according to cache_options, and only fetch the buffers of
+  /// the included fields.
+  int prefetch_record_batches = 0;
+
+  /// \brief Options for coalescing the reads of RecordBatchFileReader
+  ///
+  /// Used when prefetching record batches or reading a subset of their fields.
+  /// Buffers separated by less than hole_size_limit bytes are read together.
+  io::CacheOptions cache_options = io::CacheOptions::Defaults();
+
   static IpcReadOptions Defaults();
 };
 
@@ -19,6 +19,7 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <unordered_set>
@@ -1568,6 +1569,169 @@ TEST(TestIpcFileFormat, FooterMetaData) {
   ASSERT_TRUE(out_metadata->Equals(*metadata));
 }
 
+TEST(TestIpcFileFormat, PrefetchRecordBatches) {
+  auto my_schema = schema({field("a0", int32()), field("a1", utf8()),
+                           field("a2", int64()), field("a3", list(int8()))});
+  BatchVector batches;
+  for (int i = 0; i < 7; ++i) {
+    auto value = std::to_string(i);
+    batches.push_back(RecordBatch::Make(
+        my_schema, 3,
+        {ArrayFromJSON(int32(), "[" + value + ", null, 1]"),
+         ArrayFromJSON(utf8(), "[\"" + value + "\", null, \"b\"]"),
+         ArrayFromJSON(int64(), "[null, " + value + ", 2]"),
+         ArrayFromJSON(list(int8()), "[[" + value + "], null, []]")}));
+  }
+
+  FileWriterHelper helper;
+  ASSERT_OK(helper.Init(my_schema, IpcWriteOptions::Defaults()));
+  for (const auto& batch : batches) {
+    ASSERT_OK(helper.WriteBatch(batch));
+  }
+  ASSERT_OK(helper.Finish());
+
+  auto options = IpcReadOptions::Defaults();
+  options.prefetch_record_batches = 3;
+  for (bool subset : {false, true}) {
+    if (subset) {
+      options.included_fields = {1, 3};
+    }
+    auto buf_reader = std::make_shared<io::BufferReader>(helper.buffer_);
+    ASSERT_OK_AND_ASSIGN(auto reader,
+                         RecordBatchFileReader::Open(buf_reader, options));
+    ASSERT_EQ(reader->num_record_batches(), static_cast<int>(batches.size()));
+
+    auto expected = [&](int i) {
+      if (!subset) return batches[i];
+      return RecordBatch::Make(reader->schema(), batches[i]->num_rows(),
+                               {batches[i]->column(1), batches[i]->column(3)});
+    };
+    // Sequential reads, both asynchronous and synchronous
+    for (int i = 0; i < reader->num_record_batches(); ++i) {
+      auto fut = reader->ReadRecordBatchAsync(i);
+      ASSERT_OK_AND_ASSIGN(auto batch, fut.result());
+      AssertBatchesEqual(*expected(i), *batch);
+    }
+    for (int i = 0; i < reader->num_record_batches(); ++i) {
+      ASSERT_OK_AND_ASSIGN(auto batch, reader->ReadRecordBatch(i));
+      AssertBatchesEqual(*expected(i), *batch);
+    }
+    // Random access restarts the prefetch window
+    for (int i : {5, 1, 6, 2, 3, 0, 0}) {
+      ASSERT_OK_AND_ASSIGN(auto batch, reader->ReadRecordBatch(i));
+      AssertBatchesEqual(*expected(i), *batch);
+    }
+    ASSERT_EQ(reader->stats().num_record_batches, 21);
+  }
+}
+
+// A file recording the ranges read from it
+class TrackedFile : public io::RandomAccessFile {
+ public:
+  explicit TrackedFile(std::shared_ptr<io::RandomAccessFile> file)
+      : file_(std::move(file)) {}
+
+  Status Close() override { return file_->Close(); }
+  bool closed() const override { return file_->closed(); }
+  Result<int64_t> Tell() const override { return file_->Tell(); }
+  Status Seek(int64_t position) override { return file_->Seek(position); }
+  Result<int64_t> GetSize() override { return file_->GetSize(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    return Status::NotImplemented("TrackedFile only supports ReadAt");
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    return Status::NotImplemented("TrackedFile only supports ReadAt");
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    RecordRead(position, nbytes);
+    return file_->ReadAt(position, nbytes, out);
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    RecordRead(position, nbytes);
+    return file_->ReadAt(position, nbytes);
+  }
+
+  std::vector<io::ReadRange> read_ranges() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return read_ranges_;
+  }
+
+  void ClearReadRanges() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    read_ranges_.clear();
+  }
+
+ private:
+  void RecordRead(int64_t position, int64_t nbytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    read_ranges_.push_back({position, nbytes});
+  }
+
+  std::shared_ptr<io::RandomAccessFile> file_;
+  std::mutex mutex_;
+  std::vector<io::ReadRange> read_ranges_;
+};
+
+TEST(TestIpcFileFormat, ReadFieldSubsetOnlyReadsIncludedBuffers) {
+  const int num_fields = 8;
+  const int64_t length = 10000;
+  random::RandomArrayGenerator rg(/*seed=*/0);
+  FieldVector fields;
+  ArrayVector columns;
+  for (int i = 0; i < num_fields; ++i) {
+    fields.push_back(field("f" + std::to_string(i), int64()));
+    columns.push_back(rg.Int64(length, 0, 1000, /*null_probability=*/0.1));
+  }
+  auto batch = RecordBatch::Make(schema(fields), length, columns);
+
+  FileWriterHelper helper;
+  ASSERT_OK(helper.Init(batch->schema(), IpcWriteOptions::Defaults()));
+  ASSERT_OK(helper.WriteBatch(batch));
+  ASSERT_OK(helper.Finish());
+
+  auto options = IpcReadOptions::Defaults();
+  options.included_fields = {2, 5};
+  auto expected = RecordBatch::Make(schema({fields[2], fields[5]}), length,
+                                    {columns[2], columns[5]});
+
+  auto ReadSize = [](const std::vector<io::ReadRange>& ranges) {
+    int64_t size = 0;
+    for (const auto& range : ranges) size += range.length;
+    return size;
+  };
+
+  // By default, the holes between the buffers of a field are small enough to
+  // be read over, but not the deselected fields between fields 2 and 5
+  const int64_t default_hole_size_limit = options.cache_options.hole_size_limit;
+  const int64_t large_hole_size_limit = 1 << 20;
+  for (int64_t hole_size_limit : {default_hole_size_limit, large_hole_size_limit}) {
+    options.cache_options.hole_size_limit = hole_size_limit;
+    const bool coalesced = hole_size_limit != default_hole_size_limit;
+    auto file = std::make_shared<TrackedFile>(
+        std::make_shared<io::BufferReader>(helper.buffer_));
+    ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(file, options));
+    file->ClearReadRanges();
+
+    ASSERT_OK_AND_ASSIGN(auto out_batch, reader->ReadRecordBatch(0));
+    AssertBatchesEqual(*expected, *out_batch);
+
+    // The metadata of the record batch, then the buffers of the two included
+    // fields, which are read together if the hole between them is small
+    auto ranges = file->read_ranges();
+    ASSERT_EQ(ranges.size(), coalesced ? 2 : 3);
+    const int64_t body_size = ReadSize(ranges) - ranges[0].length;
+    if (coalesced) {
+      ASSERT_GT(body_size, helper.buffer_->size() / 3);
+    } else {
+      ASSERT_LT(body_size, helper.buffer_->size() / 3);
+    }
+  }
+}
+
 // This test uses uninitialized memory
 
 #if !(defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER))
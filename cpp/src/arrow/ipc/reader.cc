@@ -23,6 +23,7 @@
 #include <cstring>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -31,8 +32,10 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/extension_type.h"
+#include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
 #include "arrow/ipc/util.h"
@@ -118,6 +121,18 @@ class ArrayLoader {
       : metadata_(metadata),
         metadata_version_(metadata_version),
         file_(file),
+        read_ranges_(NULLPTR),
+        max_recursion_depth_(options.max_recursion_depth) {}
+
+  // Instead of reading the buffers of the loaded arrays, which are left null,
+  // append their ranges within the message body to read_ranges
+  explicit ArrayLoader(const flatbuf::RecordBatch* metadata,
+                       MetadataVersion metadata_version, const IpcReadOptions& options,
+                       std::vector<io::ReadRange>* read_ranges)
+      : metadata_(metadata),
+        metadata_version_(metadata_version),
+        file_(NULLPTR),
+        read_ranges_(read_ranges),
         max_recursion_depth_(options.max_recursion_depth) {}
 
   Status ReadBuffer(int64_t offset, int64_t length, std::shared_ptr<Buffer>* out) {
@@ -135,6 +150,10 @@ class ArrayLoader {
       return Status::Invalid("Buffer ", buffer_index_,
                              " did not start on 8-byte aligned offset: ", offset);
     }
+    if (read_ranges_ != NULLPTR) {
+      read_ranges_->push_back({offset, length});
+      return Status::OK();
+    }
     return file_->ReadAt(offset, length).Value(out);
   }
 
@@ -359,6 +378,7 @@ class ArrayLoader {
   const flatbuf::RecordBatch* metadata_;
   const MetadataVersion metadata_version_;
   io::RandomAccessFile* file_;
+  std::vector<io::ReadRange>* read_ranges_;
   int max_recursion_depth_;
   int buffer_index_ = 0;
   int field_index_ = 0;
@@ -600,6 +620,133 @@ Result<std::shared_ptr<RecordBatch>> ReadRecordBatchInternal(
                          file);
 }
 
+namespace {
+
+// Get the ranges of the message body holding the buffers of the fields of a
+// record batch selected by inclusion_mask (all of them if it is empty)
+Status GetRecordBatchBufferRanges(const Buffer& metadata,
+                                  const std::shared_ptr<Schema>& schema,
+                                  const std::vector<bool>& inclusion_mask,
+                                  const IpcReadOptions& options,
+                                  std::vector<io::ReadRange>* out) {
+  const flatbuf::Message* message = nullptr;
+  RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
+  auto batch = message->header_as_RecordBatch();
+  if (batch == nullptr) {
+    return Status::IOError(
+        "Header-type of flatbuffer-encoded Message is not RecordBatch.");
+  }
+
+  ArrayLoader loader(batch, internal::GetMetadataVersion(message->version()), options,
+                     out);
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    const Field& field = *schema->field(i);
+    ArrayData dummy;
+    if (inclusion_mask.empty() || inclusion_mask[i]) {
+      RETURN_NOT_OK(loader.Load(&field, &dummy));
+    } else {
+      RETURN_NOT_OK(loader.SkipField(&field));
+    }
+  }
+  return Status::OK();
+}
+
+// Get the flatbuffer metadata of a message from its metadata block in an IPC
+// file, i.e. with its length prefix and padding
+Result<std::shared_ptr<Buffer>> GetMessageMetadata(std::shared_ptr<Buffer> block) {
+  int64_t offset = 0;
+  int32_t length = -1;
+  if (block->size() >= static_cast<int64_t>(sizeof(int32_t))) {
+    length = BitUtil::FromLittleEndian(util::SafeLoadAs<int32_t>(block->data()));
+    offset += sizeof(int32_t);
+  }
+  if (length == internal::kIpcContinuationToken &&
+      block->size() >= static_cast<int64_t>(2 * sizeof(int32_t))) {
+    // Format since 0.15.0: continuation token followed by the length
+    length = BitUtil::FromLittleEndian(util::SafeLoadAs<int32_t>(block->data() + offset));
+    offset += sizeof(int32_t);
+  }
+  if (length <= 0 || offset + length > block->size()) {
+    return Status::Invalid("Invalid flatbuffer size ", length,
+                           " for message metadata block of size ", block->size());
+  }
+  return SliceBuffer(std::move(block), offset, length);
+}
+
+// Sort the given ranges and merge the overlapping ones, as required by
+// ReadRangeCache::Cache
+std::vector<io::ReadRange> MergeReadRanges(std::vector<io::ReadRange> ranges) {
+  std::sort(ranges.begin(), ranges.end(),
+            [](const io::ReadRange& a, const io::ReadRange& b) {
+              return a.offset < b.offset;
+            });
+  std::vector<io::ReadRange> merged;
+  for (const auto& range : ranges) {
+    if (range.length == 0) continue;
+    if (!merged.empty() && merged.back().offset + merged.back().length > range.offset) {
+      merged.back().length = std::max(merged.back().length,
+                                      range.offset + range.length - merged.back().offset);
+    } else {
+      merged.push_back(range);
+    }
+  }
+  return merged;
+}
+
+// A file over the body of an IPC message, whose buffers are read from the
+// ranges of the underlying file held by a ReadRangeCache
+class CachedMessageBody : public io::RandomAccessFile {
+ public:
+  CachedMessageBody(std::shared_ptr<io::internal::ReadRangeCache> cache,
+                    int64_t body_offset, int64_t body_length)
+      : cache_(std::move(cache)), body_offset_(body_offset), body_length_(body_length) {}
+
+  Status Close() override {
+    closed_ = true;
+    return Status::OK();
+  }
+
+  bool closed() const override { return closed_; }
+
+  Result<int64_t> Tell() const override {
+    return Status::NotImplemented("CachedMessageBody only supports ReadAt");
+  }
+
+  Status Seek(int64_t position) override {
+    return Status::NotImplemented("CachedMessageBody only supports ReadAt");
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    return Status::NotImplemented("CachedMessageBody only supports ReadAt");
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    return Status::NotImplemented("CachedMessageBody only supports ReadAt");
+  }
+
+  Result<int64_t> GetSize() override { return body_length_; }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(
+        nbytes, io::internal::ValidateReadRange(position, nbytes, body_length_));
+    return cache_->Read({body_offset_ + position, nbytes});
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(position, nbytes));
+    std::memcpy(out, buffer->data(), buffer->size());
+    return buffer->size();
+  }
+
+ private:
+  std::shared_ptr<io::internal::ReadRangeCache> cache_;
+  int64_t body_offset_;
+  int64_t body_length_;
+  bool closed_ = false;
+};
+
+}  // namespace
+
 // If we are selecting only certain fields, populate an inclusion mask for fast lookups.
 // Additionally, drop deselected fields from the reader's schema.
 Status GetInclusionMaskAndOutSchema(const std::shared_ptr<Schema>& full_schema,
@@ -916,7 +1063,9 @@ static inline FileBlock FileBlockFromFlatbuffer(const flatbuf::Block* block) {
   return FileBlock{block->offset(), block->metaDataLength(), block->bodyLength()};
 }
 
-class RecordBatchFileReaderImpl : public RecordBatchFileReader {
+class RecordBatchFileReaderImpl
+    : public RecordBatchFileReader,
+      public std::enable_shared_from_this<RecordBatchFileReaderImpl> {
  public:
   RecordBatchFileReaderImpl() : file_(NULLPTR), footer_offset_(0), footer_(NULLPTR) {}
 
@@ -932,11 +1081,21 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     DCHECK_GE(i, 0);
     DCHECK_LT(i, num_record_batches());
 
+    if (options_.prefetch_record_batches > 0) {
+      return ReadRecordBatchAsync(i).result();
+    }
+
     if (!read_dictionaries_) {
       RETURN_NOT_OK(ReadDictionaries());
       read_dictionaries_ = true;
     }
 
+    if (!field_inclusion_mask_.empty()) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, ReadRecordBatchSubset(GetRecordBatchBlock(i)));
+      ++stats_.num_record_batches;
+      return batch;
+    }
+
     ARROW_ASSIGN_OR_RAISE(auto message, ReadMessageFromBlock(GetRecordBatchBlock(i)));
 
     CHECK_HAS_BODY(*message);
@@ -949,6 +1108,35 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return batch;
   }
 
+  Future<std::shared_ptr<RecordBatch>> ReadRecordBatchAsync(int i) override {
+    using BatchFuture = Future<std::shared_ptr<RecordBatch>>;
+    DCHECK_GE(i, 0);
+    DCHECK_LT(i, num_record_batches());
+
+    if (options_.prefetch_record_batches <= 0) {
+      return BatchFuture::MakeFinished(ReadRecordBatch(i));
+    }
+
+    if (!read_dictionaries_) {
+      auto status = ReadDictionaries();
+      if (!status.ok()) {
+        return BatchFuture::MakeFinished(status);
+      }
+      read_dictionaries_ = true;
+    }
+
+    auto status = PrefetchRecordBatches(i);
+    if (!status.ok()) {
+      return BatchFuture::MakeFinished(status);
+    }
+    auto it = prefetched_batches_.find(i);
+    auto batch = std::move(it->second);
+    prefetched_batches_.erase(it);
+    ++stats_.num_messages;
+    ++stats_.num_record_batches;
+    return batch;
+  }
+
   Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
               const IpcReadOptions& options) {
     owned_file_ = file;
@@ -984,12 +1172,17 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return FileBlockFromFlatbuffer(footer_->dictionaries()->Get(i));
   }
 
-  Result<std::unique_ptr<Message>> ReadMessageFromBlock(const FileBlock& block) {
+  static Status CheckAligned(const FileBlock& block) {
     if (!BitUtil::IsMultipleOf8(block.offset) ||
         !BitUtil::IsMultipleOf8(block.metadata_length) ||
         !BitUtil::IsMultipleOf8(block.body_length)) {
       return Status::Invalid("Unaligned block in IPC file");
     }
+    return Status::OK();
+  }
+
+  Result<std::unique_ptr<Message>> ReadMessageFromBlock(const FileBlock& block) {
+    RETURN_NOT_OK(CheckAligned(block));
 
     // TODO(wesm): this breaks integration tests, see ARROW-3256
     // DCHECK_EQ((*out)->body_length(), block.body_length);
@@ -1075,6 +1268,144 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return static_cast<int>(internal::FlatBuffersVectorSize(footer_->dictionaries()));
   }
 
+  // The record batches of a file read together in the background
+  struct PrefetchWindow {
+    std::vector<FileBlock> blocks;
+    // The flatbuffer metadata of each record batch
+    std::vector<std::shared_ptr<Buffer>> metadata;
+    // The buffers of the included fields of all record batches
+    std::shared_ptr<io::internal::ReadRangeCache> body_cache;
+  };
+
+  // Make sure that record batch i is being read, along with up to
+  // prefetch_record_batches following ones. The reads of the next record
+  // batches are issued together once half of them were consumed, so that
+  // they can be coalesced.
+  Status PrefetchRecordBatches(int i) {
+    const int num_ahead = options_.prefetch_record_batches;
+    if (prefetched_batches_.find(i) == prefetched_batches_.end()) {
+      // Not read sequentially: start over from record batch i
+      prefetched_batches_.clear();
+      prefetch_end_ = i;
+    } else if (prefetch_end_ - i - 1 > num_ahead / 2) {
+      return Status::OK();
+    }
+    const int end = std::min(i + 1 + num_ahead, num_record_batches());
+    if (end <= prefetch_end_) {
+      return Status::OK();
+    }
+
+    std::shared_ptr<io::RandomAccessFile> file = SharedFile();
+
+    // First read the metadata of the record batches, which locate their
+    // buffers within their bodies, then the buffers of the included fields
+    auto window = std::make_shared<PrefetchWindow>();
+    std::vector<io::ReadRange> metadata_ranges;
+    for (int j = prefetch_end_; j < end; ++j) {
+      const FileBlock block = GetRecordBatchBlock(j);
+      RETURN_NOT_OK(CheckAligned(block));
+      window->blocks.push_back(block);
+      metadata_ranges.push_back({block.offset, block.metadata_length});
+    }
+    window->metadata.resize(window->blocks.size());
+    auto metadata_cache = std::make_shared<io::internal::ReadRangeCache>(
+        file, io::AsyncContext(), options_.cache_options);
+    RETURN_NOT_OK(metadata_cache->Cache(metadata_ranges));
+
+    auto self = shared_from_this();
+    Future<> window_read = metadata_cache->Wait().Then(
+        [self, file, window, metadata_cache](const detail::Empty&) -> Future<> {
+          auto status = self->CacheRecordBatchBodies(file, *metadata_cache, window.get());
+          if (!status.ok()) {
+            return Future<>::MakeFinished(status);
+          }
+          return window->body_cache->Wait();
+        });
+
+    for (int j = prefetch_end_; j < end; ++j) {
+      const size_t k = j - prefetch_end_;
+      auto read_batch = [self, window, k](const detail::Empty&) {
+        const FileBlock& block = window->blocks[k];
+        CachedMessageBody body(window->body_cache, block.offset + block.metadata_length,
+                               block.body_length);
+        return ReadRecordBatchInternal(*window->metadata[k], self->schema_,
+                                       self->field_inclusion_mask_,
+                                       &self->dictionary_memo_, self->options_, &body);
+      };
+      prefetched_batches_[j] = window_read.Then(std::move(read_batch));
+    }
+    prefetch_end_ = end;
+    return Status::OK();
+  }
+
+  // Parse the metadata of the record batches of the window, read by
+  // metadata_cache, and start reading the buffers of their included fields
+  Status CacheRecordBatchBodies(const std::shared_ptr<io::RandomAccessFile>& file,
+                                io::internal::ReadRangeCache& metadata_cache,
+                                PrefetchWindow* window) const {
+    std::vector<io::ReadRange> body_ranges;
+    for (size_t k = 0; k < window->blocks.size(); ++k) {
+      const FileBlock& block = window->blocks[k];
+      ARROW_ASSIGN_OR_RAISE(auto metadata_block,
+                            metadata_cache.Read({block.offset, block.metadata_length}));
+      ARROW_ASSIGN_OR_RAISE(window->metadata[k],
+                            GetMessageMetadata(std::move(metadata_block)));
+
+      RETURN_NOT_OK(GetBodyRanges(block, *window->metadata[k], &body_ranges));
+    }
+    window->body_cache = std::make_shared<io::internal::ReadRangeCache>(
+        file, io::AsyncContext(), options_.cache_options);
+    return window->body_cache->Cache(MergeReadRanges(std::move(body_ranges)));
+  }
+
+  // Append to out the ranges of the file holding the buffers of the included
+  // fields of the record batch with the given block and flatbuffer metadata
+  Status GetBodyRanges(const FileBlock& block, const Buffer& metadata,
+                       std::vector<io::ReadRange>* out) const {
+    std::vector<io::ReadRange> ranges;
+    RETURN_NOT_OK(GetRecordBatchBufferRanges(metadata, schema_, field_inclusion_mask_,
+                                             options_, &ranges));
+    const int64_t body_offset = block.offset + block.metadata_length;
+    for (const auto& range : ranges) {
+      if (range.offset + range.length > block.body_length) {
+        return Status::IOError("Buffer of record batch exceeds its body length");
+      }
+      out->push_back({body_offset + range.offset, range.length});
+    }
+    return Status::OK();
+  }
+
+  // Read a record batch with deselected fields, only reading the buffers of
+  // the included fields from the file. Nearby buffers are read together as
+  // configured by cache_options.
+  Result<std::shared_ptr<RecordBatch>> ReadRecordBatchSubset(const FileBlock& block) {
+    RETURN_NOT_OK(CheckAligned(block));
+    ARROW_ASSIGN_OR_RAISE(auto metadata_block,
+                          file_->ReadAt(block.offset, block.metadata_length));
+    ARROW_ASSIGN_OR_RAISE(auto metadata, GetMessageMetadata(std::move(metadata_block)));
+    ++stats_.num_messages;
+
+    std::vector<io::ReadRange> body_ranges;
+    RETURN_NOT_OK(GetBodyRanges(block, *metadata, &body_ranges));
+    auto body_cache = std::make_shared<io::internal::ReadRangeCache>(
+        SharedFile(), io::AsyncContext(), options_.cache_options);
+    RETURN_NOT_OK(body_cache->Cache(MergeReadRanges(std::move(body_ranges))));
+
+    CachedMessageBody body(std::move(body_cache), block.offset + block.metadata_length,
+                           block.body_length);
+    return ReadRecordBatchInternal(*metadata, schema_, field_inclusion_mask_,
+                                   &dictionary_memo_, options_, &body);
+  }
+
+  // The file being read, which is not owned by the returned pointer if the
+  // reader was opened from a raw pointer
+  std::shared_ptr<io::RandomAccessFile> SharedFile() const {
+    if (owned_file_ != nullptr) {
+      return owned_file_;
+    }
+    return std::shared_ptr<io::RandomAccessFile>(file_, [](io::RandomAccessFile*) {});
+  }
+
   io::RandomAccessFile* file_;
   IpcReadOptions options_;
   std::vector<bool> field_inclusion_mask_;
@@ -1093,6 +1424,11 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   bool read_dictionaries_ = false;
   DictionaryMemo dictionary_memo_;
 
+  // The record batches being read in the background, by index
+  std::unordered_map<int, Future<std::shared_ptr<RecordBatch>>> prefetched_batches_;
+  // The index following the last record batch being read in the background
+  int prefetch_end_ = 0;
+
   // Reconstructed schema, including any read dictionaries
   std::shared_ptr<Schema> schema_;
   // Schema with deselected fields dropped
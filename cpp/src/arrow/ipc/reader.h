@@ -31,6 +31,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/future.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
@@ -167,6 +168,16 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// \return the read batch
   virtual Result<std::shared_ptr<RecordBatch>> ReadRecordBatch(int i) = 0;
 
+  /// \brief Read a particular record batch from the file asynchronously.
+  ///
+  /// If IpcReadOptions::prefetch_record_batches is greater than zero, the
+  /// following record batches are read ahead in the background. Otherwise the
+  /// record batch is read synchronously.
+  ///
+  /// \param[in] i the index of the record batch to return
+  /// \return a Future of the read batch
+  virtual Future<std::shared_ptr<RecordBatch>> ReadRecordBatchAsync(int i) = 0;
+
   /// \brief Return current read statistics
   virtual ReadStats stats() const = 0;
 };
@@ -32,6 +32,9 @@ namespace json {
 
 enum class UnexpectedFieldBehavior : char {
   /// Unexpected JSON fields are ignored
+  ///
+  /// Only the fields of the explicit schema are parsed: the values of the other
+  /// fields, including nested ones, are skipped without being stored.
   Ignore,
   /// Unexpected JSON fields error out
   Error,
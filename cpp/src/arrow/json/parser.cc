@@ -333,15 +333,41 @@ class RawArrayBuilder<Kind::kObject> {
     return "";
   }
 
-  int GetFieldIndex(const std::string& name) const {
-    auto it = name_to_index_.find(name);
+  int GetFieldIndex(string_view name) const {
+    if (fields_frozen_) {
+      return name_trie_.Find(name);
+    }
+    auto it = name_to_index_.find(std::string(name));
     if (it == name_to_index_.end()) {
       return -1;
     }
     return it->second;
   }
 
+  /// Look up field names in a trie rather than in a hash table, which spares
+  /// allocating a string for each key.  No field may be added afterwards.
+  void FreezeFields() {
+    if (static_cast<int>(name_to_index_.size()) != num_fields()) {
+      // Duplicate field names
+      return;
+    }
+    std::vector<string_view> field_names(num_fields());
+    for (const auto& name_index : name_to_index_) {
+      field_names[name_index.second] = name_index.first;
+    }
+    internal::TrieBuilder trie_builder;
+    for (const auto& name : field_names) {
+      if (!trie_builder.Append(name).ok()) {
+        // Too many fields for a trie, keep using the hash table
+        return;
+      }
+    }
+    name_trie_ = trie_builder.Finish();
+    fields_frozen_ = true;
+  }
+
   int AddField(std::string name, BuilderPtr builder) {
+    DCHECK(!fields_frozen_);
     auto index = num_fields();
     field_builders_.push_back(builder);
     name_to_index_.emplace(std::move(name), index);
@@ -386,6 +412,8 @@ class RawArrayBuilder<Kind::kObject> {
  private:
   std::vector<BuilderPtr> field_builders_;
   std::unordered_map<std::string, int> name_to_index_;
+  internal::Trie name_trie_;
+  bool fields_frozen_ = false;
   TypedBufferBuilder<bool> null_bitmap_builder_;
 };
 
@@ -457,6 +485,13 @@ class RawBuilderSet {
     }
   }
 
+  /// Fix the fields of all object builders, see RawArrayBuilder<kObject>::FreezeFields
+  void FreezeObjectFields() {
+    for (auto& builder : arena<Kind::kObject>()) {
+      builder.FreezeFields();
+    }
+  }
+
   /// Appending null is slightly tricky since null count is stored inline
   /// for builders of Kind::kNull. Append nulls using this helper
   Status AppendNull(BuilderPtr parent, int field_index, BuilderPtr builder) {
@@ -647,6 +682,9 @@ class HandlerBase : public BlockParser,
     return builder_set_.MakeBuilder(*type, 0, &builder_);
   }
 
+  /// \brief Declare that no field will be added to the expected Schema
+  void FreezeFields() { builder_set_.FreezeObjectFields(); }
+
   Status Finish(std::shared_ptr<Array>* parsed) override {
     std::shared_ptr<Array> scalar_values;
     RETURN_NOT_OK(scalar_values_builder_.Finish(&scalar_values));
@@ -722,6 +760,8 @@ class HandlerBase : public BlockParser,
     auto value_length = static_cast<int32_t>(scalar.size());
     RETURN_NOT_OK(Cast<kind>(builder)->Append(index, value_length));
     RETURN_NOT_OK(scalar_values_builder_.Reserve(1));
+    // A no-op unless ReserveScalarStorage() didn't reserve the whole block
+    RETURN_NOT_OK(scalar_values_builder_.ReserveData(value_length));
     scalar_values_builder_.UnsafeAppend(scalar);
     return Status::OK();
   }
@@ -745,7 +785,7 @@ class HandlerBase : public BlockParser,
   /// there is no field with that name
   bool SetFieldBuilder(string_view key, bool* duplicate_keys) {
     auto parent = Cast<Kind::kObject>(builder_stack_.back());
-    field_index_ = parent->GetFieldIndex(std::string(key));
+    field_index_ = parent->GetFieldIndex(key);
     if (ARROW_PREDICT_FALSE(field_index_ == -1)) {
       return false;
     }
@@ -872,6 +912,9 @@ class Handler<UnexpectedFieldBehavior::Error> : public HandlerBase {
   }
 };
 
+/// Only the fields of the expected Schema are parsed (projection), the values of
+/// the other fields, including nested objects and arrays, are skipped without
+/// being stored
 template <>
 class Handler<UnexpectedFieldBehavior::Ignore> : public HandlerBase {
  public:
@@ -881,6 +924,10 @@ class Handler<UnexpectedFieldBehavior::Ignore> : public HandlerBase {
     return DoParse(*this, json);
   }
 
+  /// Skipped fields may make up most of the JSON data, so the storage for
+  /// scalars grows as values are appended instead of being reserved upfront
+  Status ReserveScalarStorage(int64_t) override { return Status::OK(); }
+
   bool Null() {
     if (Skipping()) {
       return true;
@@ -1086,7 +1133,12 @@ Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
       *out = make_unique<Handler<UnexpectedFieldBehavior::InferType>>(pool);
       break;
   }
-  return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema);
+  auto& handler = static_cast<HandlerBase&>(**out);
+  RETURN_NOT_OK(handler.Initialize(options.explicit_schema));
+  if (options.unexpected_field_behavior != UnexpectedFieldBehavior::InferType) {
+    handler.FreezeFields();
+  }
+  return Status::OK();
 }
 
 Status BlockParser::Make(const ParseOptions& options, std::unique_ptr<BlockParser>* out) {
@@ -113,6 +113,36 @@ static void ParseJSONBlockWithSchema(
   BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
 }
 
+// Field names of typical event data, longer than std::string's inline storage
+std::string FieldName(int index) { return "event_attribute_" + std::to_string(index); }
+
+// Objects of many fields, of which the schema only has the first two
+std::string WideJsonData(int num_rows, int num_fields) {
+  std::string json;
+  for (int i = 0; i < num_rows; ++i) {
+    json += "{";
+    for (int j = 0; j < num_fields; ++j) {
+      json += (j == 0 ? "\"" : ", \"") + FieldName(j) + "\": ";
+      json += j % 2 == 0 ? std::to_string(i) : "\"str_" + std::to_string(i) + "\"";
+    }
+    json += "}\n";
+  }
+  return json;
+}
+
+static void ParseJSONWideObjectFewFields(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int32_t num_rows = 5000;
+  const auto num_fields = static_cast<int>(state.range(0));
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  options.explicit_schema =
+      schema({field(FieldName(0), int64()), field(FieldName(1), utf8())});
+
+  auto json = WideJsonData(num_rows, num_fields);
+  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
+}
+
 static void BenchmarkJSONReading(benchmark::State& state,  // NOLINT non-const reference
                                  const std::string& json, int32_t num_rows,
                                  ReadOptions read_options, ParseOptions parse_options) {
@@ -156,6 +186,7 @@ static void ReadJSONBlockWithSchemaMultiThread(
 BENCHMARK(ChunkJSONPrettyPrinted);
 BENCHMARK(ChunkJSONLineDelimited);
 BENCHMARK(ParseJSONBlockWithSchema);
+BENCHMARK(ParseJSONWideObjectFewFields)->Arg(10)->Arg(100);
 
 BENCHMARK(ReadJSONBlockWithSchemaSingleThread);
 BENCHMARK(ReadJSONBlockWithSchemaMultiThread)->UseRealTime();
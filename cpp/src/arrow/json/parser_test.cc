@@ -24,8 +24,10 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/buffer.h"
 #include "arrow/json/options.h"
 #include "arrow/json/test_common.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/string_view.h"
@@ -131,6 +133,75 @@ TEST(BlockParserWithSchema, SkipFieldsOutsideSchema) {
                       "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
 }
 
+TEST(BlockParserWithSchema, SkipNestedFieldsOutsideSchema) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema =
+      schema({field("a", int32()), field("a_rather_long_field_name", utf8()),
+              field("nuf", struct_({field("ps", int32())}))});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  std::string src = R"(
+    {"ab": 0, "skip": {"a": 1, "b": [{"a": 2}]}, "a": 3, "a_rather_long_field_name": "x"}
+    {"": [[1, 2], {"a": "y"}], "nuf": {"ps": 4, "extra": {"ps": 5}}, "a_rather": null}
+    {"nuf": {"skip": [6]}, "a": 7, "b": "z", "a_rather_long_field_name_2": "w"}
+  )";
+  AssertParseColumns(options, src,
+                     {field("a", utf8()), field("a_rather_long_field_name", utf8()),
+                      field("nuf", struct_({field("ps", utf8())}))},
+                     {R"(["3", null, "7"])", R"(["x", null, null])",
+                      R"([{"ps":null}, {"ps":"4"}, {"ps":null}])"});
+
+  // Only the values of the projected fields were stored
+  std::shared_ptr<Array> parsed;
+  ASSERT_OK(ParseFromString(options, src, &parsed));
+  auto a = std::static_pointer_cast<StructArray>(parsed)->GetFieldByName("a");
+  ASSERT_EQ(std::static_pointer_cast<DictionaryArray>(a)->dictionary()->length(), 4);
+}
+
+TEST(BlockParserWithSchema, SkippedFieldsStorage) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema({field("a", int32())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  std::string src;
+  for (int i = 0; i < 1000; ++i) {
+    src += "{\"skipped\": \"" + std::string(500, 'x') + "\", \"a\": " +
+           std::to_string(i) + "}\n";
+  }
+
+  ProxyMemoryPool pool(default_memory_pool());
+  std::unique_ptr<BlockParser> parser;
+  ASSERT_OK(BlockParser::Make(&pool, options, &parser));
+  // As the JSON readers do before parsing a block
+  ASSERT_OK(parser->ReserveScalarStorage(static_cast<int64_t>(src.size())));
+  ASSERT_OK(parser->Parse(std::make_shared<Buffer>(src)));
+  std::shared_ptr<Array> parsed;
+  ASSERT_OK(parser->Finish(&parsed));
+  ASSERT_EQ(parsed->length(), 1000);
+
+  // The scalar storage is proportional to the projected values, not to the block
+  ASSERT_LT(pool.max_memory(), static_cast<int64_t>(src.size()) / 10);
+}
+
+TEST(BlockParserWithSchema, ManyFields) {
+  // Too many field names for a trie, they are looked up in a hash table
+  auto options = ParseOptions::Defaults();
+  FieldVector fields;
+  for (int i = 0; i < 4000; ++i) {
+    fields.push_back(field(std::to_string(i) + std::string(100, 'x'), utf8()));
+  }
+  options.explicit_schema = schema(fields);
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  const auto& first = fields.front()->name();
+  const auto& middle = fields[1234]->name();
+  const auto& last = fields.back()->name();
+  std::string src = "{\"" + first + "\": \"a\", \"" + last + "\": \"b\", \"" +
+                    middle + "y\": \"x\"}\n{\"" + middle + "\": \"c\"}\n";
+  AssertParseColumns(options, src,
+                     {field(first, utf8()), field(middle, utf8()), field(last, utf8()),
+                      fields[1]},
+                     {R"(["a", null])", R"([null, "c"])", R"(["b", null])",
+                      "[null, null]"});
+}
+
 class BlockParserTypeError : public ::testing::TestWithParam<UnexpectedFieldBehavior> {
  public:
   ParseOptions Options(std::shared_ptr<Schema> explicit_schema) {
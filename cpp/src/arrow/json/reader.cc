@@ -17,6 +17,8 @@
 
 #include "arrow/json/reader.h"
 
+#include <algorithm>
+#include <deque>
 #include <utility>
 #include <vector>
 
@@ -29,8 +31,10 @@
 #include "arrow/json/parser.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/string_view.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
@@ -45,6 +49,82 @@ using internal::ThreadPool;
 
 namespace json {
 
+namespace {
+
+Status MakeBuilder(const std::shared_ptr<TaskGroup>& task_group, MemoryPool* pool,
+                   const ParseOptions& parse_options,
+                   std::shared_ptr<ChunkedArrayBuilder>* out) {
+  auto type = parse_options.explicit_schema
+                  ? struct_(parse_options.explicit_schema->fields())
+                  : struct_({});
+
+  auto promotion_graph =
+      parse_options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
+          ? GetPromotionGraph()
+          : nullptr;
+
+  return MakeChunkedArrayBuilder(task_group, pool, promotion_graph, type, out);
+}
+
+// Parse a block made of the completion of an object straddling the previous
+// block (partial + completion), followed by whole objects
+Result<std::shared_ptr<Array>> ParseBlock(MemoryPool* pool,
+                                          const ParseOptions& parse_options,
+                                          const std::shared_ptr<Buffer>& partial,
+                                          const std::shared_ptr<Buffer>& completion,
+                                          const std::shared_ptr<Buffer>& whole) {
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::Make(pool, parse_options, &parser));
+  RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
+                                             whole->size()));
+
+  if (partial->size() != 0 || completion->size() != 0) {
+    std::shared_ptr<Buffer> straddling;
+    if (partial->size() == 0) {
+      straddling = completion;
+    } else if (completion->size() == 0) {
+      straddling = partial;
+    } else {
+      ARROW_ASSIGN_OR_RAISE(straddling, ConcatenateBuffers({partial, completion}, pool));
+    }
+    RETURN_NOT_OK(parser->Parse(straddling));
+  }
+
+  if (whole->size() != 0) {
+    RETURN_NOT_OK(parser->Parse(whole));
+  }
+
+  std::shared_ptr<Array> parsed;
+  RETURN_NOT_OK(parser->Finish(&parsed));
+  return parsed;
+}
+
+// Make a record batch of the fields of a converted block
+std::shared_ptr<RecordBatch> BatchFromStructArray(const Array& array) {
+  const auto& converted = static_cast<const StructArray&>(array);
+  std::vector<std::shared_ptr<Array>> columns(converted.num_fields());
+  for (int i = 0; i < converted.num_fields(); ++i) {
+    columns[i] = converted.field(i);
+  }
+  return RecordBatch::Make(schema(converted.type()->fields()), converted.length(),
+                           std::move(columns));
+}
+
+// Convert a parsed block on its own into a record batch
+Result<std::shared_ptr<RecordBatch>> ConvertBlock(MemoryPool* pool,
+                                                  const ParseOptions& parse_options,
+                                                  const std::shared_ptr<Array>& parsed) {
+  std::shared_ptr<ChunkedArrayBuilder> builder;
+  RETURN_NOT_OK(MakeBuilder(TaskGroup::MakeSerial(), pool, parse_options, &builder));
+
+  builder->Insert(0, field("", parsed->type()), parsed);
+  std::shared_ptr<ChunkedArray> converted_chunked;
+  RETURN_NOT_OK(builder->Finish(&converted_chunked));
+  return BatchFromStructArray(*converted_chunked->chunk(0));
+}
+
+}  // namespace
+
 class TableReaderImpl : public TableReader,
                         public std::enable_shared_from_this<TableReaderImpl> {
  public:
@@ -65,7 +145,7 @@ class TableReaderImpl : public TableReader,
   }
 
   Result<std::shared_ptr<Table>> Read() override {
-    RETURN_NOT_OK(MakeBuilder());
+    RETURN_NOT_OK(MakeBuilder(task_group_, pool_, parse_options_, &builder_));
 
     ARROW_ASSIGN_OR_RAISE(auto block, block_iterator_.Next());
     if (block == nullptr) {
@@ -112,46 +192,11 @@ class TableReaderImpl : public TableReader,
   }
 
  private:
-  Status MakeBuilder() {
-    auto type = parse_options_.explicit_schema
-                    ? struct_(parse_options_.explicit_schema->fields())
-                    : struct_({});
-
-    auto promotion_graph =
-        parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-            ? GetPromotionGraph()
-            : nullptr;
-
-    return MakeChunkedArrayBuilder(task_group_, pool_, promotion_graph, type, &builder_);
-  }
-
   Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
                         const std::shared_ptr<Buffer>& completion,
                         const std::shared_ptr<Buffer>& whole, int64_t block_index) {
-    std::unique_ptr<BlockParser> parser;
-    RETURN_NOT_OK(BlockParser::Make(pool_, parse_options_, &parser));
-    RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
-                                               whole->size()));
-
-    if (partial->size() != 0 || completion->size() != 0) {
-      std::shared_ptr<Buffer> straddling;
-      if (partial->size() == 0) {
-        straddling = completion;
-      } else if (completion->size() == 0) {
-        straddling = partial;
-      } else {
-        ARROW_ASSIGN_OR_RAISE(straddling,
-                              ConcatenateBuffers({partial, completion}, pool_));
-      }
-      RETURN_NOT_OK(parser->Parse(straddling));
-    }
-
-    if (whole->size() != 0) {
-      RETURN_NOT_OK(parser->Parse(whole));
-    }
-
-    std::shared_ptr<Array> parsed;
-    RETURN_NOT_OK(parser->Finish(&parsed));
+    ARROW_ASSIGN_OR_RAISE(auto parsed,
+                          ParseBlock(pool_, parse_options_, partial, completion, whole));
     builder_->Insert(block_index, field("", parsed->type()), parsed);
     return Status::OK();
   }
@@ -189,6 +234,243 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   return TableReader::Make(pool, input, read_options, parse_options).Value(out);
 }
 
+class StreamingReaderImpl : public StreamingReader {
+ public:
+  StreamingReaderImpl(MemoryPool* pool, const ReadOptions& read_options,
+                      const ParseOptions& parse_options, ThreadPool* thread_pool)
+      : pool_(pool),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        chunker_(MakeChunker(parse_options_)),
+        thread_pool_(thread_pool) {}
+
+  ~StreamingReaderImpl() override {
+    // Make sure all pending tasks are finished before destroying members
+    for (auto& batch : pending_batches_) {
+      batch.Wait();
+    }
+  }
+
+  Status Init(std::shared_ptr<io::InputStream> input) {
+    readahead_ = thread_pool_ != nullptr ? std::max(thread_pool_->GetCapacity(), 1) : 1;
+    ARROW_ASSIGN_OR_RAISE(auto it,
+                          io::MakeInputStreamIterator(input, read_options_.block_size));
+    ARROW_ASSIGN_OR_RAISE(block_iterator_,
+                          MakeReadaheadIterator(std::move(it), readahead_));
+
+    ARROW_ASSIGN_OR_RAISE(block_, block_iterator_.Next());
+    if (block_ == nullptr) {
+      return Status::Invalid("Empty JSON file");
+    }
+    partial_ = std::make_shared<Buffer>("");
+
+    // Infer the schema over the blocks read ahead, which are parsed in
+    // parallel, and at least one non-empty block.  The types inferred from
+    // each block are promoted to a common schema, e.g. a field which is null
+    // or absent in the first block gets the type of its values in later ones.
+    std::vector<std::shared_ptr<Array>> parsed_blocks;
+    bool has_rows = false;
+    while (!source_eof_ && (parsed_blocks.size() < static_cast<size_t>(readahead_) ||
+                            !has_rows)) {
+      std::vector<Future<std::shared_ptr<Array>>> pending;
+      Status st = ParseAhead(&pending);
+      // Wait for all the blocks submitted before bailing out, even if reading
+      // the next one failed, as the tasks use members
+      for (auto& parsed : pending) {
+        parsed.Wait();
+      }
+      RETURN_NOT_OK(st);
+      for (auto& parsed : pending) {
+        ARROW_ASSIGN_OR_RAISE(auto parsed_block, parsed.result());
+        has_rows = has_rows || parsed_block->length() > 0;
+        parsed_blocks.push_back(std::move(parsed_block));
+      }
+    }
+    DCHECK(!parsed_blocks.empty());
+
+    std::shared_ptr<ChunkedArrayBuilder> builder;
+    RETURN_NOT_OK(MakeBuilder(thread_pool_ != nullptr
+                                  ? TaskGroup::MakeThreaded(thread_pool_)
+                                  : TaskGroup::MakeSerial(),
+                              pool_, parse_options_, &builder));
+    for (size_t i = 0; i < parsed_blocks.size(); ++i) {
+      builder->Insert(static_cast<int64_t>(i), field("", parsed_blocks[i]->type()),
+                      parsed_blocks[i]);
+    }
+    std::shared_ptr<ChunkedArray> converted;
+    RETURN_NOT_OK(builder->Finish(&converted));
+    for (const auto& chunk : converted->chunks()) {
+      first_batches_.push_back(BatchFromStructArray(*chunk));
+    }
+    schema_ = first_batches_.front()->schema();
+
+    // The following blocks must be converted to the same schema
+    chunk_parse_options_ = parse_options_;
+    chunk_parse_options_.explicit_schema = schema_;
+    if (parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType) {
+      chunk_parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    if (eof_) {
+      *out = nullptr;
+      return Status::OK();
+    }
+    Status st = ReadNextBatch(out);
+    if (!st.ok() || *out == nullptr) {
+      // Read, parse or conversion error => bail out
+      eof_ = true;
+    }
+    return st;
+  }
+
+ private:
+  // A block of data to parse: the completion of an object straddling the
+  // previous block (partial + completion), followed by whole objects
+  struct Chunk {
+    std::shared_ptr<Buffer> partial;
+    std::shared_ptr<Buffer> completion;
+    std::shared_ptr<Buffer> whole;
+  };
+
+  Result<std::shared_ptr<RecordBatch>> ParseAndConvert(const ParseOptions& parse_options,
+                                                       const Chunk& chunk) {
+    ARROW_ASSIGN_OR_RAISE(auto parsed, ParseBlock(pool_, parse_options, chunk.partial,
+                                                  chunk.completion, chunk.whole));
+    return ConvertBlock(pool_, parse_options, parsed);
+  }
+
+  Status ReadNextBatch(std::shared_ptr<RecordBatch>* out) {
+    // Skip empty blocks, such as trailing whitespace
+    while (!first_batches_.empty()) {
+      *out = std::move(first_batches_.front());
+      first_batches_.pop_front();
+      if ((*out)->num_rows() > 0) {
+        return Status::OK();
+      }
+    }
+    while (true) {
+      RETURN_NOT_OK(ReadAhead());
+      if (pending_batches_.empty()) {
+        *out = nullptr;
+        return Status::OK();
+      }
+      auto batch = std::move(pending_batches_.front());
+      pending_batches_.pop_front();
+      ARROW_ASSIGN_OR_RAISE(*out, batch.result());
+      if ((*out)->num_rows() > 0) {
+        return Status::OK();
+      }
+    }
+  }
+
+  // Keep up to `readahead_` blocks being parsed and converted in the background
+  Status ReadAhead() {
+    while (!source_eof_ && pending_batches_.size() < static_cast<size_t>(readahead_)) {
+      ARROW_ASSIGN_OR_RAISE(auto maybe_chunk, NextChunk());
+      if (!maybe_chunk.has_value()) {
+        source_eof_ = true;
+        break;
+      }
+      auto chunk = std::move(maybe_chunk).value();
+      if (thread_pool_ != nullptr) {
+        ARROW_ASSIGN_OR_RAISE(auto batch, thread_pool_->Submit([this, chunk] {
+          return ParseAndConvert(chunk_parse_options_, chunk);
+        }));
+        pending_batches_.push_back(std::move(batch));
+      } else {
+        pending_batches_.push_back(Future<std::shared_ptr<RecordBatch>>::MakeFinished(
+            ParseAndConvert(chunk_parse_options_, chunk)));
+      }
+    }
+    return Status::OK();
+  }
+
+  // Parse up to `readahead_` blocks in parallel, for schema inference
+  Status ParseAhead(std::vector<Future<std::shared_ptr<Array>>>* out) {
+    while (out->size() < static_cast<size_t>(readahead_)) {
+      ARROW_ASSIGN_OR_RAISE(auto maybe_chunk, NextChunk());
+      if (!maybe_chunk.has_value()) {
+        source_eof_ = true;
+        break;
+      }
+      auto chunk = std::move(maybe_chunk).value();
+      if (thread_pool_ != nullptr) {
+        ARROW_ASSIGN_OR_RAISE(auto parsed, thread_pool_->Submit([this, chunk] {
+          return ParseBlock(pool_, parse_options_, chunk.partial, chunk.completion,
+                            chunk.whole);
+        }));
+        out->push_back(std::move(parsed));
+      } else {
+        out->push_back(Future<std::shared_ptr<Array>>::MakeFinished(ParseBlock(
+            pool_, parse_options_, chunk.partial, chunk.completion, chunk.whole)));
+      }
+    }
+    return Status::OK();
+  }
+
+  // Split the next block from the input at object boundaries
+  Result<util::optional<Chunk>> NextChunk() {
+    if (block_ == nullptr) {
+      return util::optional<Chunk>();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto next_block, block_iterator_.Next());
+
+    Chunk chunk;
+    chunk.partial = partial_;
+    if (next_block == nullptr) {
+      // End of file reached => compute completion from penultimate block
+      RETURN_NOT_OK(
+          chunker_->ProcessFinal(partial_, block_, &chunk.completion, &chunk.whole));
+    } else {
+      std::shared_ptr<Buffer> starts_with_whole;
+      // Get completion of partial from previous block.
+      RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, block_, &chunk.completion,
+                                                 &starts_with_whole));
+
+      // Get all whole objects entirely inside the current buffer
+      RETURN_NOT_OK(chunker_->Process(starts_with_whole, &chunk.whole, &partial_));
+    }
+    block_ = std::move(next_block);
+    return chunk;
+  }
+
+  MemoryPool* pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  // The parse options of the blocks after the ones the schema was inferred from
+  ParseOptions chunk_parse_options_;
+  std::unique_ptr<Chunker> chunker_;
+  ThreadPool* thread_pool_;
+  int32_t readahead_ = 1;
+
+  Iterator<std::shared_ptr<Buffer>> block_iterator_;
+  std::shared_ptr<Buffer> block_;
+  std::shared_ptr<Buffer> partial_;
+  bool source_eof_ = false;
+  bool eof_ = false;
+
+  std::shared_ptr<Schema> schema_;
+  // The batches of the blocks the schema was inferred from
+  std::deque<std::shared_ptr<RecordBatch>> first_batches_;
+  // The blocks being parsed and converted, in order
+  std::deque<Future<std::shared_ptr<RecordBatch>>> pending_batches_;
+};
+
+Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
+    MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options) {
+  auto thread_pool = read_options.use_threads ? GetCpuThreadPool() : nullptr;
+  auto ptr = std::make_shared<StreamingReaderImpl>(pool, read_options, parse_options,
+                                                   thread_pool);
+  RETURN_NOT_OK(ptr->Init(input));
+  return ptr;
+}
+
 Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                               std::shared_ptr<Buffer> json) {
   std::unique_ptr<BlockParser> parser;
@@ -196,29 +478,7 @@ Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
   RETURN_NOT_OK(parser->Parse(json));
   std::shared_ptr<Array> parsed;
   RETURN_NOT_OK(parser->Finish(&parsed));
-
-  auto type =
-      options.explicit_schema ? struct_(options.explicit_schema->fields()) : struct_({});
-  auto promotion_graph =
-      options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-          ? GetPromotionGraph()
-          : nullptr;
-  std::shared_ptr<ChunkedArrayBuilder> builder;
-  RETURN_NOT_OK(MakeChunkedArrayBuilder(internal::TaskGroup::MakeSerial(),
-                                        default_memory_pool(), promotion_graph, type,
-                                        &builder));
-
-  builder->Insert(0, field("", type), parsed);
-  std::shared_ptr<ChunkedArray> converted_chunked;
-  RETURN_NOT_OK(builder->Finish(&converted_chunked));
-  auto converted = static_cast<const StructArray*>(converted_chunked->chunk(0).get());
-
-  std::vector<std::shared_ptr<Array>> columns(converted->num_fields());
-  for (int i = 0; i < converted->num_fields(); ++i) {
-    columns[i] = converted->field(i);
-  }
-  return RecordBatch::Make(schema(converted->type()->fields()), converted->length(),
-                           std::move(columns));
+  return ConvertBlock(default_memory_pool(), options, parsed);
 }
 
 }  // namespace json
@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "arrow/json/options.h"
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
@@ -65,6 +66,33 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// \brief A class that reads a JSON file as a stream of record batches
+///
+/// The file is expected to consist of individual line-separated JSON objects.
+/// Experimental
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  /// Create a StreamingReader instance
+  ///
+  /// Each block of ReadOptions::block_size bytes is parsed and converted into
+  /// one record batch.  If ReadOptions::use_threads is true, up to as many
+  /// blocks as the capacity of the CPU thread pool are parsed and converted
+  /// ahead in parallel.  Batches are still yielded in order.
+  ///
+  /// The schema is inferred from the blocks read ahead before the first batch
+  /// is yielded (and at least one non-empty block), promoting the types seen
+  /// in each of them.  It is then used as the explicit schema of the following
+  /// blocks.  Fields missing from it are handled according to
+  /// ParseOptions::unexpected_field_behavior, except that
+  /// UnexpectedFieldBehavior::InferType behaves like UnexpectedFieldBehavior::Error
+  /// as the schema cannot change anymore.
+  static Result<std::shared_ptr<StreamingReader>> Make(
+      MemoryPool* pool, std::shared_ptr<io::InputStream> input, const ReadOptions&,
+      const ParseOptions&);
+};
+
 ARROW_EXPORT Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
                                                            std::shared_ptr<Buffer> json);
 
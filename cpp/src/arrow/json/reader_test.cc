@@ -25,8 +25,10 @@
 #include "arrow/json/options.h"
 #include "arrow/json/reader.h"
 #include "arrow/json/test_common.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace json {
@@ -284,5 +286,218 @@ TEST(ReaderTest, ListArrayWithFewValues) {
   AssertTablesEqual(*actual_table, *expected_table);
 }
 
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUpReader(util::string_view input) {
+    read_options_.use_threads = GetParam();
+    ASSERT_OK(MakeStream(input, &input_));
+    ASSERT_OK_AND_ASSIGN(reader_, StreamingReader::Make(default_memory_pool(), input_,
+                                                        read_options_, parse_options_));
+  }
+
+  void ReadAll() {
+    RecordBatchVector batches;
+    ASSERT_OK(reader_->ReadAll(&batches));
+    for (const auto& batch : batches) {
+      ASSERT_GT(batch->num_rows(), 0);
+    }
+    ASSERT_OK_AND_ASSIGN(table_, Table::FromRecordBatches(reader_->schema(), batches));
+    ASSERT_OK(table_->ValidateFull());
+  }
+
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ReadOptions read_options_ = ReadOptions::Defaults();
+  std::shared_ptr<io::InputStream> input_;
+  std::shared_ptr<StreamingReader> reader_;
+  std::shared_ptr<Table> table_;
+};
+
+INSTANTIATE_TEST_SUITE_P(StreamingReaderTest, StreamingReaderTest,
+                         ::testing::Values(false, true));
+
+// Three rows in three blocks: "n" is null in the first one, "b" only
+// appears in the last one
+static const char* kLateFieldsSrc = R"({"a": 1, "n": null}
+{"a": 2, "n": null}
+{"a": 3, "n": 1.5, "b": true}
+)";
+static constexpr int32_t kLateFieldsBlockSize = 32;
+
+TEST_P(StreamingReaderTest, Empty) {
+  read_options_.use_threads = GetParam();
+  std::shared_ptr<io::InputStream> input;
+  ASSERT_OK(MakeStream("", &input));
+  ASSERT_RAISES(Invalid, StreamingReader::Make(default_memory_pool(), input,
+                                               read_options_, parse_options_));
+
+  SetUpReader("  \n");
+  AssertSchemaEqual(*schema({}), *reader_->schema());
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader_->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+  // Reading past the end keeps returning null
+  ASSERT_OK(reader_->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST_P(StreamingReaderTest, MultipleChunks) {
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+
+  auto src = scalars_only_src();
+  read_options_.block_size = static_cast<int>(src.length() / 3);
+
+  SetUpReader(src);
+  ReadAll();
+
+  auto schema = ::arrow::schema(
+      {field("hello", float64()), field("world", boolean()), field("yo", utf8())});
+  auto expected_table = Table::Make(
+      schema, {
+                  ArrayFromJSON(schema->field(0)->type(), "[3.5, 3.25, 3.125, 0.0]"),
+                  ArrayFromJSON(schema->field(1)->type(), "[false, null, null, true]"),
+                  ArrayFromJSON(schema->field(2)->type(),
+                                "[\"thing\", null, \"\xe5\xbf\x8d\", null]"),
+              });
+  AssertTablesEqual(*expected_table, *table_, /*same_chunk_layout=*/false);
+}
+
+TEST_P(StreamingReaderTest, ManyBlocks) {
+  int64_t count = 1 << 10;
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  read_options_.block_size = static_cast<int>(count / 2);
+
+  std::string json;
+  for (int i = 0; i < count; ++i) {
+    json += "{\"a\":" + std::to_string(i) + "}\n";
+  }
+  SetUpReader(json);
+  ReadAll();
+
+  ASSERT_EQ(table_->num_rows(), count);
+  ASSERT_EQ(table_->column(0)->type()->id(), Type::INT64);
+  int expected = 0;
+  for (auto chunk : table_->column(0)->chunks()) {
+    for (int64_t i = 0; i < chunk->length(); ++i) {
+      ASSERT_EQ(checked_cast<const Int64Array*>(chunk.get())->GetView(i), expected)
+          << " at index " << i;
+      ++expected;
+    }
+  }
+}
+
+TEST_P(StreamingReaderTest, UnexpectedFieldAfterReadahead) {
+  // The schema can't change after the blocks read ahead, and there are
+  // far more blocks than threads here
+  int64_t count = 1 << 10;
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  read_options_.block_size = 64;
+
+  std::string json;
+  for (int i = 0; i < count; ++i) {
+    json += "{\"a\":" + std::to_string(i) + "}\n";
+  }
+  json += "{\"a\":0, \"b\":true}\n";
+  SetUpReader(json);
+  AssertSchemaEqual(*schema({field("a", int64())}), *reader_->schema());
+
+  RecordBatchVector batches;
+  ASSERT_RAISES(Invalid, reader_->ReadAll(&batches));
+  // The reader is exhausted after an error
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader_->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST_P(StreamingReaderTest, ExplicitSchema) {
+  parse_options_.explicit_schema = schema({field("b", boolean()), field("a", int32())});
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  read_options_.block_size = kLateFieldsBlockSize;
+
+  SetUpReader(kLateFieldsSrc);
+  AssertSchemaEqual(*parse_options_.explicit_schema, *reader_->schema());
+  ReadAll();
+
+  auto expected_table = Table::Make(parse_options_.explicit_schema,
+                                    {ArrayFromJSON(boolean(), "[null, null, true]"),
+                                     ArrayFromJSON(int32(), "[1, 2, 3]")});
+  AssertTablesEqual(*expected_table, *table_, /*same_chunk_layout=*/false);
+}
+
+TEST(StreamingReaderTest, SchemaOfFirstBlockSerial) {
+  // Without threads nothing is read ahead, the schema is inferred from the
+  // first block only
+  ParseOptions parse_options;
+  parse_options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  ReadOptions read_options;
+  read_options.use_threads = false;
+  read_options.block_size = kLateFieldsBlockSize;
+
+  std::shared_ptr<io::InputStream> input;
+  ASSERT_OK(MakeStream(kLateFieldsSrc, &input));
+  ASSERT_OK_AND_ASSIGN(auto reader, StreamingReader::Make(default_memory_pool(), input,
+                                                          read_options, parse_options));
+  AssertSchemaEqual(*schema({field("a", int64()), field("n", null())}),
+                    *reader->schema());
+
+  RecordBatchVector batches;
+  ASSERT_RAISES(Invalid, reader->ReadAll(&batches));
+}
+
+TEST(StreamingReaderTest, FieldsPromotedAfterFirstBlockThreaded) {
+  // The schema is inferred from as many blocks as there are threads
+  const int old_capacity = GetCpuThreadPoolCapacity();
+  ASSERT_OK(SetCpuThreadPoolCapacity(4));
+
+  ParseOptions parse_options;
+  parse_options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  ReadOptions read_options;
+  read_options.use_threads = true;
+  read_options.block_size = kLateFieldsBlockSize;
+
+  std::shared_ptr<io::InputStream> input;
+  ASSERT_OK(MakeStream(kLateFieldsSrc, &input));
+  ASSERT_OK_AND_ASSIGN(auto reader, StreamingReader::Make(default_memory_pool(), input,
+                                                          read_options, parse_options));
+  auto expected_schema =
+      schema({field("a", int64()), field("n", float64()), field("b", boolean())});
+  AssertSchemaEqual(*expected_schema, *reader->schema());
+
+  RecordBatchVector batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(batches));
+  auto expected_table =
+      Table::Make(expected_schema, {ArrayFromJSON(int64(), "[1, 2, 3]"),
+                                    ArrayFromJSON(float64(), "[null, null, 1.5]"),
+                                    ArrayFromJSON(boolean(), "[null, null, true]")});
+  AssertTablesEqual(*expected_table, *table, /*same_chunk_layout=*/false);
+
+  ASSERT_OK(SetCpuThreadPoolCapacity(old_capacity));
+}
+
+TEST(StreamingReaderTest, ChunkingErrorThreaded) {
+  const int old_capacity = GetCpuThreadPoolCapacity();
+  ASSERT_OK(SetCpuThreadPoolCapacity(4));
+
+  ParseOptions parse_options;
+  parse_options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  ReadOptions read_options;
+  read_options.use_threads = true;
+  read_options.block_size = 1 << 16;
+
+  // The first block takes a while to parse, the object after it straddles
+  // more than two blocks
+  std::string json;
+  while (json.size() < static_cast<size_t>(read_options.block_size)) {
+    json += "{\"a\": " + std::to_string(json.size()) + "}\n";
+  }
+  json += "{\"a\": \"" + std::string(3 * read_options.block_size, 'x') + "\"}\n";
+  std::shared_ptr<io::InputStream> input;
+  ASSERT_OK(MakeStream(json, &input));
+  ASSERT_RAISES(Invalid, StreamingReader::Make(default_memory_pool(), input,
+                                               read_options, parse_options));
+
+  ASSERT_OK(SetCpuThreadPoolCapacity(old_capacity));
+}
+
 }  // namespace json
 }  // namespace arrow
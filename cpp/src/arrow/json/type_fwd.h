@@ -19,6 +19,7 @@ namespace arrow {
 namespace json {
 
 class TableReader;
+class StreamingReader;
 struct ReadOptions;
 struct ParseOptions;
 
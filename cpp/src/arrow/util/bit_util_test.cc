@@ -1906,6 +1906,42 @@ TEST(BitStreamUtil, ZigZag) {
   TestZigZag(-1234);
   TestZigZag(std::numeric_limits<int32_t>::max());
   TestZigZag(-std::numeric_limits<int32_t>::max());
+  TestZigZag(std::numeric_limits<int32_t>::min());
+}
+
+static void TestZigZag64(int64_t v) {
+  uint8_t buffer[BitUtil::BitReader::kMaxVlqByteLengthForInt64] = {};
+  BitUtil::BitWriter writer(buffer, sizeof(buffer));
+  BitUtil::BitReader reader(buffer, sizeof(buffer));
+  writer.PutZigZagVlqInt(v);
+  int64_t result;
+  EXPECT_TRUE(reader.GetZigZagVlqInt(&result));
+  EXPECT_EQ(v, result);
+}
+
+TEST(BitStreamUtil, ZigZag64) {
+  TestZigZag64(0);
+  TestZigZag64(1);
+  TestZigZag64(1234);
+  TestZigZag64(-1);
+  TestZigZag64(-1234);
+  TestZigZag64(std::numeric_limits<int64_t>::max());
+  TestZigZag64(std::numeric_limits<int64_t>::min());
+}
+
+TEST(BitStreamUtil, ZigZagEncoding) {
+  // Small magnitudes map to small unsigned values, alternating in sign
+  uint8_t buffer[4] = {};
+  BitUtil::BitWriter writer(buffer, sizeof(buffer));
+  writer.PutZigZagVlqInt(static_cast<int32_t>(0));
+  writer.PutZigZagVlqInt(static_cast<int32_t>(-1));
+  writer.PutZigZagVlqInt(static_cast<int64_t>(1));
+  writer.PutZigZagVlqInt(static_cast<int64_t>(-2));
+  writer.Flush();
+  EXPECT_EQ(buffer[0], 0);
+  EXPECT_EQ(buffer[1], 1);
+  EXPECT_EQ(buffer[2], 2);
+  EXPECT_EQ(buffer[3], 3);
 }
 
 TEST(BitUtil, RoundTripLittleEndianTest) {
@@ -326,4 +326,54 @@ void FutureImpl::AddCallback(Callback callback) {
   GetConcreteFuture(this)->AddCallback(std::move(callback));
 }
 
+Future<> AllComplete(const std::vector<Future<>>& futures) {
+  struct State {
+    explicit State(size_t n_futures) : n_remaining(n_futures) {}
+
+    std::atomic<size_t> n_remaining;
+    std::mutex mutex;
+    Status status;
+  };
+
+  if (futures.empty()) {
+    return Future<>::MakeFinished();
+  }
+
+  auto state = std::make_shared<State>(futures.size());
+  auto all_complete = Future<>::Make();
+  for (const auto& future : futures) {
+    future.AddCallback([state,
+                        all_complete](const Result<detail::Empty>& result) mutable {
+      if (!result.ok()) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->status.ok()) {
+          state->status = result.status();
+        }
+      }
+      if (state->n_remaining.fetch_sub(1) == 1) {
+        all_complete.MarkFinished(state->status);
+      }
+    });
+  }
+  return all_complete;
+}
+
+Future<> AnyComplete(const std::vector<Future<>>& futures) {
+  if (futures.empty()) {
+    return Future<>::MakeFinished();
+  }
+
+  auto completed = std::make_shared<std::atomic<bool>>(false);
+  auto any_complete = Future<>::Make();
+  for (const auto& future : futures) {
+    future.AddCallback([completed,
+                        any_complete](const Result<detail::Empty>& result) mutable {
+      if (!completed->exchange(true)) {
+        any_complete.MarkFinished(result.status());
+      }
+    });
+  }
+  return any_complete;
+}
+
 }  // namespace arrow
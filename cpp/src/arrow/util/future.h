@@ -581,4 +581,18 @@ inline std::vector<int> WaitForAny(const std::vector<Future<T>*>& futures,
   return waiter->MoveFinishedFutures();
 }
 
+/// \brief Create a Future which completes when all of the given futures complete.
+///
+/// The returned Future fails with the status of the first of the futures to fail,
+/// if any; it still waits for every future to complete.
+ARROW_EXPORT
+Future<> AllComplete(const std::vector<Future<>>& futures);
+
+/// \brief Create a Future which completes when any of the given futures completes.
+///
+/// The returned Future takes the status of the first of the futures to complete.
+/// If the given vector is empty, the returned Future is already finished.
+ARROW_EXPORT
+Future<> AnyComplete(const std::vector<Future<>>& futures);
+
 }  // namespace arrow
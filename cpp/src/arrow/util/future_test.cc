@@ -971,6 +971,59 @@ TEST(FutureSyncTest, GetStatusFuture) {
   }
 }
 
+TEST(FutureSyncTest, AllComplete) {
+  {
+    auto all = AllComplete({});
+    AssertSuccessful(all);
+  }
+  {
+    std::vector<Future<>> futures{Future<>::Make(), Future<>::MakeFinished(),
+                                  Future<>::Make()};
+    auto all = AllComplete(futures);
+    AssertNotFinished(all);
+    futures[2].MarkFinished();
+    AssertNotFinished(all);
+    futures[0].MarkFinished();
+    AssertSuccessful(all);
+  }
+  {
+    // The first failure is reported once every future completed
+    std::vector<Future<>> futures{Future<>::Make(), Future<>::Make(),
+                                  Future<>::Make()};
+    auto all = AllComplete(futures);
+    futures[1].MarkFinished(Status::IOError("first"));
+    AssertNotFinished(all);
+    futures[0].MarkFinished(Status::Invalid("second"));
+    futures[2].MarkFinished();
+    AssertFailed(all);
+    ASSERT_RAISES(IOError, all.status());
+  }
+}
+
+TEST(FutureSyncTest, AnyComplete) {
+  {
+    auto any = AnyComplete({});
+    AssertSuccessful(any);
+  }
+  {
+    std::vector<Future<>> futures{Future<>::Make(), Future<>::Make()};
+    auto any = AnyComplete(futures);
+    AssertNotFinished(any);
+    futures[1].MarkFinished();
+    AssertSuccessful(any);
+    futures[0].MarkFinished(Status::IOError("late"));
+    AssertSuccessful(any);
+  }
+  {
+    std::vector<Future<>> futures{Future<>::Make(), Future<>::Make()};
+    auto any = AnyComplete(futures);
+    futures[0].MarkFinished(Status::IOError("first"));
+    AssertFailed(any);
+    futures[1].MarkFinished();
+    ASSERT_RAISES(IOError, any.status());
+  }
+}
+
 // --------------------------------------------------------------------
 // Tests with an executor
 
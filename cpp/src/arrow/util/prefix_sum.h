@@ -0,0 +1,168 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/util/simd.h"
+
+#include <stdint.h>
+#include <type_traits>
+
+#ifdef ARROW_HAVE_SSE4_2
+// Enable the SIMD prefix sum used by delta decoders
+#define ARROW_HAVE_SIMD_PREFIX_SUM
+#endif  // ARROW_HAVE_SSE4_2
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+// The functions below turn a run of deltas into the values they encode, in place:
+//
+//   values[i] = values[i - 1] + values[i] + offset, with values[-1] = base
+//
+// The arithmetic wraps around on overflow, as with unsigned integers. The last
+// value is returned so that the next run of deltas can carry on from it.
+
+template <typename T>
+T PrefixSumScalar(T* values, int64_t length, T offset, T base) {
+  static_assert(std::is_integral<T>::value, "Prefix sum is only for integers.");
+  using UT = typename std::make_unsigned<T>::type;
+  UT sum = static_cast<UT>(base);
+  const UT unsigned_offset = static_cast<UT>(offset);
+  for (int64_t i = 0; i < length; ++i) {
+    sum += static_cast<UT>(values[i]) + unsigned_offset;
+    values[i] = static_cast<T>(sum);
+  }
+  return static_cast<T>(sum);
+}
+
+#if defined(ARROW_HAVE_SSE4_2)
+template <typename T>
+T PrefixSumSse2(T* values, int64_t length, T offset, T base) {
+  constexpr int64_t kNumLanes = sizeof(__m128i) / sizeof(T);
+  static_assert(kNumLanes == 4 || kNumLanes == 2, "Invalid integer width.");
+
+  const int64_t num_blocks = length / kNumLanes;
+  __m128i* data = reinterpret_cast<__m128i*>(values);
+  __m128i offsets, carry;
+  if (kNumLanes == 4) {
+    offsets = _mm_set1_epi32(static_cast<int32_t>(offset));
+    carry = _mm_set1_epi32(static_cast<int32_t>(base));
+  } else {
+    offsets = _mm_set1_epi64x(static_cast<int64_t>(offset));
+    carry = _mm_set1_epi64x(static_cast<int64_t>(base));
+  }
+
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    __m128i x = _mm_loadu_si128(data + i);
+    if (kNumLanes == 4) {
+      // In-register scan in log2(4) shift-and-add steps, then add the last
+      // value of the previous block broadcast to all lanes
+      x = _mm_add_epi32(x, offsets);
+      x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+      x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+      x = _mm_add_epi32(x, carry);
+      carry = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+    } else {
+      x = _mm_add_epi64(x, offsets);
+      x = _mm_add_epi64(x, _mm_slli_si128(x, 8));
+      x = _mm_add_epi64(x, carry);
+      carry = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+    _mm_storeu_si128(data + i, x);
+  }
+
+  const int64_t num_processed = num_blocks * kNumLanes;
+  const T last = num_blocks > 0 ? values[num_processed - 1] : base;
+  return PrefixSumScalar(values + num_processed, length - num_processed, offset, last);
+}
+#endif  // ARROW_HAVE_SSE4_2
+
+#if defined(ARROW_HAVE_AVX2)
+template <typename T>
+T PrefixSumAvx2(T* values, int64_t length, T offset, T base) {
+  constexpr int64_t kNumLanes = sizeof(__m256i) / sizeof(T);
+  static_assert(kNumLanes == 8 || kNumLanes == 4, "Invalid integer width.");
+
+  const int64_t num_blocks = length / kNumLanes;
+  __m256i* data = reinterpret_cast<__m256i*>(values);
+  __m256i offsets, carry;
+  if (kNumLanes == 8) {
+    offsets = _mm256_set1_epi32(static_cast<int32_t>(offset));
+    carry = _mm256_set1_epi32(static_cast<int32_t>(base));
+  } else {
+    offsets = _mm256_set1_epi64x(static_cast<int64_t>(offset));
+    carry = _mm256_set1_epi64x(static_cast<int64_t>(base));
+  }
+
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    __m256i x = _mm256_loadu_si256(data + i);
+    // Byte shifts only work within each 128-bit lane: scan both lanes
+    // independently, then add the last value of the low lane to the high lane.
+    // _mm256_permute2x128_si256(x, x, 0x08) yields [0, low lane of x].
+    if (kNumLanes == 8) {
+      x = _mm256_add_epi32(x, offsets);
+      x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+      x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+      const __m256i low = _mm256_permute2x128_si256(x, x, 0x08);
+      x = _mm256_add_epi32(x, _mm256_shuffle_epi32(low, _MM_SHUFFLE(3, 3, 3, 3)));
+      x = _mm256_add_epi32(x, carry);
+      carry = _mm256_permutevar8x32_epi32(x, _mm256_set1_epi32(7));
+    } else {
+      x = _mm256_add_epi64(x, offsets);
+      x = _mm256_add_epi64(x, _mm256_slli_si256(x, 8));
+      const __m256i low = _mm256_permute2x128_si256(x, x, 0x08);
+      x = _mm256_add_epi64(x, _mm256_shuffle_epi32(low, _MM_SHUFFLE(3, 2, 3, 2)));
+      x = _mm256_add_epi64(x, carry);
+      carry = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+    _mm256_storeu_si256(data + i, x);
+  }
+
+  const int64_t num_processed = num_blocks * kNumLanes;
+  const T last = num_blocks > 0 ? values[num_processed - 1] : base;
+  return PrefixSumScalar(values + num_processed, length - num_processed, offset, last);
+}
+#endif  // ARROW_HAVE_AVX2
+
+#if defined(ARROW_HAVE_SIMD_PREFIX_SUM)
+template <typename T>
+T PrefixSumSimd(T* values, int64_t length, T offset, T base) {
+#if defined(ARROW_HAVE_AVX2)
+  return PrefixSumAvx2(values, length, offset, base);
+#elif defined(ARROW_HAVE_SSE4_2)
+  return PrefixSumSse2(values, length, offset, base);
+#else
+#error "PrefixSumSimd not implemented"
+#endif
+}
+#endif  // ARROW_HAVE_SIMD_PREFIX_SUM
+
+template <typename T>
+T PrefixSum(T* values, int64_t length, T offset, T base) {
+  static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Invalid integer width.");
+#if defined(ARROW_HAVE_SIMD_PREFIX_SUM)
+  return PrefixSumSimd(values, length, offset, base);
+#else
+  return PrefixSumScalar(values, length, offset, base);
+#endif
+}
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
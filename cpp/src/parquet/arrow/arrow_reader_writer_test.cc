@@ -32,7 +32,10 @@
 #include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_decimal.h"
 #include "arrow/array/builder_dict.h"
+#include "arrow/array/builder_nested.h"
 #include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api.h"
 #include "arrow/record_batch.h"
@@ -45,7 +48,9 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/optional.h"
 #include "arrow/util/range.h"
+#include "arrow/util/thread_pool.h"
 
 #include "parquet/api/reader.h"
 #include "parquet/api/writer.h"
@@ -2251,6 +2256,115 @@ TEST(TestArrowReadWrite, GetRecordBatchReaderNoColumns) {
   ASSERT_EQ(actual_batch->num_rows(), num_rows);
 }
 
+TEST(TestArrowReadWrite, ReadFilteredRowGroup) {
+  const int num_rows = 2000;
+  ::arrow::Int64Builder id_builder;
+  ::arrow::Int32Builder value_builder;
+  ::arrow::StringBuilder name_builder;
+  auto x_builder = std::make_shared<::arrow::DoubleBuilder>();
+  auto point_type = ::arrow::struct_({::arrow::field("x", ::arrow::float64())});
+  ::arrow::StructBuilder point_builder(point_type, default_memory_pool(), {x_builder});
+  for (int i = 0; i < num_rows; ++i) {
+    ASSERT_OK(id_builder.Append(i));
+    ASSERT_OK(i % 7 == 0 ? value_builder.AppendNull() : value_builder.Append(i * 3));
+    ASSERT_OK(i % 11 == 0 ? name_builder.AppendNull()
+                          : name_builder.Append("name" + std::to_string(i % 50)));
+    ASSERT_OK(point_builder.Append(i % 13 != 0));
+    ASSERT_OK(x_builder->Append(i * 0.5));
+  }
+  ASSERT_OK_AND_ASSIGN(auto ids, id_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto values, value_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto names, name_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto points, point_builder.Finish());
+  auto schema =
+      ::arrow::schema({::arrow::field("id", ::arrow::int64(), /*nullable=*/false),
+                       ::arrow::field("value", ::arrow::int32()),
+                       ::arrow::field("name", ::arrow::utf8()),
+                       ::arrow::field("point", point_type)});
+  auto table = Table::Make(schema, {ids, values, names, points});
+
+  // Sparse rows, and a run spanning several pages; a null selection drops the row
+  auto Keep = [](int64_t id) -> ::arrow::util::optional<bool> {
+    if (id == 1005) return ::arrow::util::nullopt;
+    return id % 100 < 5 || (id >= 1000 && id < 1300);
+  };
+  parquet::arrow::RowFilter filter =
+      [&](const std::shared_ptr<::arrow::RecordBatch>& batch)
+      -> ::arrow::Result<std::shared_ptr<Array>> {
+    EXPECT_EQ(1, batch->num_columns());
+    const auto& batch_ids = checked_cast<const ::arrow::Int64Array&>(*batch->column(0));
+    ::arrow::BooleanBuilder builder;
+    for (int64_t i = 0; i < batch_ids.length(); ++i) {
+      auto keep = Keep(batch_ids.Value(i));
+      RETURN_NOT_OK(keep ? builder.Append(*keep) : builder.AppendNull());
+    }
+    return builder.Finish();
+  };
+
+  for (bool write_page_index : {false, true}) {
+    WriterProperties::Builder writer_properties;
+    writer_properties.write_batch_size(100)->data_pagesize(1024);
+    if (write_page_index) writer_properties.enable_write_page_index();
+    auto sink = CreateOutputStream();
+    ASSERT_OK_NO_THROW(WriteTable(*table, default_memory_pool(), sink, num_rows,
+                                  writer_properties.build(),
+                                  default_arrow_writer_properties()));
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    for (bool read_dictionary : {false, true}) {
+      ArrowReaderProperties properties = default_arrow_reader_properties();
+      properties.set_read_dictionary(2, read_dictionary);
+      std::unique_ptr<FileReader> reader;
+      FileReaderBuilder builder;
+      ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+      ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+      for (const auto& row_ranges : std::vector<std::vector<RowRange>>{
+               {{0, num_rows}}, {{2, 1}, {300, 900}}, {}}) {
+        ::arrow::BooleanBuilder mask_builder;
+        auto range = row_ranges.begin();
+        for (int64_t i = 0; i < num_rows; ++i) {
+          while (range != row_ranges.end() && range->end() <= i) ++range;
+          bool in_ranges = range != row_ranges.end() && range->offset <= i;
+          ASSERT_OK(mask_builder.Append(in_ranges && Keep(i).value_or(false)));
+        }
+        ASSERT_OK_AND_ASSIGN(auto mask, mask_builder.Finish());
+        ASSERT_OK_AND_ASSIGN(auto expected, ::arrow::compute::Filter(table, mask));
+
+        std::shared_ptr<Table> actual;
+        ASSERT_OK_NO_THROW(reader->ReadFilteredRowGroup(0, row_ranges, {0, 1, 2, 3},
+                                                        {0}, filter, &actual));
+        ASSERT_OK(actual->ValidateFull());
+        if (read_dictionary) {
+          ASSERT_EQ(::arrow::Type::DICTIONARY, actual->schema()->field(2)->type()->id());
+          ASSERT_OK_AND_ASSIGN(
+              auto dense, ::arrow::compute::Cast(actual->column(2), ::arrow::utf8()));
+          ASSERT_OK_AND_ASSIGN(
+              actual, actual->SetColumn(2, schema->field(2), dense.chunked_array()));
+        }
+        AssertTablesEqual(*expected.table(), *actual, /*same_chunk_layout=*/false);
+      }
+    }
+
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                default_memory_pool(), &reader));
+    std::shared_ptr<Table> actual;
+    // The columns read for the filter need not be read
+    ASSERT_OK_NO_THROW(
+        reader->ReadFilteredRowGroup(0, {{0, num_rows}}, {1}, {0}, filter, &actual));
+    ASSERT_EQ(1, actual->num_columns());
+    ASSERT_EQ(384, actual->num_rows());
+
+    parquet::arrow::RowFilter bad_filter =
+        [](const std::shared_ptr<::arrow::RecordBatch>& batch) {
+          return ::arrow::MakeArrayFromScalar(::arrow::BooleanScalar(true), 1);
+        };
+    ASSERT_RAISES(Invalid, reader->ReadFilteredRowGroup(0, {{0, num_rows}}, {1}, {0},
+                                                        bad_filter, &actual));
+  }
+}
+
 TEST(TestArrowReadWrite, ScanContents) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -2299,6 +2413,195 @@ TEST(TestArrowReadWrite, ReadColumnSubset) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*expected, *result));
 }
 
+TEST(TestArrowReadWrite, ReadColumnSlicesInParallel) {
+  // A tall table with a nested column and a large binary column, whose column
+  // chunks span many pages
+  const int num_rows = 10000;
+  ::arrow::Int64Builder id_builder;
+  ::arrow::BinaryBuilder payload_builder;
+  for (int i = 0; i < num_rows; ++i) {
+    ASSERT_OK(id_builder.Append(i));
+    ASSERT_OK(i % 5 == 0 ? payload_builder.AppendNull()
+                         : payload_builder.Append(std::string(i % 64, 'a' + i % 26)));
+  }
+  ASSERT_OK_AND_ASSIGN(auto ids, id_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto payloads, payload_builder.Finish());
+  auto lists =
+      ArrayFromJSON(::arrow::list(::arrow::int32()), "[[1, 2], null, [], [3]]");
+  ASSERT_OK_AND_ASSIGN(auto repeated_lists,
+                       ::arrow::Concatenate(ArrayVector(num_rows / 4, lists)));
+  auto table = Table::Make(::arrow::schema({::arrow::field("id", ::arrow::int64()),
+                                            ::arrow::field("payload", ::arrow::binary()),
+                                            ::arrow::field("list", lists->type())}),
+                           {ids, payloads, repeated_lists});
+
+  const int capacity = ::arrow::GetCpuThreadPoolCapacity();
+  ASSERT_OK(::arrow::SetCpuThreadPoolCapacity(8));
+  // Without page index, the pages are located by scanning their headers
+  for (bool write_page_index : {true, false}) {
+    WriterProperties::Builder builder;
+    builder.write_batch_size(100)->data_pagesize(1024);
+    if (write_page_index) builder.enable_write_page_index();
+    auto sink = CreateOutputStream();
+    ASSERT_OK_NO_THROW(WriteTable(*table, default_memory_pool(), sink, num_rows / 2,
+                                  builder.build(), default_arrow_writer_properties()));
+    ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+    for (const auto& column_subset :
+         std::vector<std::vector<int>>{{0, 1, 2}, {1}, {2}}) {
+      std::unique_ptr<FileReader> reader;
+      ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                  default_memory_pool(), &reader));
+      std::shared_ptr<Table> expected, result;
+      ASSERT_OK_NO_THROW(reader->ReadTable(column_subset, &expected));
+      reader->set_use_threads(true);
+      ASSERT_OK_NO_THROW(reader->ReadTable(column_subset, &result));
+      ASSERT_OK(result->ValidateFull());
+      ::arrow::AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false);
+
+      // Flat column chunks are split into several slices
+      if (column_subset == std::vector<int>{1}) {
+        ASSERT_GE(result->column(0)->num_chunks(), 4);
+      }
+    }
+  }
+  ASSERT_OK(::arrow::SetCpuThreadPoolCapacity(capacity));
+}
+
+TEST(TestArrowReadWrite, WriteColumnsInParallel) {
+  const int num_rows = 10000;
+  ::arrow::Int64Builder id_builder;
+  ::arrow::BinaryBuilder payload_builder;
+  for (int i = 0; i < num_rows; ++i) {
+    ASSERT_OK(id_builder.Append(i));
+    ASSERT_OK(i % 5 == 0 ? payload_builder.AppendNull()
+                         : payload_builder.Append(std::string(i % 64, 'a' + i % 26)));
+  }
+  ASSERT_OK_AND_ASSIGN(auto ids, id_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto payloads, payload_builder.Finish());
+  auto lists =
+      ArrayFromJSON(::arrow::list(::arrow::int32()), "[[1, 2], null, [], [3]]");
+  ASSERT_OK_AND_ASSIGN(auto repeated_lists,
+                       ::arrow::Concatenate(ArrayVector(num_rows / 4, lists)));
+  auto structs = ArrayFromJSON(
+      ::arrow::struct_({::arrow::field("a", ::arrow::int32()),
+                        ::arrow::field("b", ::arrow::utf8())}),
+      R"([{"a": 1, "b": "x"}, null, {"a": null, "b": "yy"}, {"a": 4, "b": null}])");
+  ASSERT_OK_AND_ASSIGN(auto repeated_structs,
+                       ::arrow::Concatenate(ArrayVector(num_rows / 4, structs)));
+  auto table = Table::Make(::arrow::schema({::arrow::field("id", ::arrow::int64()),
+                                            ::arrow::field("payload", ::arrow::binary()),
+                                            ::arrow::field("list", lists->type()),
+                                            ::arrow::field("struct", structs->type())}),
+                           {ids, payloads, repeated_lists, repeated_structs});
+
+  auto writer_properties = WriterProperties::Builder()
+                               .data_pagesize(1024)
+                               ->enable_write_page_index()
+                               ->build();
+  auto WriteToBuffer = [&](bool use_threads, std::shared_ptr<Buffer>* out) {
+    auto arrow_writer_properties =
+        ArrowWriterProperties::Builder().set_use_threads(use_threads)->build();
+    auto sink = CreateOutputStream();
+    ASSERT_OK_NO_THROW(WriteTable(*table, default_memory_pool(), sink, num_rows / 3,
+                                  writer_properties, arrow_writer_properties));
+    ASSERT_OK_AND_ASSIGN(*out, sink->Finish());
+  };
+
+  const int capacity = ::arrow::GetCpuThreadPoolCapacity();
+  ASSERT_OK(::arrow::SetCpuThreadPoolCapacity(8));
+  std::shared_ptr<Buffer> expected, buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteToBuffer(false, &expected));
+  ASSERT_NO_FATAL_FAILURE(WriteToBuffer(true, &buffer));
+  ASSERT_OK(::arrow::SetCpuThreadPoolCapacity(capacity));
+
+  // Column chunks are serialized in order, with the same layout
+  ::arrow::AssertBufferEqual(*expected, *buffer);
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(
+      OpenFile(std::make_shared<BufferReader>(buffer), default_memory_pool(), &reader));
+  ASSERT_EQ(4, reader->num_row_groups());
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_OK(result->ValidateFull());
+  ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+}
+
+TEST(TestArrowReadWrite, WriteRecordBatchByBytes) {
+  // Batches of 100 rows of about 10KB each
+  const int num_batches = 10;
+  const int batch_size = 100;
+  const int64_t max_row_group_bytes = 256 * 1024;
+  auto schema = ::arrow::schema({::arrow::field("id", ::arrow::int64()),
+                                 ::arrow::field("blob", ::arrow::binary())});
+  std::vector<std::shared_ptr<::arrow::RecordBatch>> batches;
+  for (int b = 0; b < num_batches; ++b) {
+    ::arrow::Int64Builder id_builder;
+    ::arrow::BinaryBuilder blob_builder;
+    for (int i = 0; i < batch_size; ++i) {
+      const int id = b * batch_size + i;
+      ASSERT_OK(id_builder.Append(id));
+      ASSERT_OK(
+          blob_builder.Append(std::to_string(id) + std::string(10000, 'a' + id % 26)));
+    }
+    ASSERT_OK_AND_ASSIGN(auto ids, id_builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto blobs, blob_builder.Finish());
+    batches.push_back(::arrow::RecordBatch::Make(schema, batch_size, {ids, blobs}));
+  }
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(batches));
+
+  auto WriteBatches = [&](std::shared_ptr<WriterProperties> writer_properties,
+                          std::shared_ptr<Buffer>* out) {
+    auto sink = CreateOutputStream();
+    std::unique_ptr<FileWriter> writer;
+    ASSERT_OK_NO_THROW(FileWriter::Open(*schema, default_memory_pool(), sink,
+                                        writer_properties, &writer));
+    for (const auto& batch : batches) {
+      ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*batch));
+    }
+    ASSERT_OK_NO_THROW(writer->Close());
+    ASSERT_OK_AND_ASSIGN(*out, sink->Finish());
+  };
+  auto CheckRoundtrip = [&](const std::shared_ptr<Buffer>& buffer,
+                            std::unique_ptr<FileReader>* reader) {
+    ASSERT_OK_NO_THROW(
+        OpenFile(std::make_shared<BufferReader>(buffer), default_memory_pool(), reader));
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW((*reader)->ReadTable(&result));
+    ASSERT_OK(result->ValidateFull());
+    ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+  };
+
+  // Row groups are flushed once they reach max_row_group_bytes, whatever the
+  // number of rows of the batches
+  std::shared_ptr<Buffer> buffer;
+  std::unique_ptr<FileReader> reader;
+  ASSERT_NO_FATAL_FAILURE(WriteBatches(
+      WriterProperties::Builder().max_row_group_bytes(max_row_group_bytes)->build(),
+      &buffer));
+  ASSERT_NO_FATAL_FAILURE(CheckRoundtrip(buffer, &reader));
+  auto metadata = reader->parquet_reader()->metadata();
+  ASSERT_GE(metadata->num_row_groups(), 4);
+  for (int i = 0; i < metadata->num_row_groups(); ++i) {
+    auto row_group = metadata->RowGroup(i);
+    ASSERT_LE(row_group->total_byte_size(), 2 * max_row_group_bytes);
+    if (i + 1 < metadata->num_row_groups()) {
+      ASSERT_GE(row_group->total_byte_size(), max_row_group_bytes);
+    }
+  }
+
+  // Row groups span batches up to max_row_group_length rows
+  ASSERT_NO_FATAL_FAILURE(WriteBatches(
+      WriterProperties::Builder().max_row_group_length(300)->build(), &buffer));
+  ASSERT_NO_FATAL_FAILURE(CheckRoundtrip(buffer, &reader));
+  metadata = reader->parquet_reader()->metadata();
+  ASSERT_EQ(4, metadata->num_row_groups());
+  for (int i = 0; i < metadata->num_row_groups(); ++i) {
+    ASSERT_EQ(i < 3 ? 300 : 100, metadata->RowGroup(i)->num_rows());
+  }
+}
+
 TEST(TestArrowReadWrite, ReadCoalescedColumnSubset) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -3735,6 +4038,124 @@ TEST_P(TestArrowReadDictionary, ReadWholeFileDense) {
   CheckReadWholeFile(*expected_dense_);
 }
 
+TEST_P(TestArrowReadDictionary, AutoReadDictionary) {
+  properties_.set_auto_read_dictionary(true);
+  WriteSimple();
+
+  // Each row group is read with its own dictionary
+  auto chunk_size = options.num_rows / options.num_row_groups;
+  std::vector<std::shared_ptr<Array>> chunks(options.num_row_groups);
+  for (int i = 0; i < options.num_row_groups; ++i) {
+    AsDictionary32Encoded(*dense_values_->Slice(chunk_size * i, chunk_size), &chunks[i]);
+  }
+  auto ex_table = MakeSimpleTable(std::make_shared<ChunkedArray>(chunks),
+                                  /*nullable=*/true);
+  CheckReadWholeFile(*ex_table);
+
+  // Columns which are not dictionary encoded are read as dense arrays
+  auto writer_properties = WriterProperties::Builder().disable_dictionary()->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*expected_dense_, default_memory_pool(), sink,
+                                chunk_size, writer_properties,
+                                default_arrow_writer_properties()));
+  ASSERT_OK_AND_ASSIGN(buffer_, sink->Finish());
+  CheckReadWholeFile(*expected_dense_);
+}
+
+TEST_P(TestArrowReadDictionary, AutoReadDictionaryFallback) {
+  if (GetParam() == 1) {
+    GTEST_SKIP() << "Nothing to fall back from when all the values are null";
+  }
+  properties_.set_auto_read_dictionary(true);
+
+  // Columns whose dictionary encoding fell back to PLAIN are read as dense
+  // arrays, although their column chunks have a dictionary page
+  auto writer_properties = WriterProperties::Builder()
+                               .dictionary_pagesize_limit(256)
+                               ->write_batch_size(64)
+                               ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*expected_dense_, default_memory_pool(), sink,
+                                options.num_rows / options.num_row_groups,
+                                writer_properties, default_arrow_writer_properties()));
+  ASSERT_OK_AND_ASSIGN(buffer_, sink->Finish());
+  ASSERT_OK_AND_ASSIGN(auto reader, GetReader());
+  auto column_chunk = reader->parquet_reader()->metadata()->RowGroup(0)->ColumnChunk(0);
+  ASSERT_TRUE(column_chunk->has_dictionary_page());
+  CheckReadWholeFile(*expected_dense_);
+}
+
+TEST_P(TestArrowReadDictionary, ReadDictionaryFallback) {
+  properties_.set_read_dictionary(0, true);
+
+  // Dictionary encoding falls back to PLAIN once the dictionary page holds a
+  // few values, within each row group
+  auto writer_properties = WriterProperties::Builder()
+                               .dictionary_pagesize_limit(256)
+                               ->write_batch_size(64)
+                               ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*expected_dense_, default_memory_pool(), sink,
+                                options.num_rows / options.num_row_groups,
+                                writer_properties, default_arrow_writer_properties()));
+  ASSERT_OK_AND_ASSIGN(buffer_, sink->Finish());
+
+  ASSERT_OK_AND_ASSIGN(auto reader, GetReader());
+  std::shared_ptr<Table> actual;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+  ASSERT_OK(actual->ValidateFull());
+  ASSERT_EQ(::arrow::Type::DICTIONARY, actual->column(0)->type()->id());
+  if (GetParam() < 1) {
+    // The dictionary encoded and PLAIN pages are read into separate chunks
+    ASSERT_GT(actual->column(0)->num_chunks(), options.num_row_groups);
+  }
+  ASSERT_OK_AND_ASSIGN(auto dense,
+                       ::arrow::compute::Cast(actual->column(0), ::arrow::utf8()));
+  ::arrow::AssertChunkedEquivalent(*expected_dense_->column(0), *dense.chunked_array());
+}
+
+TEST_P(TestArrowReadDictionary, ReadDictionaryFallbackRowGroups) {
+  properties_.set_read_dictionary(0, true);
+
+  // Each row group holds its own values, which fall back to PLAIN after a few
+  // pages
+  const int num_row_groups = 4;
+  const int num_rows = 500;
+  const int num_uniques = 50;
+  ::arrow::StringBuilder builder;
+  for (int i = 0; i < num_row_groups; ++i) {
+    for (int j = 0; j < num_rows; ++j) {
+      ASSERT_OK(builder.Append("rg" + std::to_string(i) + "_" +
+                               std::to_string(j % num_uniques)));
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto values, builder.Finish());
+  auto table = MakeSimpleTable(std::make_shared<ChunkedArray>(values),
+                               /*nullable=*/false);
+  auto writer_properties = WriterProperties::Builder()
+                               .dictionary_pagesize_limit(256)
+                               ->write_batch_size(64)
+                               ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*table, default_memory_pool(), sink, num_rows,
+                                writer_properties, default_arrow_writer_properties()));
+  ASSERT_OK_AND_ASSIGN(buffer_, sink->Finish());
+
+  ASSERT_OK_AND_ASSIGN(auto reader, GetReader());
+  std::shared_ptr<Table> actual;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+  ASSERT_OK(actual->ValidateFull());
+  ASSERT_GT(actual->column(0)->num_chunks(), num_row_groups);
+  // The dictionary of each chunk only holds the values of its row group
+  for (const auto& chunk : actual->column(0)->chunks()) {
+    const auto& dict_array = checked_cast<const ::arrow::DictionaryArray&>(*chunk);
+    ASSERT_LE(dict_array.dictionary()->length(), num_uniques);
+  }
+  ASSERT_OK_AND_ASSIGN(auto dense,
+                       ::arrow::compute::Cast(actual->column(0), ::arrow::utf8()));
+  ::arrow::AssertChunkedEquivalent(*table->column(0), *dense.chunked_array());
+}
+
 INSTANTIATE_TEST_SUITE_P(
     ReadDictionary, TestArrowReadDictionary,
     ::testing::ValuesIn(TestArrowReadDictionary::null_probabilities()));
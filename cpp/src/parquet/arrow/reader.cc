@@ -24,17 +24,23 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/extension_type.h"
 #include "arrow/io/memory.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
 #include "arrow/util/parallel.h"
 #include "arrow/util/range.h"
+#include "arrow/util/thread_pool.h"
 #include "parquet/arrow/reader_internal.h"
 #include "parquet/column_reader.h"
 #include "parquet/exception.h"
@@ -90,6 +96,26 @@ namespace {
   }
 }
 
+// Whether the column chunk's encoding stats show that all its data pages are
+// dictionary encoded, i.e. that the writer didn't fall back to another encoding
+bool AllDataPagesDictionaryEncoded(const ColumnChunkMetaData& column_chunk) {
+  const auto& encoding_stats = column_chunk.encoding_stats();
+  if (!column_chunk.has_dictionary_page() || encoding_stats.empty()) {
+    return false;
+  }
+  for (const auto& stats : encoding_stats) {
+    if (stats.page_type != PageType::DATA_PAGE &&
+        stats.page_type != PageType::DATA_PAGE_V2) {
+      continue;
+    }
+    if (stats.encoding != Encoding::PLAIN_DICTIONARY &&
+        stats.encoding != Encoding::RLE_DICTIONARY) {
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace
 
 class ColumnReaderImpl : public ColumnReader {
@@ -110,6 +136,12 @@ class ColumnReaderImpl : public ColumnReader {
 
   virtual ::arrow::Status LoadBatch(int64_t num_records) = 0;
 
+  // Load the records within row_ranges, which are sorted, non-overlapping and
+  // relative to the current position, skipping the records in between
+  virtual ::arrow::Status LoadRowRanges(const std::vector<RowRange>& row_ranges) {
+    return Status::NotImplemented("Reading row ranges of field ", field()->ToString());
+  }
+
   virtual ::arrow::Status BuildArray(int64_t length_upper_bound,
                                      std::shared_ptr<::arrow::ChunkedArray>* out) = 0;
   virtual bool IsOrHasRepeatedChild() const = 0;
@@ -140,14 +172,37 @@ class FileReaderImpl : public FileReader {
         reader_properties_(std::move(properties)) {}
 
   Status Init() {
+    if (reader_properties_.auto_read_dictionary()) {
+      BEGIN_PARQUET_CATCH_EXCEPTIONS
+      SetReadDictionaryIfEncoded();
+      END_PARQUET_CATCH_EXCEPTIONS
+    }
     return SchemaManifest::Make(reader_->metadata()->schema(),
                                 reader_->metadata()->key_value_metadata(),
                                 reader_properties_, &manifest_);
   }
 
-  FileColumnIteratorFactory SomeRowGroupsFactory(std::vector<int> row_groups) {
-    return [row_groups](int i, ParquetFileReader* reader) {
-      return new FileColumnIterator(i, reader, row_groups);
+  // Read the BYTE_ARRAY columns as dictionaries when all the data pages of
+  // all their column chunks are dictionary encoded
+  void SetReadDictionaryIfEncoded() {
+    const FileMetaData& metadata = *reader_->metadata();
+    if (metadata.num_row_groups() == 0) return;
+    for (int i = 0; i < metadata.num_columns(); ++i) {
+      if (metadata.schema()->Column(i)->physical_type() != Type::BYTE_ARRAY) continue;
+      bool encoded = true;
+      for (int r = 0; r < metadata.num_row_groups() && encoded; ++r) {
+        encoded = AllDataPagesDictionaryEncoded(*metadata.RowGroup(r)->ColumnChunk(i));
+      }
+      if (encoded) reader_properties_.set_read_dictionary(i, true);
+    }
+  }
+
+  FileColumnIteratorFactory SomeRowGroupsFactory(
+      std::vector<int> row_groups,
+      std::shared_ptr<const std::vector<RowRange>> row_ranges = NULLPTR,
+      std::shared_ptr<OffsetIndex> offset_index = NULLPTR) {
+    return [row_groups, row_ranges, offset_index](int i, ParquetFileReader* reader) {
+      return new FileColumnIterator(i, reader, row_groups, row_ranges, offset_index);
     };
   }
 
@@ -193,23 +248,26 @@ class FileReaderImpl : public FileReader {
     return ReadRowGroups(Iota(reader_->metadata()->num_row_groups()), indices, out);
   }
 
-  Status GetFieldReader(int i,
-                        const std::shared_ptr<std::unordered_set<int>>& included_leaves,
-                        const std::vector<int>& row_groups,
-                        std::unique_ptr<ColumnReaderImpl>* out) {
+  Status GetFieldReader(
+      int i, const std::shared_ptr<std::unordered_set<int>>& included_leaves,
+      const std::vector<int>& row_groups, std::unique_ptr<ColumnReaderImpl>* out,
+      std::shared_ptr<const std::vector<RowRange>> row_ranges = NULLPTR,
+      std::shared_ptr<OffsetIndex> offset_index = NULLPTR) {
     auto ctx = std::make_shared<ReaderContext>();
     ctx->reader = reader_.get();
     ctx->pool = pool_;
-    ctx->iterator_factory = SomeRowGroupsFactory(row_groups);
+    ctx->iterator_factory = SomeRowGroupsFactory(row_groups, std::move(row_ranges),
+                                                 std::move(offset_index));
     ctx->filter_leaves = true;
     ctx->included_leaves = included_leaves;
     return GetReader(manifest_.schema_fields[i], ctx, out);
   }
 
-  Status GetFieldReaders(const std::vector<int>& column_indices,
-                         const std::vector<int>& row_groups,
-                         std::vector<std::shared_ptr<ColumnReaderImpl>>* out,
-                         std::shared_ptr<::arrow::Schema>* out_schema) {
+  Status GetFieldReaders(
+      const std::vector<int>& column_indices, const std::vector<int>& row_groups,
+      std::vector<std::shared_ptr<ColumnReaderImpl>>* out,
+      std::shared_ptr<::arrow::Schema>* out_schema,
+      std::shared_ptr<const std::vector<RowRange>> row_ranges = NULLPTR) {
     // We only need to read schema fields which have columns indicated
     // in the indices vector
     ARROW_ASSIGN_OR_RAISE(std::vector<int> field_indices,
@@ -221,8 +279,8 @@ class FileReaderImpl : public FileReader {
     ::arrow::FieldVector out_fields(field_indices.size());
     for (size_t i = 0; i < out->size(); ++i) {
       std::unique_ptr<ColumnReaderImpl> reader;
-      RETURN_NOT_OK(
-          GetFieldReader(field_indices[i], included_leaves, row_groups, &reader));
+      RETURN_NOT_OK(GetFieldReader(field_indices[i], included_leaves, row_groups,
+                                   &reader, row_ranges));
 
       out_fields[i] = reader->field();
       out->at(i) = std::move(reader);
@@ -288,6 +346,12 @@ class FileReaderImpl : public FileReader {
                        const std::vector<int>& indices,
                        std::shared_ptr<Table>* table) override;
 
+  // Read the given columns of the row groups on the CPU thread pool, each task
+  // reading a column chunk or the rows of a range of its pages
+  Status ReadColumnSlices(const std::vector<int>& row_groups,
+                          const std::vector<int>& column_indices,
+                          std::shared_ptr<Table>* out);
+
   Status ReadRowGroups(const std::vector<int>& row_groups,
                        std::shared_ptr<Table>* table) override {
     return ReadRowGroups(row_groups, Iota(reader_->metadata()->num_columns()), table);
@@ -312,6 +376,24 @@ class FileReaderImpl : public FileReader {
                                 Iota(reader_->metadata()->num_columns()), out);
   }
 
+  Status GetRecordBatchReader(int row_group_index,
+                              const std::vector<int>& column_indices,
+                              const std::vector<RowRange>& row_ranges,
+                              std::unique_ptr<RecordBatchReader>* out) override;
+
+  // Read the given rows of each row group, or all of them if row_ranges is null
+  Status GetRecordBatchReader(const std::vector<int>& row_groups,
+                              const std::vector<int>& column_indices,
+                              std::shared_ptr<const std::vector<RowRange>> row_ranges,
+                              std::unique_ptr<RecordBatchReader>* out);
+
+  Status ReadFilteredRowGroup(int row_group_index,
+                              const std::vector<RowRange>& row_ranges,
+                              const std::vector<int>& column_indices,
+                              const std::vector<int>& filter_column_indices,
+                              const RowFilter& filter,
+                              std::shared_ptr<Table>* out) override;
+
   int num_columns() const { return reader_->metadata()->num_columns(); }
 
   ParquetFileReader* parquet_reader() const override { return reader_.get(); }
@@ -457,6 +539,34 @@ class LeafReader : public ColumnReaderImpl {
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
+  Status LoadRowRanges(const std::vector<RowRange>& row_ranges) final {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    out_ = nullptr;
+    record_reader_->Reset();
+    int64_t num_records = 0;
+    for (const auto& range : row_ranges) num_records += range.length;
+    record_reader_->Reserve(num_records);
+
+    int64_t position = 0;
+    for (const auto& range : row_ranges) {
+      if (record_reader_->SkipRecords(range.offset - position) !=
+          range.offset - position) {
+        ParquetException::EofException();
+      }
+      int64_t records_to_read = range.length;
+      while (records_to_read > 0) {
+        int64_t records_read = record_reader_->ReadRecords(records_to_read);
+        if (records_read == 0) ParquetException::EofException();
+        records_to_read -= records_read;
+      }
+      position = range.end();
+    }
+    RETURN_NOT_OK(TransferColumnData(record_reader_.get(), field_->type(), descr_,
+                                     ctx_->pool, &out_));
+    return Status::OK();
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
   ::arrow::Status BuildArray(int64_t length_upper_bound,
                              std::shared_ptr<::arrow::ChunkedArray>* out) final {
     *out = out_;
@@ -498,6 +608,10 @@ class ExtensionReader : public ColumnReaderImpl {
     return storage_reader_->LoadBatch(number_of_records);
   }
 
+  Status LoadRowRanges(const std::vector<RowRange>& row_ranges) final {
+    return storage_reader_->LoadRowRanges(row_ranges);
+  }
+
   Status BuildArray(int64_t length_upper_bound,
                     std::shared_ptr<ChunkedArray>* out) override {
     std::shared_ptr<ChunkedArray> storage;
@@ -882,6 +996,41 @@ Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>&
 Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
                                             const std::vector<int>& column_indices,
                                             std::unique_ptr<RecordBatchReader>* out) {
+  return GetRecordBatchReader(row_groups, column_indices, NULLPTR, out);
+}
+
+Status FileReaderImpl::GetRecordBatchReader(int row_group_index,
+                                            const std::vector<int>& column_indices,
+                                            const std::vector<RowRange>& row_ranges,
+                                            std::unique_ptr<RecordBatchReader>* out) {
+  RETURN_NOT_OK(BoundsCheck({row_group_index}, column_indices));
+
+  std::vector<RowRange> aligned_ranges;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  auto row_group_reader = reader_->RowGroup(row_group_index);
+  std::vector<std::shared_ptr<OffsetIndex>> offset_indexes;
+  for (int column_index : column_indices) {
+    offset_indexes.push_back(row_group_reader->GetOffsetIndex(column_index));
+  }
+  aligned_ranges = AlignRowRanges(row_ranges, offset_indexes,
+                                  row_group_reader->metadata()->num_rows());
+  END_PARQUET_CATCH_EXCEPTIONS
+
+  std::shared_ptr<const std::vector<RowRange>> selected_ranges;
+  int64_t num_rows = reader_->metadata()->RowGroup(row_group_index)->num_rows();
+  if (!(aligned_ranges.size() == 1 && aligned_ranges[0] == RowRange{0, num_rows})) {
+    // Some pages can be skipped
+    selected_ranges =
+        std::make_shared<const std::vector<RowRange>>(std::move(aligned_ranges));
+  }
+  return GetRecordBatchReader({row_group_index}, column_indices,
+                              std::move(selected_ranges), out);
+}
+
+Status FileReaderImpl::GetRecordBatchReader(
+    const std::vector<int>& row_groups, const std::vector<int>& column_indices,
+    std::shared_ptr<const std::vector<RowRange>> row_ranges,
+    std::unique_ptr<RecordBatchReader>* out) {
   RETURN_NOT_OK(BoundsCheck(row_groups, column_indices));
 
   if (reader_properties_.pre_buffer()) {
@@ -894,7 +1043,17 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
 
   std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
   std::shared_ptr<::arrow::Schema> batch_schema;
-  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &batch_schema));
+  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &batch_schema,
+                                row_ranges));
+
+  auto RowGroupNumRows = [&](int row_group) {
+    if (row_ranges) {
+      int64_t num_rows = 0;
+      for (const auto& range : *row_ranges) num_rows += range.length;
+      return num_rows;
+    }
+    return parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+  };
 
   if (readers.empty()) {
     // Just generate all batches right now; they're cheap since they have no columns.
@@ -905,7 +1064,7 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
     ::arrow::RecordBatchVector batches;
 
     for (int row_group : row_groups) {
-      int64_t num_rows = parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+      int64_t num_rows = RowGroupNumRows(row_group);
 
       batches.insert(batches.end(), num_rows / batch_size, max_sized_batch);
 
@@ -922,7 +1081,7 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
 
   int64_t num_rows = 0;
   for (int row_group : row_groups) {
-    num_rows += parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+    num_rows += RowGroupNumRows(row_group);
   }
 
   using ::arrow::RecordBatchIterator;
@@ -964,6 +1123,235 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
   return Status::OK();
 }
 
+namespace {
+
+::arrow::Result<std::shared_ptr<Array>> ConcatenateChunks(const ChunkedArray& column,
+                                                         MemoryPool* pool) {
+  if (column.num_chunks() == 1) return column.chunk(0);
+  if (column.num_chunks() == 0) return ::arrow::MakeArrayOfNull(column.type(), 0, pool);
+  return ::arrow::Concatenate(column.chunks(), pool);
+}
+
+/// \brief Compute the bitmap of the rows selected by a filter: the rows
+/// within row_ranges, where the filter returned true.
+///
+/// \param[in] selection the BooleanArray returned by the filter
+/// \param[in] row_ranges the ranges of rows of the row group to select from
+/// \param[in] filtered_ranges the ranges of rows of the row group the filter
+/// was evaluated on, in order; a superset of row_ranges
+::arrow::Result<std::shared_ptr<::arrow::Buffer>> SelectionBitmap(
+    const Array& selection, const std::vector<RowRange>& row_ranges,
+    const std::vector<RowRange>& filtered_ranges, MemoryPool* pool) {
+  const auto& data = *selection.data();
+  ARROW_ASSIGN_OR_RAISE(auto bitmap, ::arrow::AllocateEmptyBitmap(data.length, pool));
+  // Mark the filtered rows within row_ranges
+  auto range = row_ranges.begin();
+  int64_t position = 0;
+  for (const auto& filtered : filtered_ranges) {
+    while (range != row_ranges.end() && range->end() <= filtered.offset) ++range;
+    for (auto it = range; it != row_ranges.end() && it->offset < filtered.end(); ++it) {
+      const int64_t begin = std::max(it->offset, filtered.offset);
+      const int64_t end = std::min(it->end(), filtered.end());
+      ::arrow::BitUtil::SetBitsTo(bitmap->mutable_data(),
+                                  position + begin - filtered.offset, end - begin, true);
+    }
+    position += filtered.length;
+  }
+
+  std::shared_ptr<::arrow::Buffer> out;
+  ARROW_ASSIGN_OR_RAISE(out, ::arrow::internal::BitmapAnd(
+                                 pool, bitmap->data(), 0, data.buffers[1]->data(),
+                                 data.offset, data.length, 0));
+  if (selection.null_count() > 0) {
+    // Null selection values drop the row
+    ARROW_ASSIGN_OR_RAISE(out, ::arrow::internal::BitmapAnd(
+                                   pool, out->data(), 0, data.buffers[0]->data(),
+                                   data.offset, data.length, 0));
+  }
+  return out;
+}
+
+/// \brief Compute the ranges of rows of the row group set in a bitmap over
+/// the rows of filtered_ranges.
+std::vector<RowRange> SelectedRowRanges(const uint8_t* bitmap, int64_t length,
+                                        const std::vector<RowRange>& filtered_ranges) {
+  std::vector<RowRange> out;
+  auto range = filtered_ranges.begin();
+  // The position of the first row of *range among the filtered rows
+  int64_t range_position = 0;
+  ::arrow::internal::VisitSetBitRunsVoid(
+      bitmap, 0, length, [&](int64_t position, int64_t length) {
+        while (length > 0) {
+          while (position >= range_position + range->length) {
+            range_position += range->length;
+            ++range;
+          }
+          const int64_t row = range->offset + (position - range_position);
+          const int64_t run_length =
+              std::min(length, range_position + range->length - position);
+          if (!out.empty() && out.back().end() == row) {
+            out.back().length += run_length;
+          } else {
+            out.push_back({row, run_length});
+          }
+          position += run_length;
+          length -= run_length;
+        }
+      });
+  return out;
+}
+
+}  // namespace
+
+Status FileReaderImpl::ReadFilteredRowGroup(int row_group_index,
+                                            const std::vector<RowRange>& row_ranges,
+                                            const std::vector<int>& column_indices,
+                                            const std::vector<int>& filter_column_indices,
+                                            const RowFilter& filter,
+                                            std::shared_ptr<Table>* out) {
+  RETURN_NOT_OK(BoundsCheck({row_group_index}, column_indices));
+  RETURN_NOT_OK(BoundsCheck({row_group_index}, filter_column_indices));
+  const int64_t num_rows = reader_->metadata()->RowGroup(row_group_index)->num_rows();
+
+  // First, read the filter columns at the pages holding row_ranges
+  std::shared_ptr<::parquet::RowGroupReader> row_group_reader;
+  std::vector<RowRange> filtered_ranges;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  row_group_reader = reader_->RowGroup(row_group_index);
+  std::vector<std::shared_ptr<OffsetIndex>> offset_indexes;
+  for (int column_index : filter_column_indices) {
+    offset_indexes.push_back(row_group_reader->GetOffsetIndex(column_index));
+  }
+  filtered_ranges = AlignRowRanges(row_ranges, offset_indexes, num_rows);
+  END_PARQUET_CATCH_EXCEPTIONS
+
+  std::shared_ptr<const std::vector<RowRange>> filter_pages_ranges;
+  if (!(filtered_ranges.size() == 1 && filtered_ranges[0] == RowRange{0, num_rows})) {
+    filter_pages_ranges = std::make_shared<const std::vector<RowRange>>(filtered_ranges);
+  }
+  int64_t num_filtered_rows = 0;
+  for (const auto& range : filtered_ranges) num_filtered_rows += range.length;
+
+  std::vector<std::shared_ptr<ColumnReaderImpl>> filter_readers;
+  std::shared_ptr<::arrow::Schema> filter_schema;
+  RETURN_NOT_OK(GetFieldReaders(filter_column_indices, {row_group_index},
+                                &filter_readers, &filter_schema, filter_pages_ranges));
+  ::arrow::ArrayVector filter_columns(filter_readers.size());
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      reader_properties_.use_threads(), static_cast<int>(filter_readers.size()),
+      [&](int i) -> Status {
+        std::shared_ptr<ChunkedArray> column;
+        RETURN_NOT_OK(filter_readers[i]->NextBatch(num_filtered_rows, &column));
+        return ConcatenateChunks(*column, pool_).Value(&filter_columns[i]);
+      }));
+
+  ARROW_ASSIGN_OR_RAISE(
+      std::shared_ptr<Array> selection,
+      filter(::arrow::RecordBatch::Make(filter_schema, num_filtered_rows,
+                                        filter_columns)));
+  if (selection->type_id() != ::arrow::Type::BOOL ||
+      selection->length() != num_filtered_rows) {
+    return Status::Invalid("A row filter must return a boolean array of ",
+                           num_filtered_rows, " values, got ", *selection->type(),
+                           " array of ", selection->length(), " values");
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      auto selection_bitmap,
+      SelectionBitmap(*selection, row_ranges, filtered_ranges, pool_));
+  selection = std::make_shared<BooleanArray>(num_filtered_rows, selection_bitmap);
+  std::vector<RowRange> selected =
+      SelectedRowRanges(selection_bitmap->data(), num_filtered_rows, filtered_ranges);
+  int64_t num_selected = 0;
+  for (const auto& range : selected) num_selected += range.length;
+
+  // Then read the other columns at the selected rows only
+  ARROW_ASSIGN_OR_RAISE(std::vector<int> field_indices,
+                        manifest_.GetFieldIndices(column_indices));
+  ARROW_ASSIGN_OR_RAISE(std::vector<int> filter_field_indices,
+                        manifest_.GetFieldIndices(filter_column_indices));
+  auto included_leaves = VectorToSharedSet(column_indices);
+  ::arrow::compute::ExecContext exec_context(pool_);
+
+  // The selection over the whole row group, for the nested columns
+  std::shared_ptr<Array> row_group_selection;
+  for (int field_index : field_indices) {
+    if (manifest_.schema_fields[field_index].is_leaf()) continue;
+    ARROW_ASSIGN_OR_RAISE(auto bitmap, ::arrow::AllocateEmptyBitmap(num_rows, pool_));
+    for (const auto& range : selected) {
+      ::arrow::BitUtil::SetBitsTo(bitmap->mutable_data(), range.offset, range.length,
+                                  true);
+    }
+    row_group_selection = std::make_shared<BooleanArray>(num_rows, bitmap);
+    break;
+  }
+
+  ::arrow::FieldVector fields(field_indices.size());
+  ::arrow::ChunkedArrayVector columns(field_indices.size());
+  auto ReadField = [&](int i) -> Status {
+    const SchemaField& schema_field = manifest_.schema_fields[field_indices[i]];
+    auto filter_field = std::find(filter_field_indices.begin(),
+                                  filter_field_indices.end(), field_indices[i]);
+    if (schema_field.is_leaf() && filter_field != filter_field_indices.end()) {
+      // Already read for the filter
+      const auto j = filter_field - filter_field_indices.begin();
+      fields[i] = filter_schema->field(static_cast<int>(j));
+      ARROW_ASSIGN_OR_RAISE(
+          auto filtered,
+          ::arrow::compute::Filter(filter_columns[j], selection,
+                                   ::arrow::compute::FilterOptions::Defaults(),
+                                   &exec_context));
+      columns[i] = std::make_shared<ChunkedArray>(filtered.make_array());
+      return Status::OK();
+    }
+
+    std::unique_ptr<ColumnReaderImpl> reader;
+    if (!schema_field.is_leaf()) {
+      RETURN_NOT_OK(
+          GetFieldReader(field_indices[i], included_leaves, {row_group_index}, &reader));
+      std::shared_ptr<ChunkedArray> column;
+      RETURN_NOT_OK(reader->NextBatch(num_rows, &column));
+      ARROW_ASSIGN_OR_RAISE(
+          auto filtered,
+          ::arrow::compute::Filter(column, row_group_selection,
+                                   ::arrow::compute::FilterOptions::Defaults(),
+                                   &exec_context));
+      fields[i] = reader->field();
+      columns[i] = filtered.chunked_array();
+      return Status::OK();
+    }
+
+    // Only read the pages holding selected rows, when they can be located
+    std::shared_ptr<const std::vector<RowRange>> pages_ranges;
+    std::vector<RowRange> ranges = selected;
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    const int column_index = schema_field.column_index;
+    auto offset_index = row_group_reader->GetOffsetIndex(column_index);
+    if (offset_index != nullptr &&
+        row_group_reader->metadata()->ColumnChunk(column_index)->crypto_metadata() ==
+            nullptr) {
+      pages_ranges = std::make_shared<const std::vector<RowRange>>(selected);
+      ranges = offset_index->RowRangesInSelectedPages(selected, num_rows);
+    }
+    END_PARQUET_CATCH_EXCEPTIONS
+    RETURN_NOT_OK(GetFieldReader(field_indices[i], included_leaves, {row_group_index},
+                                 &reader, std::move(pages_ranges)));
+    RETURN_NOT_OK(reader->LoadRowRanges(ranges));
+    RETURN_NOT_OK(reader->BuildArray(num_selected, &columns[i]));
+    fields[i] = reader->field();
+    for (const auto& chunk : columns[i]->chunks()) {
+      RETURN_NOT_OK(chunk->Validate());
+    }
+    return Status::OK();
+  };
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      reader_properties_.use_threads(), static_cast<int>(field_indices.size()),
+      ReadField));
+
+  *out = Table::Make(::arrow::schema(std::move(fields), manifest_.schema_metadata),
+                     std::move(columns), num_selected);
+  return (*out)->Validate();
+}
+
 Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_factory,
                                  std::unique_ptr<ColumnReader>* out) {
   RETURN_NOT_OK(BoundsCheckColumn(i));
@@ -992,6 +1380,15 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
+  // With fewer columns than threads, also read the row groups of each column,
+  // and the pages of each column chunk, in parallel
+  if (reader_properties_.use_threads() && !row_groups.empty() &&
+      !column_indices.empty() &&
+      static_cast<int>(column_indices.size()) <
+          ::arrow::GetCpuThreadPoolCapacity()) {
+    return ReadColumnSlices(row_groups, column_indices, out);
+  }
+
   std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
   std::shared_ptr<::arrow::Schema> result_schema;
   RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &result_schema));
@@ -1015,6 +1412,119 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
   return (*out)->Validate();
 }
 
+namespace {
+
+// The part of a column read by a single task of FileReaderImpl::ReadColumnSlices
+struct ColumnSlice {
+  // The index of the field among those read
+  int field;
+  int row_group;
+  // The rows of a range of pages, or null for the whole column chunk
+  std::shared_ptr<const std::vector<RowRange>> row_ranges;
+  // Locates the pages of row_ranges
+  std::shared_ptr<OffsetIndex> offset_index;
+  int64_t num_rows;
+};
+
+}  // namespace
+
+Status FileReaderImpl::ReadColumnSlices(const std::vector<int>& row_groups,
+                                        const std::vector<int>& column_indices,
+                                        std::shared_ptr<Table>* out) {
+  ARROW_ASSIGN_OR_RAISE(std::vector<int> field_indices,
+                        manifest_.GetFieldIndices(column_indices));
+  auto included_leaves = VectorToSharedSet(column_indices);
+  const int num_fields = static_cast<int>(field_indices.size());
+
+  // Split the column chunks into enough slices to keep every thread busy.
+  // Column chunks can only be split at page boundaries, which are record
+  // boundaries in non-repeated columns. They are located by the OffsetIndex of
+  // the column chunk or, for files without page indexes, by scanning its page
+  // headers.
+  const int64_t num_column_chunks = num_fields * static_cast<int64_t>(row_groups.size());
+  const int64_t capacity = ::arrow::GetCpuThreadPoolCapacity();
+  const int64_t slices_per_chunk = (capacity + num_column_chunks - 1) / num_column_chunks;
+
+  std::vector<ColumnSlice> slices;
+  int64_t num_rows = 0;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  for (int row_group : row_groups) {
+    num_rows += reader_->metadata()->RowGroup(row_group)->num_rows();
+  }
+  for (int f = 0; f < num_fields; ++f) {
+    const SchemaField& schema_field = manifest_.schema_fields[field_indices[f]];
+    for (int row_group : row_groups) {
+      auto row_group_reader = reader_->RowGroup(row_group);
+      const int64_t row_group_num_rows = row_group_reader->metadata()->num_rows();
+      const int column = schema_field.column_index;
+      std::shared_ptr<OffsetIndex> offset_index;
+      if (slices_per_chunk > 1 && schema_field.is_leaf() &&
+          schema_field.level_info.rep_level == 0 &&
+          !row_group_reader->metadata()->ColumnChunk(column)->crypto_metadata()) {
+        offset_index = row_group_reader->GetOffsetIndex(column);
+        if (offset_index == nullptr) {
+          offset_index = row_group_reader->ScanOffsetIndex(column);
+        }
+      }
+      const int num_pages = offset_index ? offset_index->num_pages() : 1;
+      const int num_slices =
+          static_cast<int>(std::min<int64_t>(slices_per_chunk, num_pages));
+      if (num_slices <= 1) {
+        slices.push_back({f, row_group, nullptr, nullptr, row_group_num_rows});
+        continue;
+      }
+      // Slices of about the same number of pages
+      const auto& locations = offset_index->page_locations();
+      for (int i = 0; i < num_slices; ++i) {
+        const int first_page = num_pages * i / num_slices;
+        const int end_page = num_pages * (i + 1) / num_slices;
+        const int64_t begin = locations[first_page].first_row_index;
+        const int64_t end = end_page < num_pages ? locations[end_page].first_row_index
+                                                 : row_group_num_rows;
+        auto row_ranges = std::make_shared<const std::vector<RowRange>>(
+            std::vector<RowRange>{{begin, end - begin}});
+        slices.push_back(
+            {f, row_group, std::move(row_ranges), offset_index, end - begin});
+      }
+    }
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+
+  // Each task reads (and decompresses) the pages of its slice, then decodes them
+  ::arrow::FieldVector slice_fields(slices.size());
+  ::arrow::ChunkedArrayVector slice_columns(slices.size());
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      /*use_threads=*/true, static_cast<int>(slices.size()), [&](int i) -> Status {
+        const ColumnSlice& slice = slices[i];
+        std::unique_ptr<ColumnReaderImpl> reader;
+        RETURN_NOT_OK(GetFieldReader(field_indices[slice.field], included_leaves,
+                                     {slice.row_group}, &reader, slice.row_ranges,
+                                     slice.offset_index));
+        slice_fields[i] = reader->field();
+        BEGIN_PARQUET_CATCH_EXCEPTIONS
+        return reader->NextBatch(slice.num_rows, &slice_columns[i]);
+        END_PARQUET_CATCH_EXCEPTIONS
+      }));
+
+  // Stitch the chunks of the slices of each field, in order
+  ::arrow::FieldVector fields(num_fields);
+  std::vector<::arrow::ArrayVector> chunks(num_fields);
+  for (size_t i = 0; i < slices.size(); ++i) {
+    const int f = slices[i].field;
+    if (fields[f] == nullptr) fields[f] = slice_fields[i];
+    const auto& slice_chunks = slice_columns[i]->chunks();
+    chunks[f].insert(chunks[f].end(), slice_chunks.begin(), slice_chunks.end());
+  }
+  ::arrow::ChunkedArrayVector columns(num_fields);
+  for (int f = 0; f < num_fields; ++f) {
+    columns[f] = std::make_shared<ChunkedArray>(std::move(chunks[f]), fields[f]->type());
+  }
+
+  *out = Table::Make(::arrow::schema(std::move(fields), manifest_.schema_metadata),
+                     std::move(columns), num_rows);
+  return (*out)->Validate();
+}
+
 std::shared_ptr<RowGroupReader> FileReaderImpl::RowGroup(int row_group_index) {
   return std::make_shared<RowGroupReaderImpl>(this, row_group_index);
 }
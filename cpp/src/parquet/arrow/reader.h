@@ -18,15 +18,18 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <vector>
 
+#include "arrow/result.h"
 #include "parquet/file_reader.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 
 namespace arrow {
 
+class Array;
 class ChunkedArray;
 class KeyValueMetadata;
 class RecordBatchReader;
@@ -49,6 +52,13 @@ class ColumnReader;
 struct SchemaManifest;
 class RowGroupReader;
 
+/// \brief A predicate on the rows of a RecordBatch.
+///
+/// Returns a BooleanArray of the same length as the batch, which is true for
+/// the rows to keep. The rows for which it is null are dropped.
+using RowFilter = std::function<::arrow::Result<std::shared_ptr<::arrow::Array>>(
+    const std::shared_ptr<::arrow::RecordBatch>&)>;
+
 /// \brief Arrow read adapter class for deserializing Parquet files as Arrow row batches.
 ///
 /// This interfaces caters for different use cases and thus provides different
@@ -179,6 +189,43 @@ class PARQUET_EXPORT FileReader {
                                        const std::vector<int>& column_indices,
                                        std::shared_ptr<::arrow::RecordBatchReader>* out);
 
+  /// \brief Return a RecordBatchReader of the rows of a row group which are
+  /// within row_ranges, whose columns are selected by column_indices.
+  ///
+  /// Only the data pages holding a selected row are read, as located by the
+  /// OffsetIndex of each column. The ranges are first widened to the page
+  /// boundaries shared by the selected columns (see parquet::AlignRowRanges),
+  /// so the batches may also hold rows outside of row_ranges. If a selected
+  /// column has no OffsetIndex, the whole row group is read.
+  ///
+  /// \returns error Status if row_group_index or column_indices contains an
+  ///     invalid index
+  virtual ::arrow::Status GetRecordBatchReader(
+      int row_group_index, const std::vector<int>& column_indices,
+      const std::vector<RowRange>& row_ranges,
+      std::unique_ptr<::arrow::RecordBatchReader>* out) = 0;
+
+  /// \brief Read the rows of a row group which are within row_ranges and
+  /// satisfy filter, decoding the columns selected by column_indices only at
+  /// those rows.
+  ///
+  /// The columns selected by filter_column_indices are read first, from the
+  /// pages holding rows within row_ranges as for GetRecordBatchReader, and are
+  /// given to filter. The columns selected by column_indices are then read at
+  /// the rows filter keeps: their data pages holding none of these rows are
+  /// not read (when located by an OffsetIndex), and the values of the other
+  /// rows are skipped rather than converted. Leaf columns which were read for
+  /// the filter are not read again. Nested columns are read whole, then
+  /// filtered.
+  ///
+  /// \returns error Status if row_group_index, column_indices or
+  ///     filter_column_indices contains an invalid index, or if filter fails
+  virtual ::arrow::Status ReadFilteredRowGroup(
+      int row_group_index, const std::vector<RowRange>& row_ranges,
+      const std::vector<int>& column_indices,
+      const std::vector<int>& filter_column_indices, const RowFilter& filter,
+      std::shared_ptr<::arrow::Table>* out) = 0;
+
   /// Read all columns into a Table
   virtual ::arrow::Status ReadTable(std::shared_ptr<::arrow::Table>* out) = 0;
 
@@ -216,6 +263,12 @@ class PARQUET_EXPORT FileReader {
 
   /// Set whether to use multiple threads during reads of multiple columns.
   /// By default only one thread is used.
+  ///
+  /// When reading fewer columns than there are CPU threads, the row groups of
+  /// each column are also read in parallel, and the column chunks of
+  /// non-repeated columns are split into ranges of pages read in parallel.
+  /// The pages are located by the OffsetIndex of the column chunk or, if the
+  /// file has no page indexes, by reading the page headers beforehand.
   virtual void set_use_threads(bool use_threads) = 0;
 
   /// Set number of records to read per batch for the RecordBatchReader.
@@ -61,12 +61,19 @@ class ColumnReaderImpl;
 // so we can read only a single row group if we want
 class FileColumnIterator {
  public:
-  explicit FileColumnIterator(int column_index, ParquetFileReader* reader,
-                              std::vector<int> row_groups)
+  // If row_ranges is given, only the pages holding those rows are read from
+  // each row group. They are located with offset_index if given, which then
+  // applies to a single row group, or with the OffsetIndex of the file.
+  explicit FileColumnIterator(
+      int column_index, ParquetFileReader* reader, std::vector<int> row_groups,
+      std::shared_ptr<const std::vector<RowRange>> row_ranges = NULLPTR,
+      std::shared_ptr<OffsetIndex> offset_index = NULLPTR)
       : column_index_(column_index),
         reader_(reader),
         schema_(reader->metadata()->schema()),
-        row_groups_(row_groups.begin(), row_groups.end()) {}
+        row_groups_(row_groups.begin(), row_groups.end()),
+        row_ranges_(std::move(row_ranges)),
+        offset_index_(std::move(offset_index)) {}
 
   virtual ~FileColumnIterator() {}
 
@@ -77,6 +84,13 @@ class FileColumnIterator {
 
     auto row_group_reader = reader_->RowGroup(row_groups_.front());
     row_groups_.pop_front();
+    if (row_ranges_ && offset_index_) {
+      return row_group_reader->GetColumnPageReader(column_index_, *row_ranges_,
+                                                   *offset_index_);
+    }
+    if (row_ranges_) {
+      return row_group_reader->GetColumnPageReader(column_index_, *row_ranges_);
+    }
     return row_group_reader->GetColumnPageReader(column_index_);
   }
 
@@ -93,6 +107,8 @@ class FileColumnIterator {
   ParquetFileReader* reader_;
   const SchemaDescriptor* schema_;
   std::deque<int> row_groups_;
+  std::shared_ptr<const std::vector<RowRange>> row_ranges_;
+  std::shared_ptr<OffsetIndex> offset_index_;
 };
 
 using FileColumnIteratorFactory =
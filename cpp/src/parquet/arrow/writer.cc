@@ -28,12 +28,14 @@
 #include "arrow/buffer_builder.h"
 #include "arrow/extension_type.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/base64.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 
 #include "parquet/arrow/path_internal.h"
@@ -60,6 +62,7 @@ using arrow::ListArray;
 using arrow::MemoryPool;
 using arrow::NumericArray;
 using arrow::PrimitiveArray;
+using arrow::RecordBatch;
 using arrow::ResizableBuffer;
 using arrow::Status;
 using arrow::Table;
@@ -114,21 +117,34 @@ class ArrowColumnWriterV2 {
   // A ChunkedArray).
   // level_builders should contain one MultipathLevelBuilder per chunk of the
   // Arrow-column to write.
+  // column_index is the index of the first leaf column to write. If
+  // buffered_row_group is true, row_group_writer was created by
+  // ParquetFileWriter::AppendBufferedRowGroup().
   ArrowColumnWriterV2(std::vector<std::unique_ptr<MultipathLevelBuilder>> level_builders,
-                      int leaf_count, RowGroupWriter* row_group_writer)
+                      int leaf_count, RowGroupWriter* row_group_writer, int column_index,
+                      bool buffered_row_group)
       : level_builders_(std::move(level_builders)),
         leaf_count_(leaf_count),
-        row_group_writer_(row_group_writer) {}
+        row_group_writer_(row_group_writer),
+        column_index_(column_index),
+        buffered_row_group_(buffered_row_group) {}
 
   // Writes out all leaf parquet columns to the RowGroupWriter that this
   // object was constructed with.  Each leaf column is written fully before
-  // the next column is written (i.e. no buffering is assumed).
+  // the next column is written.
   //
-  // Columns are written in DFS order.
+  // Columns are written in DFS order. The column writers of a buffered row
+  // group are left open, to be serialized in order when the row group is
+  // closed, so that distinct columns of it may be written concurrently.
   Status Write(ArrowWriteContext* ctx) {
     for (int leaf_idx = 0; leaf_idx < leaf_count_; leaf_idx++) {
       ColumnWriter* column_writer;
-      PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->NextColumn());
+      if (buffered_row_group_) {
+        PARQUET_CATCH_NOT_OK(column_writer =
+                                 row_group_writer_->column(column_index_ + leaf_idx));
+      } else {
+        PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->NextColumn());
+      }
       for (auto& level_builder : level_builders_) {
         RETURN_NOT_OK(level_builder->Write(
             leaf_idx, ctx, [&](const MultipathLevelBuilderResult& result) {
@@ -148,7 +164,9 @@ class ArrowColumnWriterV2 {
             }));
       }
 
-      PARQUET_CATCH_NOT_OK(column_writer->Close());
+      if (!buffered_row_group_) {
+        PARQUET_CATCH_NOT_OK(column_writer->Close());
+      }
     }
     return Status::OK();
   }
@@ -163,14 +181,16 @@ class ArrowColumnWriterV2 {
   // RowGroupWriters (we could construct each builder on demand in that case).
   static ::arrow::Result<std::unique_ptr<ArrowColumnWriterV2>> Make(
       const ChunkedArray& data, int64_t offset, const int64_t size,
-      const SchemaManifest& schema_manifest, RowGroupWriter* row_group_writer) {
+      const SchemaManifest& schema_manifest, RowGroupWriter* row_group_writer,
+      int column_index, bool buffered_row_group) {
     int64_t absolute_position = 0;
     int chunk_index = 0;
     int64_t chunk_offset = 0;
     if (data.length() == 0) {
       return ::arrow::internal::make_unique<ArrowColumnWriterV2>(
           std::vector<std::unique_ptr<MultipathLevelBuilder>>{},
-          CalculateLeafCount(data.type().get()), row_group_writer);
+          CalculateLeafCount(data.type().get()), row_group_writer, column_index,
+          buffered_row_group);
     }
     while (chunk_index < data.num_chunks() && absolute_position < offset) {
       const int64_t chunk_length = data.chunk(chunk_index)->length();
@@ -193,9 +213,6 @@ class ArrowColumnWriterV2 {
     std::vector<std::unique_ptr<MultipathLevelBuilder>> builders;
     const int leaf_count = CalculateLeafCount(data.type().get());
     bool is_nullable = false;
-    // The row_group_writer hasn't been advanced yet so add 1 to the current
-    // which is the one this instance will start writing for.
-    int column_index = row_group_writer->current_column() + 1;
     for (int leaf_offset = 0; leaf_offset < leaf_count; ++leaf_offset) {
       const SchemaField* schema_field = nullptr;
       RETURN_NOT_OK(
@@ -242,7 +259,8 @@ class ArrowColumnWriterV2 {
       values_written += chunk_write_size;
     }
     return ::arrow::internal::make_unique<ArrowColumnWriterV2>(
-        std::move(builders), leaf_count, row_group_writer);
+        std::move(builders), leaf_count, row_group_writer, column_index,
+        buffered_row_group);
   }
 
  private:
@@ -250,6 +268,8 @@ class ArrowColumnWriterV2 {
   std::vector<std::unique_ptr<MultipathLevelBuilder>> level_builders_;
   int leaf_count_;
   RowGroupWriter* row_group_writer_;
+  int column_index_;
+  bool buffered_row_group_;
 };
 
 }  // namespace
@@ -265,11 +285,18 @@ class FileWriterImpl : public FileWriter {
       : schema_(std::move(schema)),
         writer_(std::move(writer)),
         row_group_writer_(nullptr),
+        buffered_row_group_(false),
         column_write_context_(pool, arrow_properties.get()),
         arrow_properties_(std::move(arrow_properties)),
         closed_(false) {}
 
   Status Init() {
+    // The index of the first leaf column of each field
+    int column_index = 0;
+    for (const auto& field : schema_->fields()) {
+      first_leaf_columns_.push_back(column_index);
+      column_index += CalculateLeafCount(field->type().get());
+    }
     return SchemaManifest::Make(writer_->schema(), /*schema_metadata=*/nullptr,
                                 default_arrow_reader_properties(), &schema_manifest_);
   }
@@ -279,6 +306,64 @@ class FileWriterImpl : public FileWriter {
       PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
     }
     PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendRowGroup());
+    buffered_row_group_ = false;
+    return Status::OK();
+  }
+
+  Status NewBufferedRowGroup() override {
+    if (row_group_writer_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    }
+    PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+    buffered_row_group_ = true;
+    return Status::OK();
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    if (!batch.schema()->Equals(*schema_, false)) {
+      return Status::Invalid("record batch schema does not match this writer's. batch:'",
+                             batch.schema()->ToString(), "' this:'", schema_->ToString(),
+                             "'");
+    }
+    std::vector<std::shared_ptr<ChunkedArray>> columns;
+    for (const auto& column : batch.columns()) {
+      columns.push_back(std::make_shared<ChunkedArray>(column));
+    }
+
+    const int64_t max_rows = properties().max_row_group_length();
+    const int64_t max_bytes = properties().max_row_group_bytes();
+    int64_t offset = 0;
+    while (offset < batch.num_rows()) {
+      if (row_group_writer_ == nullptr || !buffered_row_group_) {
+        RETURN_NOT_OK(NewBufferedRowGroup());
+      }
+      int64_t num_rows, num_bytes;
+      PARQUET_CATCH_NOT_OK(num_rows = row_group_writer_->num_rows());
+      num_bytes = row_group_writer_->total_buffered_bytes();
+
+      // Write the rows estimated to fit in the row group from the average size
+      // of the rows buffered so far, at most doubling their number so that a
+      // few rows larger than the average can't exceed max_bytes by much
+      int64_t size = std::min(batch.num_rows() - offset, max_rows - num_rows);
+      if (num_rows == 0) {
+        size = std::min<int64_t>(size, 1);
+      } else if (num_bytes > 0) {
+        const double row_bytes = static_cast<double>(num_bytes) / num_rows;
+        const auto fitting_rows =
+            static_cast<int64_t>((max_bytes - num_bytes) / row_bytes);
+        size = std::min(size, std::min(num_rows, std::max<int64_t>(fitting_rows, 1)));
+      } else {
+        size = std::min(size, num_rows);
+      }
+      RETURN_NOT_OK(WriteBufferedColumns(columns, offset, size));
+      offset += size;
+
+      if (num_rows + size >= max_rows ||
+          row_group_writer_->total_buffered_bytes() >= max_bytes) {
+        PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+        row_group_writer_ = nullptr;
+      }
+    }
     return Status::OK();
   }
 
@@ -305,10 +390,14 @@ class FileWriterImpl : public FileWriter {
                           int64_t size) override {
     if (arrow_properties_->engine_version() == ArrowWriterProperties::V2 ||
         arrow_properties_->engine_version() == ArrowWriterProperties::V1) {
+      // The row_group_writer hasn't been advanced yet so add 1 to the current
+      // which is the one this instance will start writing for.
       ARROW_ASSIGN_OR_RAISE(
           std::unique_ptr<ArrowColumnWriterV2> writer,
           ArrowColumnWriterV2::Make(*data, offset, size, schema_manifest_,
-                                    row_group_writer_));
+                                    row_group_writer_,
+                                    row_group_writer_->current_column() + 1,
+                                    /*buffered_row_group=*/false));
       return writer->Write(&column_write_context_);
     }
     return Status::NotImplemented("Unknown engine version.");
@@ -334,6 +423,10 @@ class FileWriterImpl : public FileWriter {
     }
 
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (parallel_column_writes()) {
+        RETURN_NOT_OK(NewBufferedRowGroup());
+        return WriteBufferedColumns(table.columns(), offset, size);
+      }
       RETURN_NOT_OK(NewRowGroup(size));
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -369,12 +462,42 @@ class FileWriterImpl : public FileWriter {
  private:
   friend class FileWriter;
 
+  // Whether the columns of buffered row groups are written concurrently on the
+  // CPU thread pool
+  bool parallel_column_writes() const {
+    return arrow_properties_->use_threads() && schema_->num_fields() > 1 &&
+           properties().file_encryption_properties() == nullptr;
+  }
+
+  // Write rows [offset, offset + size) of each column to the current buffered
+  // row group. Each column is encoded and compressed into its own in-memory
+  // sink, which is serialized in order when the row group is closed.
+  Status WriteBufferedColumns(const std::vector<std::shared_ptr<ChunkedArray>>& columns,
+                              int64_t offset, int64_t size) {
+    auto WriteColumn = [&](int i) -> Status {
+      // The scratch buffers of the write context can't be shared between tasks
+      ArrowWriteContext ctx(column_write_context_.memory_pool, arrow_properties_.get());
+      ARROW_ASSIGN_OR_RAISE(
+          std::unique_ptr<ArrowColumnWriterV2> writer,
+          ArrowColumnWriterV2::Make(*columns[i], offset, size, schema_manifest_,
+                                    row_group_writer_, first_leaf_columns_[i],
+                                    /*buffered_row_group=*/true));
+      return writer->Write(&ctx);
+    };
+    return ::arrow::internal::OptionalParallelFor(
+        parallel_column_writes(), static_cast<int>(columns.size()), WriteColumn);
+  }
+
   std::shared_ptr<::arrow::Schema> schema_;
 
   SchemaManifest schema_manifest_;
 
   std::unique_ptr<ParquetFileWriter> writer_;
   RowGroupWriter* row_group_writer_;
+  // Whether row_group_writer_ was created by AppendBufferedRowGroup()
+  bool buffered_row_group_;
+  // The index of the first leaf column of each field of schema_
+  std::vector<int> first_leaf_columns_;
   ArrowWriteContext column_write_context_;
   std::shared_ptr<ArrowWriterProperties> arrow_properties_;
   bool closed_;
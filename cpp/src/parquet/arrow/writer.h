@@ -27,6 +27,7 @@ namespace arrow {
 
 class Array;
 class ChunkedArray;
+class RecordBatch;
 class Schema;
 class Table;
 
@@ -66,6 +67,20 @@ class PARQUET_EXPORT FileWriter {
   /// \brief Write a Table to Parquet.
   virtual ::arrow::Status WriteTable(const ::arrow::Table& table, int64_t chunk_size) = 0;
 
+  /// \brief Write a RecordBatch to Parquet, buffering its rows in the current
+  /// row group.
+  ///
+  /// A new buffered row group is started if none is being written. Once it
+  /// holds WriterProperties::max_row_group_length() rows, or its estimated size
+  /// reaches WriterProperties::max_row_group_bytes(), the row group is written
+  /// out and the remaining rows go to a new one. The memory used is thus
+  /// bounded by the size of a row group whatever the size of the rows.
+  virtual ::arrow::Status WriteRecordBatch(const ::arrow::RecordBatch& batch) = 0;
+
+  /// \brief Start a new row group whose columns are buffered in memory until
+  /// it is complete, to be written by WriteRecordBatch.
+  virtual ::arrow::Status NewBufferedRowGroup() = 0;
+
   virtual ::arrow::Status NewRowGroup(int64_t chunk_size) = 0;
   virtual ::arrow::Status WriteColumnChunk(const ::arrow::Array& data) = 0;
 
@@ -37,6 +37,12 @@ class PARQUET_EXPORT BloomFilter {
   // This value will be reconsidered when implementing Bloom filter producer.
   static constexpr uint32_t kMaximumBloomFilterBytes = 128 * 1024 * 1024;
 
+  // Hash strategy available for Bloom filter.
+  enum class HashStrategy : uint32_t { MURMUR3_X64_128 = 0, XXHASH = 1 };
+
+  // Bloom filter algorithm.
+  enum class Algorithm : uint32_t { BLOCK = 0 };
+
   /// Determine whether an element exist in set or not.
   ///
   /// @param hash the element to contain.
@@ -101,13 +107,6 @@ class PARQUET_EXPORT BloomFilter {
   virtual uint64_t Hash(const FLBA* value, uint32_t len) const = 0;
 
   virtual ~BloomFilter() {}
-
- protected:
-  // Hash strategy available for Bloom filter.
-  enum class HashStrategy : uint32_t { MURMUR3_X64_128 = 0 };
-
-  // Bloom filter algorithm.
-  enum class Algorithm : uint32_t { BLOCK = 0 };
 };
 
 // The BlockSplitBloomFilter is implemented using block-based Bloom filters from
@@ -121,6 +120,14 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
   /// The constructor of BlockSplitBloomFilter. It uses murmur3_x64_128 as hash function.
   BlockSplitBloomFilter();
 
+  /// Construct a BlockSplitBloomFilter using the given hash function.
+  ///
+  /// Filters using XXHASH follow the Parquet format specification: they are
+  /// serialized with a thrift BloomFilterHeader, and a hash selects its block
+  /// by its upper 32 bits scaled to the number of blocks.  Filters using
+  /// MURMUR3_X64_128 keep the legacy layout and block selection.
+  explicit BlockSplitBloomFilter(HashStrategy hash_strategy);
+
   /// Initialize the BlockSplitBloomFilter. The range of num_bytes should be within
   /// [kMinimumBloomFilterBytes, kMaximumBloomFilterBytes], it will be
   /// rounded up/down to lower/upper bound if num_bytes is out of range and also
@@ -201,6 +208,14 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
   /// @return The BlockSplitBloomFilter.
   static BlockSplitBloomFilter Deserialize(ArrowInputStream* input_stream);
 
+  /// Deserialize a Bloom filter stored as specified by the Parquet format, i.e.
+  /// a thrift BloomFilterHeader followed by the bitset, as written by WriteTo()
+  /// for XXHASH filters.
+  ///
+  /// @param input_stream The input stream from which to construct the Bloom filter
+  /// @return The BlockSplitBloomFilter, which uses XXHASH.
+  static BlockSplitBloomFilter DeserializeWithHeader(ArrowInputStream* input_stream);
+
  private:
   // Bytes in a tiny Bloom filter block.
   static constexpr int kBytesPerFilterBlock = 32;
@@ -224,6 +239,9 @@ class PARQUET_EXPORT BlockSplitBloomFilter : public BloomFilter {
   /// @param mask the mask array is used to set inside a block
   void SetMask(uint32_t key, BlockMask& mask) const;
 
+  /// The index of the tiny Bloom filter that a hash maps to.
+  uint32_t BlockIndex(uint64_t hash) const;
+
   // Memory pool to allocate aligned buffer for bitset
   ::arrow::MemoryPool* pool_;
 
@@ -34,7 +34,9 @@
 #include "parquet/murmur3.h"
 #include "parquet/platform.h"
 #include "parquet/test_util.h"
+#include "parquet/thrift_internal.h"
 #include "parquet/types.h"
+#include "parquet/xxhasher.h"
 
 namespace parquet {
 namespace test {
@@ -90,6 +92,54 @@ TEST(BasicTest, TestBloomFilter) {
   }
 }
 
+TEST(XxHashTest, TestBloomFilter) {
+  XxHasher hasher;
+  // The XXH64 of an empty input with seed 0
+  ByteArray empty(0, nullptr);
+  EXPECT_EQ(UINT64_C(0xEF46DB3751D8E999), hasher.Hash(&empty));
+  // Values are hashed by their plain encoding, without any length prefix
+  int32_t value = 42;
+  ByteArray value_bytes(sizeof(value), reinterpret_cast<const uint8_t*>(&value));
+  EXPECT_EQ(hasher.Hash(value), hasher.Hash(&value_bytes));
+  FLBA value_flba(reinterpret_cast<const uint8_t*>(&value));
+  EXPECT_EQ(hasher.Hash(value), hasher.Hash(&value_flba, sizeof(value)));
+}
+
+// Filters using xxHash are serialized as specified by the Parquet format
+TEST(HeaderTest, TestBloomFilter) {
+  BlockSplitBloomFilter bloom_filter(BloomFilter::HashStrategy::XXHASH);
+  bloom_filter.Init(1024);
+  for (int i = 0; i < 10; i++) {
+    bloom_filter.InsertHash(bloom_filter.Hash(i));
+  }
+
+  auto sink = CreateOutputStream();
+  bloom_filter.WriteTo(sink.get());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  // A thrift BloomFilterHeader, followed by the bitset
+  format::BloomFilterHeader header;
+  uint32_t header_size = static_cast<uint32_t>(buffer->size());
+  DeserializeThriftMsg(buffer->data(), &header_size, &header);
+  EXPECT_EQ(1024, header.numBytes);
+  EXPECT_TRUE(header.algorithm.__isset.BLOCK);
+  EXPECT_TRUE(header.hash.__isset.XXHASH);
+  EXPECT_TRUE(header.compression.__isset.UNCOMPRESSED);
+  EXPECT_EQ(header_size + 1024, buffer->size());
+
+  ::arrow::io::BufferReader source(buffer);
+  BlockSplitBloomFilter de_bloom = BlockSplitBloomFilter::DeserializeWithHeader(&source);
+  EXPECT_EQ(1024, de_bloom.GetBitsetSize());
+  for (int i = 0; i < 10; i++) {
+    EXPECT_TRUE(de_bloom.FindHash(de_bloom.Hash(i)));
+  }
+
+  // Truncated bitset
+  ::arrow::io::BufferReader truncated(SliceBuffer(buffer, 0, buffer->size() - 1));
+  EXPECT_THROW(BlockSplitBloomFilter::DeserializeWithHeader(&truncated),
+               ParquetException);
+}
+
 // Helper function to generate random string.
 std::string GetRandomString(uint32_t length) {
   // Character set used to generate random string
@@ -756,14 +756,12 @@ class ColumnReaderImplBase {
       current_decoder_ = it->second.get();
     } else {
       switch (encoding) {
-        case Encoding::PLAIN: {
-          auto decoder = MakeTypedDecoder<DType>(Encoding::PLAIN, descr_);
-          current_decoder_ = decoder.get();
-          decoders_[static_cast<int>(encoding)] = std::move(decoder);
-          break;
-        }
-        case Encoding::BYTE_STREAM_SPLIT: {
-          auto decoder = MakeTypedDecoder<DType>(Encoding::BYTE_STREAM_SPLIT, descr_);
+        case Encoding::PLAIN:
+        case Encoding::BYTE_STREAM_SPLIT:
+        case Encoding::DELTA_BINARY_PACKED:
+        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+        case Encoding::DELTA_BYTE_ARRAY: {
+          auto decoder = MakeTypedDecoder<DType>(encoding, descr_);
           current_decoder_ = decoder.get();
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
@@ -771,11 +769,6 @@ class ColumnReaderImplBase {
         case Encoding::RLE_DICTIONARY:
           throw ParquetException("Dictionary page must be before data page.");
 
-        case Encoding::DELTA_BINARY_PACKED:
-        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
-        case Encoding::DELTA_BYTE_ARRAY:
-          ParquetException::NYI("Unsupported encoding");
-
         default:
           throw ParquetException("Unknown encoding type.");
       }
@@ -1189,6 +1182,57 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return records_read;
   }
 
+  int64_t SkipRecords(int64_t num_records) override {
+    if (this->max_rep_level_ > 0) {
+      ParquetException::NYI("Skipping records of repeated columns");
+    }
+    int64_t records_skipped = 0;
+
+    // Levels read ahead by ReadRecords come first. They are dropped from the
+    // levels buffer so that it stays in step with the records read.
+    if (levels_position_ < levels_written_) {
+      records_skipped = std::min(num_records, levels_written_ - levels_position_);
+      int16_t* def_levels = this->def_levels() + levels_position_;
+      SkipValues(std::count(def_levels, def_levels + records_skipped,
+                            this->max_def_level_));
+      std::copy(def_levels + records_skipped,
+                this->def_levels() + levels_written_, def_levels);
+      levels_written_ -= records_skipped;
+      this->ConsumeBufferedValues(records_skipped);
+    }
+
+    while (records_skipped < num_records && this->HasNextInternal()) {
+      const int64_t available = available_values_current_page();
+      const int64_t batch_size = std::min(num_records - records_skipped, available);
+      if (batch_size < available) {
+        // Some of this page is read: decode the levels and values to skip
+        int64_t values_to_skip = batch_size;
+        if (this->max_def_level_ > 0) {
+          values_to_skip = 0;
+          std::vector<int16_t> def_levels(
+              static_cast<size_t>(std::min(batch_size, kMinLevelBatchSize)));
+          for (int64_t i = 0; i < batch_size;) {
+            const int64_t levels_batch =
+                std::min(batch_size - i, static_cast<int64_t>(def_levels.size()));
+            if (this->ReadDefinitionLevels(levels_batch, def_levels.data()) !=
+                levels_batch) {
+              ParquetException::EofException();
+            }
+            values_to_skip += std::count(def_levels.begin(),
+                                         def_levels.begin() + levels_batch,
+                                         this->max_def_level_);
+            i += levels_batch;
+          }
+        }
+        SkipValues(values_to_skip);
+      }
+      // Otherwise, the rest of the page is skipped without decoding it
+      this->ConsumeBufferedValues(batch_size);
+      records_skipped += batch_size;
+    }
+    return records_skipped;
+  }
+
   // We may outwardly have the appearance of having exhausted a column chunk
   // when in fact we are in the middle of processing the last batch
   bool has_values_to_process() const { return levels_position_ < levels_written_; }
@@ -1385,6 +1429,22 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     DCHECK_EQ(num_decoded, values_to_read);
   }
 
+  // Decode and discard values of the current page
+  void SkipValues(int64_t num_values) {
+    constexpr int64_t kSkipBatchSize = 1024;
+    if (skip_scratch_ == nullptr) {
+      skip_scratch_ = AllocateBuffer(this->pool_, kSkipBatchSize * sizeof(T));
+    }
+    T* scratch = reinterpret_cast<T*>(skip_scratch_->mutable_data());
+    while (num_values > 0) {
+      const int batch_size = static_cast<int>(std::min(num_values, kSkipBatchSize));
+      if (this->current_decoder_->Decode(scratch, batch_size) != batch_size) {
+        ParquetException::EofException();
+      }
+      num_values -= batch_size;
+    }
+  }
+
   // Return number of logical records read
   int64_t ReadRecordData(int64_t num_records) {
     // Conservative upper bound
@@ -1486,6 +1546,8 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return reinterpret_cast<T*>(values_->mutable_data()) + values_written_;
   }
   LevelInfo leaf_info_;
+  // Where SkipRecords decodes the values it discards
+  std::shared_ptr<ResizableBuffer> skip_scratch_;
 };
 
 class FLBARecordReader : public TypedRecordReader<FLBAType>,
@@ -1583,17 +1645,24 @@ class ByteArrayChunkedRecordReader : public TypedRecordReader<ByteArrayType>,
   typename EncodingTraits<ByteArrayType>::Accumulator accumulator_;
 };
 
+// Dictionary encoded pages are passed through: their indices are decoded into
+// indices_builder_ and paired with the decoder's dictionary, without hashing any
+// value. Only pages which fell back to another encoding are dictionary encoded
+// by builder_.
 class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
                                         virtual public DictionaryRecordReader {
  public:
   ByteArrayDictionaryRecordReader(const ColumnDescriptor* descr, LevelInfo leaf_info,
                                   ::arrow::MemoryPool* pool)
-      : TypedRecordReader<ByteArrayType>(descr, leaf_info, pool), builder_(pool) {
+      : TypedRecordReader<ByteArrayType>(descr, leaf_info, pool),
+        builder_(pool),
+        indices_builder_(pool) {
     this->read_dictionary_ = true;
   }
 
   std::shared_ptr<::arrow::ChunkedArray> GetResult() override {
     FlushBuilder();
+    FlushIndices();
     std::vector<std::shared_ptr<::arrow::Array>> result;
     std::swap(result, result_chunks_);
     return std::make_shared<::arrow::ChunkedArray>(std::move(result), builder_.type());
@@ -1605,19 +1674,31 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
       PARQUET_THROW_NOT_OK(builder_.Finish(&chunk));
       result_chunks_.emplace_back(std::move(chunk));
 
-      // Also clears the dictionary memo table
-      builder_.Reset();
+      // Also clear the dictionary memo table, so that the next chunk's dictionary
+      // only holds its own values
+      builder_.ResetFull();
+    }
+  }
+
+  void FlushIndices() {
+    if (indices_builder_.length() > 0) {
+      std::shared_ptr<::arrow::Array> indices;
+      PARQUET_THROW_NOT_OK(indices_builder_.Finish(&indices));
+      result_chunks_.emplace_back(std::make_shared<::arrow::DictionaryArray>(
+          builder_.type(), std::move(indices), dictionary_));
     }
   }
 
   void MaybeWriteNewDictionary() {
+    // Pages of another encoding may have been read since the last dictionary
+    // encoded page
+    FlushBuilder();
     if (this->new_dictionary_) {
-      /// If there is a new dictionary, we may need to flush the builder, then
-      /// insert the new dictionary values
-      FlushBuilder();
-      builder_.ResetFull();
+      /// If there is a new dictionary, we may need to flush the indices of the
+      /// previous one
+      FlushIndices();
       auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
-      decoder->InsertDictionary(&builder_);
+      dictionary_ = decoder->GetDictionary();
       this->new_dictionary_ = false;
     }
   }
@@ -1627,8 +1708,10 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
     if (current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
       auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
-      num_decoded = decoder->DecodeIndices(static_cast<int>(values_to_read), &builder_);
+      num_decoded =
+          decoder->DecodeIndices(static_cast<int>(values_to_read), &indices_builder_);
     } else {
+      FlushIndices();
       num_decoded = this->current_decoder_->DecodeArrowNonNull(
           static_cast<int>(values_to_read), &builder_);
 
@@ -1645,8 +1728,9 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
       auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndicesSpaced(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          valid_bits_->mutable_data(), values_written_, &indices_builder_);
     } else {
+      FlushIndices();
       num_decoded = this->current_decoder_->DecodeArrow(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
           valid_bits_->mutable_data(), values_written_, &builder_);
@@ -1661,6 +1745,9 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
   using BinaryDictDecoder = DictDecoder<ByteArrayType>;
 
   ::arrow::BinaryDictionary32Builder builder_;
+  ::arrow::Int32Builder indices_builder_;
+  // The dictionary of the current column chunk
+  std::shared_ptr<::arrow::Array> dictionary_;
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
 };
 
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <string>
@@ -32,6 +33,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
@@ -39,6 +41,7 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
 #include "arrow/visitor_inline.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption_internal.h"
@@ -405,6 +408,8 @@ class SerializedPageWriter : public PageWriter {
     ++data_encoding_stats_[page.encoding()];
     ++page_ordinal_;
     PARQUET_ASSIGN_OR_THROW(int64_t current_pos, sink_->Tell());
+    metadata_->RecordDataPage(start_pos, static_cast<int32_t>(current_pos - start_pos),
+                              page.num_values(), page.statistics());
     return current_pos - start_pos;
   }
 
@@ -937,13 +942,14 @@ void ColumnWriterImpl::BuildDataPageV2(int64_t definition_levels_rle_size,
                             combined->CopySlice(0, combined->size(), allocator_));
     std::unique_ptr<DataPage> page_ptr(new DataPageV2(
         combined, num_values, null_count, num_values, encoding_, def_levels_byte_length,
-        rep_levels_byte_length, uncompressed_size, pager_->has_compressor()));
+        rep_levels_byte_length, uncompressed_size, pager_->has_compressor(),
+        page_stats));
     total_compressed_bytes_ += page_ptr->size() + sizeof(format::PageHeader);
     data_pages_.push_back(std::move(page_ptr));
   } else {
     DataPageV2 page(combined, num_values, null_count, num_values, encoding_,
                     def_levels_byte_length, rep_levels_byte_length, uncompressed_size,
-                    pager_->has_compressor());
+                    pager_->has_compressor(), page_stats);
     WriteDataPage(page);
   }
 }
@@ -1023,6 +1029,58 @@ static inline bool IsDictionaryEncoding(Encoding::type encoding) {
   return encoding == Encoding::PLAIN_DICTIONARY;
 }
 
+// Hash a value for a Bloom filter, by its plain encoding
+template <typename T>
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const T& value,
+                                const ColumnDescriptor*) {
+  return filter.Hash(value);
+}
+
+inline uint64_t BloomFilterHash(const BloomFilter&, const bool&,
+                                const ColumnDescriptor*) {
+  // Bloom filters are not written for BOOLEAN columns
+  DCHECK(false);
+  return 0;
+}
+
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const Int96& value,
+                                const ColumnDescriptor*) {
+  return filter.Hash(&value);
+}
+
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const ByteArray& value,
+                                const ColumnDescriptor*) {
+  return filter.Hash(&value);
+}
+
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const FLBA& value,
+                                const ColumnDescriptor* descr) {
+  return filter.Hash(&value, static_cast<uint32_t>(descr->type_length()));
+}
+
+static std::unique_ptr<BloomFilter> MakeBloomFilter(const ColumnDescriptor* descr,
+                                                    const WriterProperties* properties) {
+  const auto& path = descr->path();
+  if (!properties->bloom_filter_enabled(path) ||
+      descr->physical_type() == Type::BOOLEAN) {
+    return nullptr;
+  }
+  // The Bloom filter of an encrypted column would leak its values
+  auto encryption = properties->column_encryption_properties(path->ToDotString());
+  if (encryption != nullptr && encryption->is_encrypted()) {
+    return nullptr;
+  }
+
+  int64_t ndv = std::min<int64_t>(properties->bloom_filter_ndv(path),
+                                  std::numeric_limits<uint32_t>::max());
+  uint32_t num_bits = BlockSplitBloomFilter::OptimalNumOfBits(
+      static_cast<uint32_t>(ndv), properties->bloom_filter_fpp(path));
+  std::unique_ptr<BlockSplitBloomFilter> bloom_filter(
+      new BlockSplitBloomFilter(BloomFilter::HashStrategy::XXHASH));
+  bloom_filter->Init(num_bits / 8);
+  return std::move(bloom_filter);
+}
+
 template <typename DType>
 class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<DType> {
  public:
@@ -1041,9 +1099,15 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_ = MakeStatistics<DType>(descr_, allocator_);
       chunk_statistics_ = MakeStatistics<DType>(descr_, allocator_);
     }
+    bloom_filter_ = MakeBloomFilter(descr_, properties);
   }
 
-  int64_t Close() override { return ColumnWriterImpl::Close(); }
+  int64_t Close() override {
+    if (bloom_filter_ != nullptr) {
+      metadata_->SetBloomFilter(std::move(bloom_filter_));
+    }
+    return ColumnWriterImpl::Close();
+  }
 
   int64_t WriteBatch(int64_t num_values, const int16_t* def_levels,
                      const int16_t* rep_levels, const T* values) override {
@@ -1199,6 +1263,15 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
 
   int64_t total_bytes_written() const override { return total_bytes_written_; }
 
+  int64_t estimated_buffered_value_bytes() const override {
+    int64_t bytes = current_encoder_->EstimatedDataEncodedSize();
+    if (has_dictionary_ && !fallback_) {
+      bytes += dynamic_cast<DictEncoder<DType>*>(current_encoder_.get())
+                   ->dict_encoded_size();
+    }
+    return bytes;
+  }
+
   const WriterProperties* properties() override { return properties_; }
 
  private:
@@ -1207,6 +1280,7 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   std::unique_ptr<Encoder> current_encoder_;
   std::shared_ptr<TypedStats> page_statistics_;
   std::shared_ptr<TypedStats> chunk_statistics_;
+  std::unique_ptr<BloomFilter> bloom_filter_;
 
   // If writing a sequence of ::arrow::DictionaryArray to the writer, we keep the
   // dictionary passed to DictEncoder<T>::PutDictionary so we can check
@@ -1353,10 +1427,12 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       // Serialize the buffered Dictionary Indices
       FlushBufferedDataPages();
       fallback_ = true;
-      // Only PLAIN encoding is supported for fallback in V1
-      current_encoder_ = MakeEncoder(DType::type_num, Encoding::PLAIN, false, descr_,
+      // Fall back to the encoding configured for the column if it applies to
+      // its type, PLAIN otherwise
+      encoding_ = properties_->dictionary_fallback_encoding(descr_->path(),
+                                                            descr_->physical_type());
+      current_encoder_ = MakeEncoder(DType::type_num, encoding_, false, descr_,
                                      properties_->memory_pool());
-      encoding_ = Encoding::PLAIN;
     }
   }
 
@@ -1387,6 +1463,9 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      UpdateBloomFilter(values, num_values);
+    }
   }
 
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
@@ -1404,6 +1483,42 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset, num_values,
                                      num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      ::arrow::internal::VisitSetBitRunsVoid(
+          valid_bits, valid_bits_offset, num_spaced_values,
+          [&](int64_t position, int64_t length) {
+            UpdateBloomFilter(values + position, length);
+          });
+    }
+  }
+
+  void UpdateBloomFilter(const T* values, int64_t num_values) {
+    for (int64_t i = 0; i < num_values; ++i) {
+      bloom_filter_->InsertHash(BloomFilterHash(*bloom_filter_, values[i], descr_));
+    }
+  }
+
+  // Insert the non-null values of a binary array, as written to a BYTE_ARRAY
+  // column, into the Bloom filter
+  void UpdateBloomFilter(const ::arrow::Array& values) {
+    if (::arrow::is_binary_like(values.type_id())) {
+      UpdateBloomFilterBinary(checked_cast<const ::arrow::BinaryArray&>(values));
+    } else {
+      DCHECK(::arrow::is_large_binary_like(values.type_id()));
+      UpdateBloomFilterBinary(checked_cast<const ::arrow::LargeBinaryArray&>(values));
+    }
+  }
+
+  template <typename ArrayType>
+  void UpdateBloomFilterBinary(const ArrayType& values) {
+    PARQUET_THROW_NOT_OK(::arrow::VisitArrayDataInline<typename ArrayType::TypeClass>(
+        *values.data(),
+        [&](::arrow::util::string_view view) {
+          ByteArray value(view);
+          bloom_filter_->InsertHash(bloom_filter_->Hash(&value));
+          return Status::OK();
+        },
+        []() { return Status::OK(); }));
   }
 };
 
@@ -1490,6 +1605,9 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(
     if (page_statistics_ != nullptr) {
       PARQUET_CATCH_NOT_OK(page_statistics_->Update(*dictionary));
     }
+    if (bloom_filter_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(UpdateBloomFilter(*dictionary));
+    }
     preserved_dictionary_ = dictionary;
   } else if (!dictionary->Equals(*preserved_dictionary_)) {
     // Dictionary has changed
@@ -1899,6 +2017,9 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(*data_slice);
     }
+    if (bloom_filter_ != nullptr) {
+      UpdateBloomFilter(*data_slice);
+    }
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     CheckDictionarySizeLimit();
     value_offset += batch_num_spaced_values;
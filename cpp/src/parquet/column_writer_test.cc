@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -90,7 +91,8 @@ class TestPrimitiveWriter : public PrimitiveTypedTest<TestType> {
   std::shared_ptr<TypedColumnWriter<TestType>> BuildWriter(
       int64_t output_size = SMALL_SIZE,
       const ColumnProperties& column_properties = ColumnProperties(),
-      const ParquetVersion::type version = ParquetVersion::PARQUET_1_0) {
+      const ParquetVersion::type version = ParquetVersion::PARQUET_1_0,
+      const Encoding::type fallback_encoding = Encoding::PLAIN) {
     sink_ = CreateOutputStream();
     WriterProperties::Builder wp_builder;
     wp_builder.version(version);
@@ -98,6 +100,7 @@ class TestPrimitiveWriter : public PrimitiveTypedTest<TestType> {
         column_properties.encoding() == Encoding::RLE_DICTIONARY) {
       wp_builder.enable_dictionary();
       wp_builder.dictionary_pagesize_limit(DICTIONARY_PAGE_SIZE);
+      wp_builder.encoding(fallback_encoding);
     } else {
       wp_builder.disable_dictionary();
       wp_builder.encoding(column_properties.encoding());
@@ -416,22 +419,26 @@ TYPED_TEST(TestPrimitiveWriter, RequiredBitPacked) {
   this->TestRequiredWithEncoding(Encoding::BIT_PACKED);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaBinaryPacked) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
+TYPED_TEST(TestPrimitiveWriter, RequiredRLEDictionary) {
+  this->TestRequiredWithEncoding(Encoding::RLE_DICTIONARY);
 }
+*/
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaLengthByteArray) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY);
-}
+template <typename TestType>
+class TestDeltaBinaryPackedWriter : public TestPrimitiveWriter<TestType> {};
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBinaryPackedTypes;
+
+TYPED_TEST_SUITE(TestDeltaBinaryPackedWriter, DeltaBinaryPackedTypes);
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaByteArray) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_BYTE_ARRAY);
+TYPED_TEST(TestDeltaBinaryPackedWriter, RequiredDeltaBinaryPacked) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredRLEDictionary) {
-  this->TestRequiredWithEncoding(Encoding::RLE_DICTIONARY);
+TYPED_TEST(TestDeltaBinaryPackedWriter, RequiredDeltaBinaryPackedLarge) {
+  this->TestRequiredWithSettings(Encoding::DELTA_BINARY_PACKED,
+                                 Compression::UNCOMPRESSED, false, true, LARGE_SIZE);
 }
-*/
 
 TYPED_TEST(TestPrimitiveWriter, RequiredPlainWithStats) {
   this->TestRequiredWithSettings(Encoding::PLAIN, Compression::UNCOMPRESSED, false, true,
@@ -613,6 +620,54 @@ TYPED_TEST(TestPrimitiveWriter, DictionaryFallbackVersion2_0) {
   this->TestDictionaryFallbackEncoding(ParquetVersion::PARQUET_2_0);
 }
 
+// A fallback encoding that does not support the column's type is replaced
+// with PLAIN
+TYPED_TEST(TestPrimitiveWriter, DictionaryFallbackToConfiguredEncoding) {
+  if (this->type_num() == Type::BOOLEAN) {
+    // BOOLEAN columns are never dictionary-encoded
+    return;
+  }
+  for (auto fallback_encoding :
+       {Encoding::DELTA_BINARY_PACKED, Encoding::BYTE_STREAM_SPLIT}) {
+    Encoding::type expected_encoding = Encoding::PLAIN;
+    if (fallback_encoding == Encoding::DELTA_BINARY_PACKED &&
+        (this->type_num() == Type::INT32 || this->type_num() == Type::INT64)) {
+      expected_encoding = fallback_encoding;
+    }
+    if (fallback_encoding == Encoding::BYTE_STREAM_SPLIT &&
+        (this->type_num() == Type::FLOAT || this->type_num() == Type::DOUBLE)) {
+      expected_encoding = fallback_encoding;
+    }
+
+    this->GenerateData(VERY_LARGE_SIZE);
+    ColumnProperties column_properties;
+    column_properties.set_dictionary_enabled(true);
+    column_properties.set_encoding(Encoding::RLE_DICTIONARY);
+    auto writer = this->BuildWriter(VERY_LARGE_SIZE, column_properties,
+                                    ParquetVersion::PARQUET_2_0, fallback_encoding);
+    writer->WriteBatch(this->values_.size(), nullptr, nullptr, this->values_ptr_);
+    writer->Close();
+
+    this->SetupValuesOut(VERY_LARGE_SIZE);
+    this->ReadColumnFully();
+    ASSERT_EQ(VERY_LARGE_SIZE, this->values_read_);
+    this->values_.resize(VERY_LARGE_SIZE);
+    ASSERT_EQ(this->values_, this->values_out_);
+
+    std::vector<Encoding::type> expected(
+        {Encoding::RLE_DICTIONARY, Encoding::PLAIN, Encoding::RLE, expected_encoding});
+    ASSERT_EQ(expected, this->metadata_encodings());
+    std::set<Encoding::type> data_page_encodings;
+    for (const auto& stats : this->metadata_encoding_stats()) {
+      if (stats.page_type == PageType::DATA_PAGE) {
+        data_page_encodings.insert(stats.encoding);
+      }
+    }
+    ASSERT_EQ(std::set<Encoding::type>({Encoding::RLE_DICTIONARY, expected_encoding}),
+              data_page_encodings);
+  }
+}
+
 TEST(TestWriter, NullValuesBuffer) {
   std::shared_ptr<::arrow::io::BufferOutputStream> sink = CreateOutputStream();
 
@@ -680,9 +735,20 @@ TEST_F(TestBooleanValuesWriter, AlternateBooleanValues) {
   }
 }
 
+using TestByteArrayValuesWriter = TestPrimitiveWriter<ByteArrayType>;
+
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaLengthByteArray) {
+  this->TestRequiredWithSettings(Encoding::DELTA_LENGTH_BYTE_ARRAY,
+                                 Compression::UNCOMPRESSED, false, true, LARGE_SIZE);
+}
+
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaByteArray) {
+  this->TestRequiredWithSettings(Encoding::DELTA_BYTE_ARRAY, Compression::UNCOMPRESSED,
+                                 false, true, LARGE_SIZE);
+}
+
 // PARQUET-979
 // Prevent writing large MIN, MAX stats
-using TestByteArrayValuesWriter = TestPrimitiveWriter<ByteArrayType>;
 TEST_F(TestByteArrayValuesWriter, OmitStats) {
   int min_len = 1024 * 4;
   int max_len = 1024 * 8;
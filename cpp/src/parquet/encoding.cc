@@ -37,6 +37,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/prefix_sum.h"
 #include "arrow/util/rle_encoding.h"
 #include "arrow/util/ubsan.h"
 #include "arrow/visitor_inline.h"
@@ -924,6 +925,437 @@ void ByteStreamSplitEncoder<DType>::PutSpaced(const T* src, int num_values,
   }
 }
 
+// ----------------------------------------------------------------------
+// DeltaBitPackEncoder
+
+// The block layout used by the Java implementation, and assumed by many readers
+constexpr uint32_t kDeltaValuesPerBlock = 128;
+constexpr uint32_t kDeltaMiniBlocksPerBlock = 4;
+// Block size, number of mini blocks and total value count as ULEB128, and the
+// first value as zigzag ULEB128
+constexpr int kDeltaMaxHeaderSize =
+    3 * ::arrow::BitUtil::BitReader::kMaxVlqByteLength +
+    ::arrow::BitUtil::BitReader::kMaxVlqByteLengthForInt64;
+
+/// DELTA_BINARY_PACKED encoder for INT32 and INT64 data.
+///
+/// The values are buffered one block at a time. Once a block is complete,
+/// the deltas between consecutive values are reduced by their minimum and
+/// bit packed, each mini block with the bit width required by its largest
+/// reduced delta. The page header, which holds the total number of values,
+/// is only written when the page is flushed.
+template <typename DType>
+class DeltaBitPackEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
+  using TypedEncoder<DType>::Put;
+
+  explicit DeltaBitPackEncoder(const ColumnDescriptor* descr,
+                               MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BINARY_PACKED, pool),
+        values_per_mini_block_(kDeltaValuesPerBlock / kDeltaMiniBlocksPerBlock),
+        deltas_(kDeltaValuesPerBlock, 0, ::arrow::stl::allocator<T>(pool)),
+        bits_buffer_(AllocateBuffer(pool, kDeltaMiniBlocksPerBlock +
+                                              kDeltaValuesPerBlock * sizeof(T) +
+                                              kDeltaMaxHeaderSize)),
+        sink_(pool),
+        bit_writer_(bits_buffer_->mutable_data(),
+                    static_cast<int>(bits_buffer_->size())) {
+    if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
+      throw ParquetException("Delta bit pack encoding should only be for integer data.");
+    }
+  }
+
+  int64_t EstimatedDataEncodedSize() override {
+    return kDeltaMaxHeaderSize + sink_.length() + values_current_block_ * sizeof(T);
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  void Put(const T* src, int num_values) override;
+  void Put(const ::arrow::Array& values) override;
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override;
+
+ private:
+  void FlushBlock();
+
+  const uint32_t values_per_mini_block_;
+  uint32_t total_value_count_ = 0;
+  uint32_t values_current_block_ = 0;
+  T first_value_ = 0;
+  T current_value_ = 0;
+  ArrowPoolVector<T> deltas_;
+  std::shared_ptr<ResizableBuffer> bits_buffer_;
+  ::arrow::BufferBuilder sink_;
+  ::arrow::BitUtil::BitWriter bit_writer_;
+};
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const T* src, int num_values) {
+  if (num_values == 0) return;
+
+  int idx = 0;
+  if (total_value_count_ == 0) {
+    current_value_ = src[0];
+    first_value_ = current_value_;
+    idx = 1;
+  }
+  total_value_count_ += num_values;
+
+  while (idx < num_values) {
+    // Deltas are computed with wrapping arithmetic, as the Java implementation does
+    const T value = src[idx];
+    deltas_[values_current_block_] =
+        static_cast<T>(static_cast<UT>(value) - static_cast<UT>(current_value_));
+    current_value_ = value;
+    ++idx;
+    if (++values_current_block_ == kDeltaValuesPerBlock) {
+      FlushBlock();
+    }
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::FlushBlock() {
+  if (values_current_block_ == 0) return;
+
+  const T min_delta =
+      *std::min_element(deltas_.begin(), deltas_.begin() + values_current_block_);
+  bit_writer_.PutZigZagVlqInt(static_cast<int64_t>(min_delta));
+
+  // The bit widths are only known once the mini blocks have been scanned
+  uint8_t* bit_widths = bit_writer_.GetNextBytePtr(kDeltaMiniBlocksPerBlock);
+  DCHECK(bit_widths != nullptr);
+
+  const uint32_t num_mini_blocks = static_cast<uint32_t>(
+      ::arrow::BitUtil::CeilDiv(values_current_block_, values_per_mini_block_));
+  for (uint32_t i = 0; i < num_mini_blocks; ++i) {
+    const uint32_t start = i * values_per_mini_block_;
+    const uint32_t end = start + values_per_mini_block_;
+    // The last mini block is padded to its full length with zero deltas
+    std::fill(deltas_.begin() + std::min(end, values_current_block_),
+              deltas_.begin() + end, min_delta);
+
+    UT max_delta = 0;
+    for (uint32_t j = start; j < end; ++j) {
+      max_delta = std::max<UT>(
+          max_delta, static_cast<UT>(deltas_[j]) - static_cast<UT>(min_delta));
+    }
+    const int bit_width = ::arrow::BitUtil::NumRequiredBits(max_delta);
+    bit_widths[i] = static_cast<uint8_t>(bit_width);
+    if (bit_width == 0) continue;
+
+    for (uint32_t j = start; j < end; ++j) {
+      const uint64_t value = static_cast<UT>(deltas_[j]) - static_cast<UT>(min_delta);
+      // BitWriter can only write up to 32 bits at a time
+      if (bit_width > 32) {
+        bit_writer_.PutValue(value & 0xFFFFFFFFULL, 32);
+        bit_writer_.PutValue(value >> 32, bit_width - 32);
+      } else {
+        bit_writer_.PutValue(value, bit_width);
+      }
+    }
+  }
+  // The bit widths of the unused mini blocks are written, but not their values
+  std::fill(bit_widths + num_mini_blocks, bit_widths + kDeltaMiniBlocksPerBlock, 0);
+
+  bit_writer_.Flush();
+  PARQUET_THROW_NOT_OK(sink_.Append(bit_writer_.buffer(), bit_writer_.bytes_written()));
+  bit_writer_.Clear();
+  values_current_block_ = 0;
+}
+
+template <typename DType>
+std::shared_ptr<Buffer> DeltaBitPackEncoder<DType>::FlushValues() {
+  FlushBlock();
+
+  std::shared_ptr<ResizableBuffer> buffer =
+      AllocateBuffer(this->memory_pool(), kDeltaMaxHeaderSize + sink_.length());
+  ::arrow::BitUtil::BitWriter header_writer(buffer->mutable_data(), kDeltaMaxHeaderSize);
+  header_writer.PutVlqInt(kDeltaValuesPerBlock);
+  header_writer.PutVlqInt(kDeltaMiniBlocksPerBlock);
+  header_writer.PutVlqInt(total_value_count_);
+  header_writer.PutZigZagVlqInt(static_cast<int64_t>(first_value_));
+  header_writer.Flush();
+
+  const int64_t header_size = header_writer.bytes_written();
+  if (sink_.length() > 0) {
+    memcpy(buffer->mutable_data() + header_size, sink_.data(), sink_.length());
+  }
+  PARQUET_THROW_NOT_OK(buffer->Resize(header_size + sink_.length()));
+
+  sink_.Reset();
+  total_value_count_ = 0;
+  first_value_ = 0;
+  current_value_ = 0;
+  return std::move(buffer);
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const ::arrow::Array& values) {
+  const ::arrow::Type::type expected_type =
+      DType::type_num == Type::INT32 ? ::arrow::Type::INT32 : ::arrow::Type::INT64;
+  if (values.type_id() != expected_type) {
+    throw ParquetException("direct put to " + TypeToString(DType::type_num) + " from " +
+                           values.type()->ToString() + " not supported");
+  }
+  const ::arrow::ArrayData& data = *values.data();
+  if (values.null_count() == 0) {
+    Put(data.GetValues<T>(1), static_cast<int>(data.length));
+  } else {
+    PutSpaced(data.GetValues<T>(1), static_cast<int>(data.length),
+              data.GetValues<uint8_t>(0, 0), data.offset);
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::PutSpaced(const T* src, int num_values,
+                                           const uint8_t* valid_bits,
+                                           int64_t valid_bits_offset) {
+  if (valid_bits != NULLPTR) {
+    PARQUET_ASSIGN_OR_THROW(auto buffer, ::arrow::AllocateBuffer(num_values * sizeof(T),
+                                                                 this->memory_pool()));
+    T* data = reinterpret_cast<T*>(buffer->mutable_data());
+    int num_valid_values = ::arrow::util::internal::SpacedCompress<T>(
+        src, num_values, valid_bits, valid_bits_offset, data);
+    Put(data, num_valid_values);
+  } else {
+    Put(src, num_values);
+  }
+}
+
+// ----------------------------------------------------------------------
+// DeltaLengthByteArrayEncoder
+
+/// DELTA_LENGTH_BYTE_ARRAY encoder: the DELTA_BINARY_PACKED lengths of all
+/// the values followed by their concatenated bytes.
+class DeltaLengthByteArrayEncoder : public EncoderImpl,
+                                    virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaLengthByteArrayEncoder(const ColumnDescriptor* descr,
+                                       MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        sink_(pool),
+        length_encoder_(nullptr, pool),
+        lengths_(::arrow::stl::allocator<int32_t>(pool)) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return sink_.length() + length_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> encoded_lengths = length_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer =
+        AllocateBuffer(this->memory_pool(), encoded_lengths->size() + sink_.length());
+    memcpy(buffer->mutable_data(), encoded_lengths->data(), encoded_lengths->size());
+    if (sink_.length() > 0) {
+      memcpy(buffer->mutable_data() + encoded_lengths->size(), sink_.data(),
+             sink_.length());
+    }
+    sink_.Reset();
+    return std::move(buffer);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    if (num_values == 0) return;
+    lengths_.resize(num_values);
+    int64_t total_bytes = 0;
+    for (int i = 0; i < num_values; ++i) {
+      lengths_[i] = static_cast<int32_t>(src[i].len);
+      total_bytes += src[i].len;
+    }
+    PARQUET_THROW_NOT_OK(sink_.Reserve(total_bytes));
+    for (int i = 0; i < num_values; ++i) {
+      DCHECK(src[i].len == 0 || src[i].ptr != nullptr) << "Value ptr cannot be NULL";
+      sink_.UnsafeAppend(src[i].ptr, static_cast<int64_t>(src[i].len));
+    }
+    length_encoder_.Put(lengths_.data(), num_values);
+  }
+
+  void Put(const ::arrow::Array& values) override {
+    AssertBaseBinary(values);
+    if (::arrow::is_binary_like(values.type_id())) {
+      PutBinaryArray(checked_cast<const ::arrow::BinaryArray&>(values));
+    } else {
+      DCHECK(::arrow::is_large_binary_like(values.type_id()));
+      PutBinaryArray(checked_cast<const ::arrow::LargeBinaryArray&>(values));
+    }
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    if (valid_bits != NULLPTR) {
+      PARQUET_ASSIGN_OR_THROW(
+          auto buffer, ::arrow::AllocateBuffer(num_values * sizeof(ByteArray),
+                                               this->memory_pool()));
+      auto data = reinterpret_cast<ByteArray*>(buffer->mutable_data());
+      int num_valid_values = ::arrow::util::internal::SpacedCompress<ByteArray>(
+          src, num_values, valid_bits, valid_bits_offset, data);
+      Put(data, num_valid_values);
+    } else {
+      Put(src, num_values);
+    }
+  }
+
+ private:
+  template <typename ArrayType>
+  void PutBinaryArray(const ArrayType& array) {
+    const int64_t total_bytes =
+        array.value_offset(array.length()) - array.value_offset(0);
+    PARQUET_THROW_NOT_OK(sink_.Reserve(total_bytes));
+    lengths_.clear();
+
+    PARQUET_THROW_NOT_OK(::arrow::VisitArrayDataInline<typename ArrayType::TypeClass>(
+        *array.data(),
+        [&](::arrow::util::string_view view) {
+          if (ARROW_PREDICT_FALSE(view.size() > kMaxByteArraySize)) {
+            return Status::Invalid("Parquet cannot store strings with size 2GB or more");
+          }
+          lengths_.push_back(static_cast<int32_t>(view.size()));
+          sink_.UnsafeAppend(view.data(), static_cast<int64_t>(view.size()));
+          return Status::OK();
+        },
+        []() { return Status::OK(); }));
+    length_encoder_.Put(lengths_.data(), static_cast<int>(lengths_.size()));
+  }
+
+  ::arrow::BufferBuilder sink_;
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+  ArrowPoolVector<int32_t> lengths_;
+};
+
+// ----------------------------------------------------------------------
+// DeltaByteArrayEncoder
+
+/// DELTA_BYTE_ARRAY encoder, also known as incremental encoding: the
+/// DELTA_BINARY_PACKED lengths of the prefixes each value shares with the
+/// previous one, followed by the DELTA_LENGTH_BYTE_ARRAY encoded suffixes.
+class DeltaByteArrayEncoder : public EncoderImpl,
+                              virtual public TypedEncoder<ByteArrayType> {
+ public:
+  using TypedEncoder<ByteArrayType>::Put;
+
+  explicit DeltaByteArrayEncoder(const ColumnDescriptor* descr,
+                                 MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool),
+        prefix_lengths_(::arrow::stl::allocator<int32_t>(pool)),
+        suffixes_(::arrow::stl::allocator<ByteArray>(pool)) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> prefix_lengths = prefix_length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> suffixes = suffix_encoder_.FlushValues();
+    std::shared_ptr<ResizableBuffer> buffer =
+        AllocateBuffer(this->memory_pool(), prefix_lengths->size() + suffixes->size());
+    memcpy(buffer->mutable_data(), prefix_lengths->data(), prefix_lengths->size());
+    memcpy(buffer->mutable_data() + prefix_lengths->size(), suffixes->data(),
+           suffixes->size());
+    // Each page is decoded independently, so its first value has no prefix
+    last_value_.clear();
+    return std::move(buffer);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    if (num_values == 0) return;
+    prefix_lengths_.clear();
+    suffixes_.clear();
+    ::arrow::util::string_view previous = last_value_;
+    for (int i = 0; i < num_values; ++i) {
+      const ::arrow::util::string_view value(reinterpret_cast<const char*>(src[i].ptr),
+                                             src[i].len);
+      AppendValue(previous, value);
+      previous = value;
+    }
+    FlushBatch(previous);
+  }
+
+  void Put(const ::arrow::Array& values) override {
+    AssertBaseBinary(values);
+    if (::arrow::is_binary_like(values.type_id())) {
+      PutBinaryArray(checked_cast<const ::arrow::BinaryArray&>(values));
+    } else {
+      DCHECK(::arrow::is_large_binary_like(values.type_id()));
+      PutBinaryArray(checked_cast<const ::arrow::LargeBinaryArray&>(values));
+    }
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    if (valid_bits != NULLPTR) {
+      PARQUET_ASSIGN_OR_THROW(
+          auto buffer, ::arrow::AllocateBuffer(num_values * sizeof(ByteArray),
+                                               this->memory_pool()));
+      auto data = reinterpret_cast<ByteArray*>(buffer->mutable_data());
+      int num_valid_values = ::arrow::util::internal::SpacedCompress<ByteArray>(
+          src, num_values, valid_bits, valid_bits_offset, data);
+      Put(data, num_valid_values);
+    } else {
+      Put(src, num_values);
+    }
+  }
+
+ private:
+  void AppendValue(::arrow::util::string_view previous,
+                   ::arrow::util::string_view value) {
+    const size_t max_prefix_length = std::min(previous.size(), value.size());
+    const size_t prefix_length =
+        std::mismatch(value.begin(), value.begin() + max_prefix_length,
+                      previous.begin())
+            .first -
+        value.begin();
+    prefix_lengths_.push_back(static_cast<int32_t>(prefix_length));
+    suffixes_.push_back(
+        ByteArray(static_cast<uint32_t>(value.size() - prefix_length),
+                  reinterpret_cast<const uint8_t*>(value.data()) + prefix_length));
+  }
+
+  void FlushBatch(::arrow::util::string_view last_value) {
+    const int num_values = static_cast<int>(prefix_lengths_.size());
+    prefix_length_encoder_.Put(prefix_lengths_.data(), num_values);
+    suffix_encoder_.Put(suffixes_.data(), num_values);
+    // The next batch may no longer reference the caller's memory
+    last_value_.assign(last_value.data(), last_value.size());
+  }
+
+  template <typename ArrayType>
+  void PutBinaryArray(const ArrayType& array) {
+    prefix_lengths_.clear();
+    suffixes_.clear();
+    ::arrow::util::string_view previous = last_value_;
+
+    PARQUET_THROW_NOT_OK(::arrow::VisitArrayDataInline<typename ArrayType::TypeClass>(
+        *array.data(),
+        [&](::arrow::util::string_view view) {
+          if (ARROW_PREDICT_FALSE(view.size() > kMaxByteArraySize)) {
+            return Status::Invalid("Parquet cannot store strings with size 2GB or more");
+          }
+          AppendValue(previous, view);
+          previous = view;
+          return Status::OK();
+        },
+        []() { return Status::OK(); }));
+    if (!prefix_lengths_.empty()) {
+      FlushBatch(previous);
+    }
+  }
+
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  ArrowPoolVector<int32_t> prefix_lengths_;
+  ArrowPoolVector<ByteArray> suffixes_;
+  std::string last_value_;
+};
+
 class DecoderImpl : virtual public Decoder {
  public:
   void SetData(int num_values, const uint8_t* data, int len) override {
@@ -1454,6 +1886,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
   explicit DictDecoderImpl(const ColumnDescriptor* descr,
                            MemoryPool* pool = ::arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::RLE_DICTIONARY),
+        pool_(pool),
         dictionary_(AllocateBuffer(pool, 0)),
         dictionary_length_(0),
         byte_array_data_(AllocateBuffer(pool, 0)),
@@ -1512,6 +1945,8 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
 
   void InsertDictionary(::arrow::ArrayBuilder* builder) override;
 
+  std::shared_ptr<::arrow::Array> GetDictionary() override;
+
   int DecodeIndicesSpaced(int num_values, int null_count, const uint8_t* valid_bits,
                           int64_t valid_bits_offset,
                           ::arrow::ArrayBuilder* builder) override {
@@ -1538,9 +1973,8 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
       bit_reader.Next();
     }
 
-    auto binary_builder = checked_cast<::arrow::BinaryDictionary32Builder*>(builder);
     PARQUET_THROW_NOT_OK(
-        binary_builder->AppendIndices(indices_buffer, num_values, valid_bytes.data()));
+        AppendIndices(builder, indices_buffer, num_values, valid_bytes.data()));
     num_values_ -= num_values - null_count;
     return num_values - null_count;
   }
@@ -1559,13 +1993,23 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     if (num_values != idx_decoder_.GetBatch(indices_buffer, num_values)) {
       ParquetException::EofException();
     }
-    auto binary_builder = checked_cast<::arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(binary_builder->AppendIndices(indices_buffer, num_values));
+    PARQUET_THROW_NOT_OK(AppendIndices(builder, indices_buffer, num_values));
     num_values_ -= num_values;
     return num_values;
   }
 
  protected:
+  // Append indices to a BinaryDictionary32Builder or an Int32Builder
+  static Status AppendIndices(::arrow::ArrayBuilder* builder, const int32_t* indices,
+                              int64_t length, const uint8_t* valid_bytes = NULLPTR) {
+    if (builder->type()->id() == ::arrow::Type::INT32) {
+      return checked_cast<::arrow::Int32Builder*>(builder)->AppendValues(
+          indices, length, valid_bytes);
+    }
+    return checked_cast<::arrow::BinaryDictionary32Builder*>(builder)->AppendIndices(
+        indices, length, valid_bytes);
+  }
+
   Status IndexInBounds(int32_t index) {
     if (ARROW_PREDICT_TRUE(0 <= index && index < dictionary_length_)) {
       return Status::OK();
@@ -1581,6 +2025,8 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
                        dictionary_length_);
   }
 
+  MemoryPool* pool_;
+
   // Only one is set.
   std::shared_ptr<ResizableBuffer> dictionary_;
 
@@ -1624,11 +2070,10 @@ void DictDecoderImpl<ByteArrayType>::SetDict(TypedDecoder<ByteArrayType>* dictio
   for (int i = 0; i < dictionary_length_; ++i) {
     total_size += dict_values[i].len;
   }
-  PARQUET_THROW_NOT_OK(byte_array_data_->Resize(total_size,
-                                                /*shrink_to_fit=*/false));
-  PARQUET_THROW_NOT_OK(
-      byte_array_offsets_->Resize((dictionary_length_ + 1) * sizeof(int32_t),
-                                  /*shrink_to_fit=*/false));
+  // Allocate new buffers, as the previous ones may be shared by the array
+  // returned by GetDictionary()
+  byte_array_data_ = AllocateBuffer(pool_, total_size);
+  byte_array_offsets_ = AllocateBuffer(pool_, (dictionary_length_ + 1) * sizeof(int32_t));
 
   int32_t offset = 0;
   uint8_t* bytes_data = byte_array_data_->mutable_data();
@@ -1820,6 +2265,17 @@ void DictDecoderImpl<ByteArrayType>::InsertDictionary(::arrow::ArrayBuilder* bui
   PARQUET_THROW_NOT_OK(binary_builder->InsertMemoValues(*arr));
 }
 
+template <typename Type>
+std::shared_ptr<::arrow::Array> DictDecoderImpl<Type>::GetDictionary() {
+  ParquetException::NYI("GetDictionary only implemented for BYTE_ARRAY types");
+}
+
+template <>
+std::shared_ptr<::arrow::Array> DictDecoderImpl<ByteArrayType>::GetDictionary() {
+  return std::make_shared<::arrow::BinaryArray>(dictionary_length_, byte_array_offsets_,
+                                                byte_array_data_);
+}
+
 class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
                                  virtual public ByteArrayDecoder {
  public:
@@ -2045,10 +2501,9 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   }
 
   void SetData(int num_values, const uint8_t* data, int len) override {
-    this->num_values_ = num_values;
+    // The page header holds the actual number of values, excluding nulls
     decoder_ = ::arrow::BitUtil::BitReader(data, len);
-    values_current_block_ = 0;
-    values_current_mini_block_ = 0;
+    InitHeader();
   }
 
   int Decode(T* buffer, int max_values) override {
@@ -2058,100 +2513,247 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::Accumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
-    }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
-    PARQUET_THROW_NOT_OK(out->AppendValues(values));
-    return num_values;
+    const int values_decoded = DecodeDense(num_values - null_count);
+    PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+    const T* values = values_.data();
+    VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() { out->UnsafeAppend(*values++); }, [&]() { out->UnsafeAppendNull(); });
+    return values_decoded;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<DType>::DictAccumulator* out) override {
-    if (null_count != 0) {
-      ParquetException::NYI("Delta bit pack DecodeArrow with null slots");
-    }
-    std::vector<T> values(num_values);
-    GetInternal(values.data(), num_values);
+    const int values_decoded = DecodeDense(num_values - null_count);
     PARQUET_THROW_NOT_OK(out->Reserve(num_values));
-    for (T value : values) {
-      PARQUET_THROW_NOT_OK(out->Append(value));
-    }
-    return num_values;
+    const T* values = values_.data();
+    VisitNullBitmapInline(
+        valid_bits, valid_bits_offset, num_values, null_count,
+        [&]() { PARQUET_THROW_NOT_OK(out->Append(*values++)); },
+        [&]() { PARQUET_THROW_NOT_OK(out->AppendNull()); });
+    return values_decoded;
   }
 
+  /// \brief The number of bytes following the encoded values.
+  ///
+  /// Only meaningful once all the values of the page have been decoded.
+  int bytes_left() { return decoder_.bytes_left(); }
+
  private:
-  void InitBlock() {
-    // The number of values per block.
-    uint32_t block_size;
-    if (!decoder_.GetVlqInt(&block_size)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&num_mini_blocks_)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&values_current_block_)) {
+  int DecodeDense(int num_values) {
+    values_.resize(num_values);
+    const int values_decoded = GetInternal(values_.data(), num_values);
+    if (ARROW_PREDICT_FALSE(values_decoded != num_values)) {
       ParquetException::EofException();
     }
-    if (!decoder_.GetZigZagVlqInt(&last_value_)) ParquetException::EofException();
+    return values_decoded;
+  }
 
-    delta_bit_widths_ = AllocateBuffer(pool_, num_mini_blocks_);
-    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+  void InitHeader() {
+    uint32_t values_per_block;
+    uint32_t total_value_count;
+    int64_t first_value;
+    if (!decoder_.GetVlqInt(&values_per_block) ||
+        !decoder_.GetVlqInt(&mini_blocks_per_block_) ||
+        !decoder_.GetVlqInt(&total_value_count) ||
+        !decoder_.GetZigZagVlqInt(&first_value)) {
+      ParquetException::EofException();
+    }
+    if (values_per_block == 0 || values_per_block % 128 != 0) {
+      throw ParquetException("the number of values in a block must be multiple of 128");
+    }
+    if (mini_blocks_per_block_ == 0 || values_per_block % mini_blocks_per_block_ != 0) {
+      throw ParquetException("cannot split a block into an integer number of miniblocks");
+    }
+    values_per_mini_block_ = values_per_block / mini_blocks_per_block_;
+    if (values_per_mini_block_ % 32 != 0) {
+      throw ParquetException(
+          "the number of values in a miniblock must be multiple of 32");
+    }
+    if (total_value_count > static_cast<uint32_t>(std::numeric_limits<int>::max())) {
+      throw ParquetException("Invalid number of values in DELTA_BINARY_PACKED page");
+    }
+    if (delta_bit_widths_ == nullptr) {
+      delta_bit_widths_ = AllocateBuffer(pool_, mini_blocks_per_block_);
+    } else {
+      PARQUET_THROW_NOT_OK(delta_bit_widths_->Resize(mini_blocks_per_block_, false));
+    }
+
+    this->num_values_ = static_cast<int>(total_value_count);
+    last_value_ = static_cast<T>(first_value);
+    first_value_pending_ = total_value_count > 0;
+    block_initialized_ = false;
+    values_current_mini_block_ = 0;
+  }
+
+  void InitBlock() {
+    int64_t min_delta;
+    if (!decoder_.GetZigZagVlqInt(&min_delta)) ParquetException::EofException();
+    min_delta_ = static_cast<T>(min_delta);
 
-    if (!decoder_.GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
-    for (uint32_t i = 0; i < num_mini_blocks_; ++i) {
+    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+    for (uint32_t i = 0; i < mini_blocks_per_block_; ++i) {
       if (!decoder_.GetAligned<uint8_t>(1, bit_width_data + i)) {
         ParquetException::EofException();
       }
     }
-    values_per_mini_block_ = block_size / num_mini_blocks_;
+    block_initialized_ = true;
     mini_block_idx_ = 0;
-    delta_bit_width_ = bit_width_data[0];
+    InitMiniBlock(bit_width_data[0]);
+  }
+
+  void InitMiniBlock(int bit_width) {
+    if (ARROW_PREDICT_FALSE(bit_width > static_cast<int>(sizeof(T) * 8))) {
+      throw ParquetException("delta bit width larger than integer bit width");
+    }
+    delta_bit_width_ = bit_width;
     values_current_mini_block_ = values_per_mini_block_;
   }
 
-  template <typename T>
   int GetInternal(T* buffer, int max_values) {
     max_values = std::min(max_values, this->num_values_);
-    const uint8_t* bit_width_data = delta_bit_widths_->data();
-    for (int i = 0; i < max_values; ++i) {
+    if (max_values == 0) return 0;
+
+    int i = 0;
+    if (first_value_pending_) {
+      // The first value is stored in the page header
+      buffer[i++] = last_value_;
+      first_value_pending_ = false;
+    }
+    while (i < max_values) {
       if (ARROW_PREDICT_FALSE(values_current_mini_block_ == 0)) {
-        ++mini_block_idx_;
-        if (mini_block_idx_ < static_cast<size_t>(delta_bit_widths_->size())) {
-          delta_bit_width_ = bit_width_data[mini_block_idx_];
-          values_current_mini_block_ = values_per_mini_block_;
-        } else {
+        if (!block_initialized_ || ++mini_block_idx_ == mini_blocks_per_block_) {
           InitBlock();
-          buffer[i] = last_value_;
-          continue;
+        } else {
+          InitMiniBlock(delta_bit_widths_->data()[mini_block_idx_]);
         }
       }
 
-      // TODO: the key to this algorithm is to decode the entire miniblock at once.
-      int64_t delta;
-      if (!decoder_.GetValue(delta_bit_width_, &delta)) ParquetException::EofException();
-      delta += min_delta_;
-      last_value_ += static_cast<int32_t>(delta);
-      buffer[i] = last_value_;
-      --values_current_mini_block_;
+      const int values_in_mini_block =
+          std::min(max_values - i, static_cast<int>(values_current_mini_block_));
+      GetDeltas(buffer + i, values_in_mini_block);
+      // Wrapping arithmetic, as on the encoding side
+      last_value_ = ::arrow::util::internal::PrefixSum<T>(
+          buffer + i, values_in_mini_block, min_delta_, last_value_);
+      i += values_in_mini_block;
+      values_current_mini_block_ -= values_in_mini_block;
     }
     this->num_values_ -= max_values;
+
+    if (this->num_values_ == 0 && values_current_mini_block_ > 0) {
+      // Skip the padding of the last mini block, so that bytes_left() gives the
+      // position of any data following the encoded values
+      if (!decoder_.Advance(static_cast<int64_t>(values_current_mini_block_) *
+                            delta_bit_width_)) {
+        ParquetException::EofException();
+      }
+      values_current_mini_block_ = 0;
+    }
     return max_values;
   }
 
+  // Read the next num_values deltas of the current mini block into out
+  void GetDeltas(T* out, int num_values) {
+    if (delta_bit_width_ == 0) {
+      std::fill(out, out + num_values, static_cast<T>(0));
+    } else if (delta_bit_width_ <= 32) {
+      // Mini blocks hold a multiple of 32 values, so whole mini blocks are
+      // unpacked by the vectorized unpack32 routines
+      if (decoder_.GetBatch(delta_bit_width_, out, num_values) != num_values) {
+        ParquetException::EofException();
+      }
+    } else {
+      // Only 64-bit integers can have deltas wider than the 32 bits BitReader
+      // reads at a time
+      for (int i = 0; i < num_values; ++i) {
+        uint64_t low_bits = 0, high_bits = 0;
+        if (!decoder_.GetValue(32, &low_bits) ||
+            !decoder_.GetValue(delta_bit_width_ - 32, &high_bits)) {
+          ParquetException::EofException();
+        }
+        out[i] = static_cast<T>(low_bits | (high_bits << 32));
+      }
+    }
+  }
+
   MemoryPool* pool_;
   ::arrow::BitUtil::BitReader decoder_;
-  uint32_t values_current_block_;
-  uint32_t num_mini_blocks_;
-  uint64_t values_per_mini_block_;
-  uint64_t values_current_mini_block_;
-
-  int32_t min_delta_;
-  size_t mini_block_idx_;
+  uint32_t mini_blocks_per_block_ = 0;
+  uint32_t values_per_mini_block_ = 0;
+  uint32_t values_current_mini_block_ = 0;
+  uint32_t mini_block_idx_ = 0;
+  bool block_initialized_ = false;
+  bool first_value_pending_ = false;
+
+  T min_delta_ = 0;
   std::shared_ptr<ResizableBuffer> delta_bit_widths_;
-  int delta_bit_width_;
+  int delta_bit_width_ = 0;
 
-  int32_t last_value_;
+  T last_value_ = 0;
+  std::vector<T> values_;
 };
 
+/// Decode the values of a ByteArray decoder into an Arrow accumulator by way
+/// of an intermediate vector of ByteArray.
+int DecodeByteArraysArrow(TypedDecoder<ByteArrayType>* decoder,
+                          std::vector<ByteArray>* scratch, int num_values,
+                          int null_count, const uint8_t* valid_bits,
+                          int64_t valid_bits_offset,
+                          typename EncodingTraits<ByteArrayType>::Accumulator* out) {
+  const int values_to_decode = num_values - null_count;
+  scratch->resize(values_to_decode);
+  if (decoder->Decode(scratch->data(), values_to_decode) != values_to_decode) {
+    ParquetException::EofException();
+  }
+
+  ArrowBinaryHelper helper(out);
+  PARQUET_THROW_NOT_OK(helper.builder->Reserve(num_values));
+  const ByteArray* value = scratch->data();
+  int i = 0;
+  VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count,
+      [&]() {
+        if (ARROW_PREDICT_FALSE(!helper.CanFit(value->len))) {
+          // This element would exceed the capacity of a chunk
+          PARQUET_THROW_NOT_OK(helper.PushChunk());
+          PARQUET_THROW_NOT_OK(helper.builder->Reserve(num_values - i));
+        }
+        PARQUET_THROW_NOT_OK(
+            helper.Append(value->ptr, static_cast<int32_t>(value->len)));
+        ++value;
+        ++i;
+      },
+      [&]() {
+        helper.UnsafeAppendNull();
+        ++i;
+      });
+  return values_to_decode;
+}
+
+int DecodeByteArraysArrow(
+    TypedDecoder<ByteArrayType>* decoder, std::vector<ByteArray>* scratch,
+    int num_values, int null_count, const uint8_t* valid_bits,
+    int64_t valid_bits_offset,
+    typename EncodingTraits<ByteArrayType>::DictAccumulator* out) {
+  const int values_to_decode = num_values - null_count;
+  scratch->resize(values_to_decode);
+  if (decoder->Decode(scratch->data(), values_to_decode) != values_to_decode) {
+    ParquetException::EofException();
+  }
+
+  PARQUET_THROW_NOT_OK(out->Reserve(num_values));
+  const ByteArray* value = scratch->data();
+  VisitNullBitmapInline(
+      valid_bits, valid_bits_offset, num_values, null_count,
+      [&]() {
+        PARQUET_THROW_NOT_OK(out->Append(value->ptr, static_cast<int32_t>(value->len)));
+        ++value;
+      },
+      [&]() { PARQUET_THROW_NOT_OK(out->AppendNull()); });
+  return values_to_decode;
+}
+
 // ----------------------------------------------------------------------
 // DELTA_LENGTH_BYTE_ARRAY
 
@@ -2162,48 +2764,63 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
                                        MemoryPool* pool = ::arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY),
         len_decoder_(nullptr, pool),
-        pool_(pool) {}
+        lengths_(::arrow::stl::allocator<int32_t>(pool)) {}
 
   void SetData(int num_values, const uint8_t* data, int len) override {
-    num_values_ = num_values;
-    if (len == 0) return;
-    int total_lengths_len = ::arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    this->len_decoder_.SetData(num_values, data, total_lengths_len);
-    data_ = data + total_lengths_len;
-    this->len_ = len - 4 - total_lengths_len;
+    // The lengths of all the values are decoded upfront, as the values
+    // themselves only start after them
+    len_decoder_.SetData(num_values, data, len);
+    const int num_lengths = len_decoder_.values_left();
+    lengths_.resize(num_lengths);
+    if (len_decoder_.Decode(lengths_.data(), num_lengths) != num_lengths) {
+      ParquetException::EofException();
+    }
+    const int lengths_size = len - len_decoder_.bytes_left();
+    DecoderImpl::SetData(num_lengths, data + lengths_size, len - lengths_size);
+    length_idx_ = 0;
   }
 
   int Decode(ByteArray* buffer, int max_values) override {
-    using VectorT = ArrowPoolVector<int>;
     max_values = std::min(max_values, num_values_);
-    VectorT lengths(max_values, 0, ::arrow::stl::allocator<int>(pool_));
-    len_decoder_.Decode(lengths.data(), max_values);
+    const int32_t* lengths = lengths_.data() + length_idx_;
     for (int i = 0; i < max_values; ++i) {
-      buffer[i].len = lengths[i];
+      const int32_t length = lengths[i];
+      if (ARROW_PREDICT_FALSE(length < 0)) {
+        throw ParquetException("Invalid or corrupted length " + std::to_string(length) +
+                               " in DELTA_LENGTH_BYTE_ARRAY page");
+      }
+      if (ARROW_PREDICT_FALSE(len_ < length)) {
+        ParquetException::EofException();
+      }
+      buffer[i].len = static_cast<uint32_t>(length);
       buffer[i].ptr = data_;
-      this->data_ += lengths[i];
-      this->len_ -= lengths[i];
+      data_ += length;
+      len_ -= length;
     }
-    this->num_values_ -= max_values;
+    length_idx_ += max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysArrow(this, &values_, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
   }
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
                   typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
-    ParquetException::NYI("DecodeArrow for DeltaLengthByteArrayDecoder");
+    return DecodeByteArraysArrow(this, &values_, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
   }
 
  private:
   DeltaBitPackDecoder<Int32Type> len_decoder_;
-  ::arrow::MemoryPool* pool_;
+  ArrowPoolVector<int32_t> lengths_;
+  int length_idx_ = 0;
+  std::vector<ByteArray> values_;
 };
 
 // ----------------------------------------------------------------------
@@ -2215,48 +2832,103 @@ class DeltaByteArrayDecoder : public DecoderImpl,
   explicit DeltaByteArrayDecoder(const ColumnDescriptor* descr,
                                  MemoryPool* pool = ::arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::DELTA_BYTE_ARRAY),
+        pool_(pool),
         prefix_len_decoder_(nullptr, pool),
         suffix_decoder_(nullptr, pool),
-        last_value_(0, nullptr) {}
+        prefix_lengths_(::arrow::stl::allocator<int32_t>(pool)) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
-    num_values_ = num_values;
-    if (len == 0) return;
-    int prefix_len_length = ::arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    len -= 4;
-    prefix_len_decoder_.SetData(num_values, data, prefix_len_length);
-    data += prefix_len_length;
-    len -= prefix_len_length;
-    suffix_decoder_.SetData(num_values, data, len);
-  }
-
-  // TODO: this doesn't work and requires memory management. We need to allocate
-  // new strings to store the results.
-  virtual int Decode(ByteArray* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    for (int i = 0; i < max_values; ++i) {
-      int prefix_len = 0;
-      prefix_len_decoder_.Decode(&prefix_len, 1);
-      ByteArray suffix = {0, nullptr};
-      suffix_decoder_.Decode(&suffix, 1);
-      buffer[i].len = prefix_len + suffix.len;
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    prefix_len_decoder_.SetData(num_values, data, len);
+    const int num_prefixes = prefix_len_decoder_.values_left();
+    prefix_lengths_.resize(num_prefixes);
+    if (prefix_len_decoder_.Decode(prefix_lengths_.data(), num_prefixes) !=
+        num_prefixes) {
+      ParquetException::EofException();
+    }
+    const int prefix_lengths_size = len - prefix_len_decoder_.bytes_left();
+    suffix_decoder_.SetData(num_prefixes, data + prefix_lengths_size,
+                            len - prefix_lengths_size);
+    if (suffix_decoder_.values_left() != num_prefixes) {
+      throw ParquetException(
+          "DELTA_BYTE_ARRAY page has different numbers of prefixes and suffixes");
+    }
+    DecoderImpl::SetData(num_prefixes, data, len);
+    prefix_idx_ = 0;
+    last_value_ = ::arrow::util::string_view();
+    buffers_.clear();
+  }
 
-      uint8_t* result = reinterpret_cast<uint8_t*>(malloc(buffer[i].len));
-      memcpy(result, last_value_.ptr, prefix_len);
-      memcpy(result + prefix_len, suffix.ptr, suffix.len);
+  /// The decoded values remain valid until the next call to SetData().
+  int Decode(ByteArray* buffer, int max_values) override {
+    max_values = std::min(max_values, num_values_);
+    if (max_values == 0) return 0;
+    if (suffix_decoder_.Decode(buffer, max_values) != max_values) {
+      ParquetException::EofException();
+    }
 
-      buffer[i].ptr = result;
-      last_value_ = buffer[i];
+    // Values which share a prefix with the previous one must be materialized
+    const int32_t* prefix_lengths = prefix_lengths_.data() + prefix_idx_;
+    int64_t data_size = 0;
+    for (int i = 0; i < max_values; ++i) {
+      if (prefix_lengths[i] > 0) data_size += prefix_lengths[i] + buffer[i].len;
     }
-    this->num_values_ -= max_values;
+    uint8_t* data = nullptr;
+    if (data_size > 0) {
+      PARQUET_ASSIGN_OR_THROW(auto data_buffer,
+                              ::arrow::AllocateBuffer(data_size, pool_));
+      data = data_buffer->mutable_data();
+      buffers_.push_back(std::move(data_buffer));
+    }
+
+    ::arrow::util::string_view previous = last_value_;
+    for (int i = 0; i < max_values; ++i) {
+      const int32_t prefix_length = prefix_lengths[i];
+      if (ARROW_PREDICT_FALSE(prefix_length < 0 ||
+                              static_cast<size_t>(prefix_length) > previous.size())) {
+        throw ParquetException("Invalid or corrupted prefix length " +
+                               std::to_string(prefix_length) +
+                               " in DELTA_BYTE_ARRAY page");
+      }
+      if (prefix_length > 0) {
+        memcpy(data, previous.data(), prefix_length);
+        memcpy(data + prefix_length, buffer[i].ptr, buffer[i].len);
+        buffer[i].ptr = data;
+        buffer[i].len += prefix_length;
+        data += buffer[i].len;
+      }
+      previous = ::arrow::util::string_view(reinterpret_cast<const char*>(buffer[i].ptr),
+                                            buffer[i].len);
+    }
+    last_value_ = previous;
+    prefix_idx_ += max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::Accumulator* out) override {
+    return DecodeByteArraysArrow(this, &values_, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  typename EncodingTraits<ByteArrayType>::DictAccumulator* out) override {
+    return DecodeByteArraysArrow(this, &values_, num_values, null_count, valid_bits,
+                                 valid_bits_offset, out);
+  }
+
  private:
+  MemoryPool* pool_;
   DeltaBitPackDecoder<Int32Type> prefix_len_decoder_;
   DeltaLengthByteArrayDecoder suffix_decoder_;
-  ByteArray last_value_;
+  ArrowPoolVector<int32_t> prefix_lengths_;
+  int prefix_idx_ = 0;
+  // Either points into the page or into one of buffers_
+  ::arrow::util::string_view last_value_;
+  std::vector<std::shared_ptr<Buffer>> buffers_;
+  std::vector<ByteArray> values_;
 };
 
 // ----------------------------------------------------------------------
@@ -2444,6 +3116,26 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int64Type>(descr, pool));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaLengthByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaByteArrayEncoder(descr, pool));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -2484,6 +3176,26 @@ std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encodin
         throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int32Type>(descr));
+      case Type::INT64:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int64Type>(descr));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+        break;
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaLengthByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num == Type::BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaByteArrayDecoder(descr));
+    }
+    throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -356,9 +356,16 @@ class DictDecoder : virtual public TypedDecoder<DType> {
   /// but do not append any indices
   virtual void InsertDictionary(::arrow::ArrayBuilder* builder) = 0;
 
+  /// \brief Return the dictionary as an Arrow array sharing the decoder's
+  /// memory, which is left untouched by later calls to SetDict
+  ///
+  /// Only implemented for BYTE_ARRAY, as a BinaryArray.
+  virtual std::shared_ptr<::arrow::Array> GetDictionary() = 0;
+
   /// \brief Decode only dictionary indices and append to dictionary
   /// builder. The builder must have had the dictionary from this decoder
-  /// inserted already.
+  /// inserted already, or be an Int32Builder whose values index the array
+  /// returned by GetDictionary().
   ///
   /// \warning Remember to reset the builder each time the dict decoder is initialized
   /// with a new dictionary page
@@ -21,6 +21,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <random>
 #include <utility>
 #include <vector>
 
@@ -1014,6 +1015,44 @@ TEST_F(DictEncoding, CheckDecodeIndicesNoNulls) {
   CheckDict(actual_num_values, *builder);
 }
 
+TEST_F(DictEncoding, CheckDecodeIndicesWithDictionary) {
+  for (auto np : null_probabilities_) {
+    InitTestCase(np);
+    auto dictionary = dict_decoder_->GetDictionary();
+    ::arrow::Int32Builder builder;
+    int actual_num_values;
+    if (null_count_ == 0) {
+      actual_num_values = dict_decoder_->DecodeIndices(num_values_, &builder);
+    } else {
+      actual_num_values = dict_decoder_->DecodeIndicesSpaced(num_values_, null_count_,
+                                                             valid_bits_, 0, &builder);
+    }
+    ASSERT_EQ(actual_num_values, num_values_ - null_count_);
+    std::shared_ptr<::arrow::Array> indices;
+    ASSERT_OK(builder.Finish(&indices));
+
+    // The indices and dictionary are those written, so equal to those of the
+    // expected dictionary array
+    ::arrow::DictionaryArray actual(expected_dict_->type(), indices, dictionary);
+    ASSERT_ARRAYS_EQUAL(actual, *expected_dict_);
+
+    // The dictionary outlives the next dictionary page
+    const auto& expected_dictionary =
+        *checked_cast<const ::arrow::DictionaryArray&>(*expected_dict_).dictionary();
+    auto other_encoder =
+        MakeTypedEncoder<ByteArrayType>(Encoding::PLAIN, false, descr_.get());
+    ByteArray other_value("abc");
+    other_encoder->Put(&other_value, 1);
+    auto other_buffer = other_encoder->FlushValues();
+    auto other_decoder = MakeTypedDecoder<ByteArrayType>(Encoding::PLAIN, descr_.get());
+    other_decoder->SetData(1, other_buffer->data(),
+                           static_cast<int>(other_buffer->size()));
+    dict_decoder_->SetDict(other_decoder.get());
+    ASSERT_ARRAYS_EQUAL(*dictionary, expected_dictionary);
+    ASSERT_EQ(1, dict_decoder_->GetDictionary()->length());
+  }
+}
+
 // ----------------------------------------------------------------------
 // BYTE_STREAM_SPLIT encode/decode tests.
 
@@ -1239,5 +1278,329 @@ TEST(ByteStreamSplitEncodeDecode, InvalidDataTypes) {
   ASSERT_THROW(MakeTypedDecoder<FLBAType>(Encoding::BYTE_STREAM_SPLIT), ParquetException);
 }
 
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED encode/decode tests.
+
+template <typename Type>
+class TestDeltaBitPackEncoding : public TestEncodingBase<Type> {
+ public:
+  using c_type = typename Type::c_type;
+  static constexpr int TYPE = Type::type_num;
+
+  void CheckRoundtrip() override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+
+    {
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      int values_decoded = decoder->Decode(decode_buf_, num_values_);
+      ASSERT_EQ(num_values_, values_decoded);
+      ASSERT_NO_FATAL_FAILURE(VerifyResults<c_type>(decode_buf_, draws_, num_values_));
+    }
+
+    {
+      // Try again but with a small step, which is not a multiple of the
+      // mini block size
+      decoder->SetData(num_values_, encode_buffer_->data(),
+                       static_cast<int>(encode_buffer_->size()));
+      int step = 37;
+      int remaining = num_values_;
+      for (int i = 0; i < num_values_; i += step) {
+        int num_decoded = decoder->Decode(decode_buf_, step);
+        ASSERT_EQ(num_decoded, std::min(step, remaining));
+        ASSERT_NO_FATAL_FAILURE(
+            VerifyResults<c_type>(decode_buf_, &draws_[i], num_decoded));
+        remaining -= num_decoded;
+      }
+      ASSERT_EQ(0, decoder->values_left());
+    }
+  }
+
+  void CheckRoundtripSpaced(const uint8_t* valid_bits,
+                            int64_t valid_bits_offset) override {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    int null_count = 0;
+    for (auto i = 0; i < num_values_; i++) {
+      if (!BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+        null_count++;
+      }
+    }
+
+    encoder->PutSpaced(draws_, num_values_, valid_bits, valid_bits_offset);
+    encode_buffer_ = encoder->FlushValues();
+    decoder->SetData(num_values_ - null_count, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    auto values_decoded = decoder->DecodeSpaced(decode_buf_, num_values_, null_count,
+                                                valid_bits, valid_bits_offset);
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_NO_FATAL_FAILURE(VerifyResultsSpaced<c_type>(decode_buf_, draws_, num_values_,
+                                                        valid_bits, valid_bits_offset));
+  }
+
+  // Overwrite the random draws with a monotonic sequence
+  void MakeSorted(c_type start, c_type max_step) {
+    c_type value = start;
+    for (int i = 0; i < num_values_; ++i) {
+      draws_[i] = value;
+      value += static_cast<c_type>(i % (max_step + 1));
+    }
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+};
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackTypes;
+TYPED_TEST_SUITE(TestDeltaBitPackEncoding, DeltaBitPackTypes);
+
+TYPED_TEST(TestDeltaBitPackEncoding, BasicRoundTrip) {
+  // Empty and partial mini blocks, blocks and multiple blocks of random values,
+  // whose deltas overflow
+  for (int values : {0, 1, 2, 31, 32, 33, 127, 128, 129, 1000, 4097}) {
+    ASSERT_NO_FATAL_FAILURE(this->Execute(values, 1));
+  }
+  ASSERT_NO_FATAL_FAILURE(this->Execute(250, 5));
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, RoundTripSpaced) {
+  for (double null_probability : {0.0, 0.1, 0.5, 1.0}) {
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(1000, 1, 0, null_probability));
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteSpaced(1000, 1, 3, null_probability));
+  }
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, SortedValues) {
+  using c_type = typename TypeParam::c_type;
+  this->InitData(10000, 1);
+  this->MakeSorted(static_cast<c_type>(1600000000), 15);
+  ASSERT_NO_FATAL_FAILURE(this->CheckRoundtrip());
+  // Deltas of at most 15 are packed in 4 bits
+  ASSERT_LT(this->encode_buffer_->size(), 10000 * 4 / 8 + 1000);
+
+  this->MakeSorted(std::numeric_limits<c_type>::min(), 0);
+  ASSERT_NO_FATAL_FAILURE(this->CheckRoundtrip());
+  ASSERT_LT(this->encode_buffer_->size(), 1000);
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, ExtremeValues) {
+  using c_type = typename TypeParam::c_type;
+  this->InitData(300, 1);
+  for (int i = 0; i < 300; ++i) {
+    this->draws_[i] = (i % 3 == 0)   ? std::numeric_limits<c_type>::min()
+                      : (i % 3 == 1) ? std::numeric_limits<c_type>::max()
+                                     : static_cast<c_type>(0);
+  }
+  ASSERT_NO_FATAL_FAILURE(this->CheckRoundtrip());
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, AllBitWidths) {
+  // Each mini block of 32 values gets deltas of a different bit width, so that
+  // every unpacking routine is exercised
+  using c_type = typename TypeParam::c_type;
+  using unsigned_type = typename std::make_unsigned<c_type>::type;
+  constexpr int kBitWidth = static_cast<int>(sizeof(c_type) * 8);
+  std::mt19937_64 gen(42);
+  this->InitData(32 * (kBitWidth + 1), 1);
+  unsigned_type value = 0;
+  for (int i = 0; i < this->num_values_; ++i) {
+    const int bit_width = i / 32;
+    const uint64_t mask =
+        bit_width == 64 ? ~uint64_t(0) : (uint64_t(1) << bit_width) - 1;
+    value += static_cast<unsigned_type>(gen() & mask);
+    this->draws_[i] = static_cast<c_type>(value);
+  }
+  ASSERT_NO_FATAL_FAILURE(this->CheckRoundtrip());
+}
+
+TEST(DeltaBitPackEncoding, SpecExample) {
+  // Example 1 of the Parquet specification: 1, 2, 3, 4, 5
+  std::vector<int32_t> values = {1, 2, 3, 4, 5};
+  auto encoder = MakeTypedEncoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  auto buffer = encoder->FlushValues();
+
+  // Header: block size 128, 4 mini blocks, 5 values, first value 1; then a
+  // block with min delta 1 and mini blocks of bit width 0
+  std::vector<uint8_t> expected = {0x80, 0x01, 0x04, 0x05, 0x02, 0x02, 0, 0, 0, 0};
+  ASSERT_EQ(expected, std::vector<uint8_t>(buffer->data(),
+                                           buffer->data() + buffer->size()));
+
+  auto decoder = MakeTypedDecoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  decoder->SetData(5, buffer->data(), static_cast<int>(buffer->size()));
+  std::vector<int32_t> decoded(5);
+  ASSERT_EQ(5, decoder->Decode(decoded.data(), 5));
+  ASSERT_EQ(values, decoded);
+}
+
+TEST(DeltaBitPackEncoding, ArrowDirectPut) {
+  auto values = ::arrow::ArrayFromJSON(::arrow::int64(), "[10, null, 12, 11, null, 20]");
+  auto encoder = MakeTypedEncoder<Int64Type>(Encoding::DELTA_BINARY_PACKED);
+  ASSERT_NO_THROW(encoder->Put(*values));
+  auto buffer = encoder->FlushValues();
+
+  auto decoder = MakeTypedDecoder<Int64Type>(Encoding::DELTA_BINARY_PACKED);
+  decoder->SetData(6, buffer->data(), static_cast<int>(buffer->size()));
+  ASSERT_EQ(4, decoder->values_left());
+  typename EncodingTraits<Int64Type>::Accumulator acc(::arrow::int64(),
+                                                      default_memory_pool());
+  ASSERT_EQ(4, decoder->DecodeArrow(6, 2, values->null_bitmap_data(),
+                                    values->offset(), &acc));
+  std::shared_ptr<::arrow::Array> result;
+  ASSERT_OK(acc.Finish(&result));
+  ::arrow::AssertArraysEqual(*values, *result);
+
+  auto wrong_type = ::arrow::ArrayFromJSON(::arrow::int32(), "[1, 2]");
+  ASSERT_THROW(encoder->Put(*wrong_type), ParquetException);
+}
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY encode/decode tests.
+
+class DeltaLengthByteArrayEncoding : public TestArrowBuilderDecoding {
+ public:
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+    plain_decoder_ = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+    decoder_ = plain_decoder_.get();
+    if (valid_bits_ != nullptr) {
+      ASSERT_NO_THROW(
+          encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    } else {
+      ASSERT_NO_THROW(encoder_->Put(input_data_.data(), num_values_));
+    }
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+  }
+};
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaLengthByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+class DeltaByteArrayEncoding : public TestArrowBuilderDecoding {
+ public:
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    plain_decoder_ = MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BYTE_ARRAY);
+    decoder_ = plain_decoder_.get();
+    if (valid_bits_ != nullptr) {
+      ASSERT_NO_THROW(
+          encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    } else {
+      ASSERT_NO_THROW(encoder_->Put(input_data_.data(), num_values_));
+    }
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+  }
+};
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_F(DeltaByteArrayEncoding, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+class TestDeltaByteArrays : public ::testing::TestWithParam<Encoding::type> {
+ public:
+  std::shared_ptr<Buffer> Encode(const std::vector<ByteArray>& values) {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(GetParam());
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    return encoder->FlushValues();
+  }
+
+  void CheckDecode(const std::shared_ptr<Buffer>& buffer,
+                   const std::vector<ByteArray>& expected, int step) {
+    auto decoder = MakeTypedDecoder<ByteArrayType>(GetParam());
+    const int num_values = static_cast<int>(expected.size());
+    decoder->SetData(num_values, buffer->data(), static_cast<int>(buffer->size()));
+    // Values decoded by earlier calls must remain valid
+    std::vector<ByteArray> decoded(num_values);
+    for (int i = 0; i < num_values; i += step) {
+      ASSERT_EQ(std::min(step, num_values - i), decoder->Decode(&decoded[i], step));
+    }
+    ASSERT_EQ(0, decoder->values_left());
+    for (int i = 0; i < num_values; ++i) {
+      ASSERT_EQ(expected[i], decoded[i]) << i;
+    }
+  }
+};
+
+TEST_P(TestDeltaByteArrays, RoundTrip) {
+  std::vector<std::string> strings = {"axis", "axle", "babble", "babyhood", "", "",
+                                      "b",    "ba",   "c"};
+  std::vector<ByteArray> values;
+  for (const auto& s : strings) values.emplace_back(s);
+
+  auto buffer = Encode(values);
+  for (int step : {1, 2, 4, 100}) {
+    ASSERT_NO_FATAL_FAILURE(CheckDecode(buffer, values, step));
+  }
+  ASSERT_NO_FATAL_FAILURE(CheckDecode(Encode({}), {}, 1));
+}
+
+TEST_P(TestDeltaByteArrays, RandomRoundTrip) {
+  std::vector<uint8_t> heap;
+  std::vector<ByteArray> values(1000);
+  GenerateData<ByteArray>(1000, values.data(), &heap);
+  ASSERT_NO_FATAL_FAILURE(CheckDecode(Encode(values), values, 77));
+}
+
+TEST_P(TestDeltaByteArrays, SortedKeys) {
+  std::vector<std::string> strings;
+  for (int i = 0; i < 1000; ++i) {
+    strings.push_back("customer-key-" + std::to_string(1000000 + i));
+  }
+  std::vector<ByteArray> values;
+  int64_t plain_size = 0;
+  for (const auto& s : strings) {
+    values.emplace_back(s);
+    plain_size += sizeof(uint32_t) + s.size();
+  }
+
+  auto buffer = Encode(values);
+  ASSERT_NO_FATAL_FAILURE(CheckDecode(buffer, values, 100));
+  if (GetParam() == Encoding::DELTA_BYTE_ARRAY) {
+    // Only the last few digits of each key differ from the previous one
+    ASSERT_LT(buffer->size() * 5, plain_size);
+  } else {
+    ASSERT_LT(buffer->size(), plain_size);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(DeltaByteArrayEncodings, TestDeltaByteArrays,
+                         ::testing::Values(Encoding::DELTA_LENGTH_BYTE_ARRAY,
+                                           Encoding::DELTA_BYTE_ARRAY));
+
+TEST(DeltaEncodeDecode, InvalidDataTypes) {
+  for (auto encoding : {Encoding::DELTA_LENGTH_BYTE_ARRAY, Encoding::DELTA_BYTE_ARRAY}) {
+    ASSERT_THROW(MakeTypedEncoder<Int32Type>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedEncoder<FLBAType>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedDecoder<Int64Type>(encoding), ParquetException);
+    ASSERT_THROW(MakeTypedDecoder<FLBAType>(encoding), ParquetException);
+  }
+  ASSERT_THROW(MakeTypedEncoder<BooleanType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<DoubleType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<ByteArrayType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<FloatType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<ByteArrayType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+}
+
 }  // namespace test
 }  // namespace parquet
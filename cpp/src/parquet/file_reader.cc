@@ -30,6 +30,7 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_scanner.h"
 #include "parquet/deprecated_io.h"
@@ -41,6 +42,7 @@
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
+#include "parquet/thrift_internal.h"
 #include "parquet/types.h"
 
 namespace parquet {
@@ -83,6 +85,73 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(
+    int i, const std::vector<RowRange>& row_ranges) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  std::shared_ptr<OffsetIndex> offset_index = contents_->GetOffsetIndex(i);
+  if (offset_index == nullptr) {
+    throw ParquetException("Cannot select the pages of column ", i,
+                           " which has no OffsetIndex");
+  }
+  return contents_->GetColumnPageReader(i, row_ranges, *offset_index);
+}
+
+std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(
+    int i, const std::vector<RowRange>& row_ranges, const OffsetIndex& offset_index) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetColumnPageReader(i, row_ranges, offset_index);
+}
+
+std::shared_ptr<ColumnIndex> RowGroupReader::GetColumnIndex(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetColumnIndex(i);
+}
+
+std::shared_ptr<OffsetIndex> RowGroupReader::GetOffsetIndex(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetOffsetIndex(i);
+}
+
+std::shared_ptr<OffsetIndex> RowGroupReader::ScanOffsetIndex(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->ScanOffsetIndex(i);
+}
+
+std::unique_ptr<BloomFilter> RowGroupReader::GetColumnBloomFilter(int i) {
+  if (i >= metadata()->num_columns()) {
+    std::stringstream ss;
+    ss << "Trying to read column index " << i << " but row group metadata has only "
+       << metadata()->num_columns() << " columns";
+    throw ParquetException(ss.str());
+  }
+  return contents_->GetColumnBloomFilter(i);
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
@@ -154,11 +223,178 @@ class SerializedRowGroup : public RowGroupReader::Contents {
       stream = properties_.GetStream(source_, col_range.offset, col_range.length);
     }
 
-    std::unique_ptr<ColumnCryptoMetaData> crypto_metadata = col->crypto_metadata();
+    return GetColumnPageReader(i, *col, std::move(stream), col->num_values());
+  }
+
+  std::unique_ptr<PageReader> GetColumnPageReader(
+      int i, const std::vector<RowRange>& row_ranges,
+      const OffsetIndex& offset_index) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (col->crypto_metadata()) {
+      // The AAD of encrypted pages depends on their ordinal
+      throw ParquetException("Cannot select the pages of encrypted column ", i);
+    }
+    const auto& page_locations = offset_index.page_locations();
+    int64_t num_rows = row_group_metadata_->num_rows();
+
+    // Gather the dictionary page, which precedes the first data page, and the
+    // selected data pages, coalescing contiguous pages into a single read
+    std::vector<::arrow::io::ReadRange> ranges;
+    ::arrow::io::ReadRange col_range =
+        ComputeColumnChunkRange(file_metadata_, source_size_, row_group_ordinal_, i);
+    if (!page_locations.empty() && page_locations[0].offset > col_range.offset) {
+      ranges.push_back({col_range.offset, page_locations[0].offset - col_range.offset});
+    }
+    int64_t num_values = 0;
+    for (int page : offset_index.SelectPages(row_ranges, num_rows)) {
+      const PageLocation& location = page_locations[page];
+      // Page indexes are only written for non-repeated columns, whose number
+      // of values is the number of rows
+      num_values += offset_index.page_num_rows(page, num_rows);
+      if (!ranges.empty() &&
+          ranges.back().offset + ranges.back().length == location.offset) {
+        ranges.back().length += location.compressed_page_size;
+      } else {
+        ranges.push_back({location.offset, location.compressed_page_size});
+      }
+    }
+
+    ::arrow::BufferVector buffers;
+    for (const auto& range : ranges) {
+      buffers.push_back(ReadBytes(range));
+    }
+    std::shared_ptr<Buffer> pages;
+    if (buffers.size() == 1) {
+      pages = std::move(buffers[0]);
+    } else {
+      PARQUET_ASSIGN_OR_THROW(
+          pages, ::arrow::ConcatenateBuffers(buffers, properties_.memory_pool()));
+    }
+    auto stream = std::make_shared<::arrow::io::BufferReader>(std::move(pages));
+    return GetColumnPageReader(i, *col, std::move(stream), num_values);
+  }
+
+  std::shared_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_column_index() || col->crypto_metadata()) {
+      return nullptr;
+    }
+    std::shared_ptr<Buffer> buffer =
+        ReadBytes({col->column_index_offset(), col->column_index_length()});
+    uint32_t length = static_cast<uint32_t>(buffer->size());
+    return ColumnIndex::Make(row_group_metadata_->schema()->Column(i), buffer->data(),
+                             &length, properties_.memory_pool());
+  }
+
+  std::shared_ptr<OffsetIndex> GetOffsetIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_offset_index() || col->crypto_metadata()) {
+      return nullptr;
+    }
+    std::shared_ptr<Buffer> buffer =
+        ReadBytes({col->offset_index_offset(), col->offset_index_length()});
+    uint32_t length = static_cast<uint32_t>(buffer->size());
+    return OffsetIndex::Make(buffer->data(), &length);
+  }
+
+  std::shared_ptr<OffsetIndex> ScanOffsetIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (col->crypto_metadata()) {
+      throw ParquetException("Cannot scan the page headers of encrypted column ", i);
+    }
+    if (row_group_metadata_->schema()->Column(i)->max_repetition_level() > 0) {
+      throw ParquetException("Cannot locate the rows of the pages of repeated column ",
+                             i);
+    }
+
+    ::arrow::io::ReadRange col_range =
+        ComputeColumnChunkRange(file_metadata_, source_size_, row_group_ordinal_, i);
+    const int64_t col_end = col_range.offset + col_range.length;
+    std::vector<PageLocation> page_locations;
+    int64_t first_row_index = 0;
+    format::PageHeader header;
+    // The range may be padded past the end of the column chunk (PARQUET-816),
+    // so stop after the page holding the last row of the row group
+    const int64_t num_rows = row_group_metadata_->num_rows();
+    for (int64_t position = col_range.offset;
+         position < col_end && first_row_index < num_rows;) {
+      // Page headers can be very large because of page statistics, so read
+      // larger ranges progressively until the header can be deserialized
+      uint32_t header_size = 0;
+      for (int64_t allowed_size = kDefaultPageHeaderSize;; allowed_size *= 2) {
+        std::shared_ptr<Buffer> buffer =
+            ReadBytes({position, std::min(allowed_size, col_end - position)});
+        header_size = static_cast<uint32_t>(buffer->size());
+        try {
+          DeserializeThriftMsg(buffer->data(), &header_size, &header);
+          break;
+        } catch (const ParquetException&) {
+          if (allowed_size >= col_end - position ||
+              allowed_size * 2 > kDefaultMaxPageHeaderSize) {
+            throw;
+          }
+        }
+      }
+      if (header.compressed_page_size < 0) {
+        throw ParquetException("Invalid page header");
+      }
+      const int64_t page_size = header_size + header.compressed_page_size;
+      if (header.type == format::PageType::DATA_PAGE ||
+          header.type == format::PageType::DATA_PAGE_V2) {
+        // The number of values of a page of a non-repeated column is its
+        // number of rows
+        const int64_t page_num_rows = header.type == format::PageType::DATA_PAGE
+                                          ? header.data_page_header.num_values
+                                          : header.data_page_header_v2.num_rows;
+        page_locations.push_back(
+            {position, static_cast<int32_t>(page_size), first_row_index});
+        first_row_index += page_num_rows;
+      }
+      position += page_size;
+    }
+    return OffsetIndex::Make(std::move(page_locations));
+  }
+
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_bloom_filter() || col->crypto_metadata()) {
+      return nullptr;
+    }
+    // The bitset size is only known once its BloomFilterHeader is read
+    const int64_t offset = col->bloom_filter_offset();
+    if (offset < 0 || offset >= source_size_) {
+      throw ParquetException("Invalid Bloom filter offset ", offset);
+    }
+    auto stream =
+        ::arrow::io::RandomAccessFile::GetStream(source_, offset, source_size_ - offset);
+    return std::unique_ptr<BloomFilter>(new BlockSplitBloomFilter(
+        BlockSplitBloomFilter::DeserializeWithHeader(stream.get())));
+  }
+
+ private:
+  std::shared_ptr<Buffer> ReadBytes(const ::arrow::io::ReadRange& range) {
+    if (cached_source_) {
+      // Pre-buffered ranges only include the column chunks, not their page
+      // indexes
+      auto maybe_buffer = cached_source_->Read(range);
+      if (maybe_buffer.ok()) return maybe_buffer.MoveValueUnsafe();
+    }
+    PARQUET_ASSIGN_OR_THROW(auto buffer, source_->ReadAt(range.offset, range.length));
+    if (buffer->size() < range.length) {
+      throw ParquetException("Could only read ", buffer->size(), " of ", range.length,
+                             " bytes at offset ", range.offset);
+    }
+    return buffer;
+  }
+
+  std::unique_ptr<PageReader> GetColumnPageReader(
+      int i, const ColumnChunkMetaData& col, std::shared_ptr<ArrowInputStream> stream,
+      int64_t num_values) {
+    std::unique_ptr<ColumnCryptoMetaData> crypto_metadata = col.crypto_metadata();
 
     // Column is encrypted only if crypto_metadata exists.
     if (!crypto_metadata) {
-      return PageReader::Open(stream, col->num_values(), col->compression(),
+      return PageReader::Open(stream, num_values, col.compression(),
                               properties_.memory_pool());
     }
 
@@ -178,9 +414,9 @@ class SerializedRowGroup : public RowGroupReader::Contents {
     if (crypto_metadata->encrypted_with_footer_key()) {
       meta_decryptor = file_decryptor_->GetFooterDecryptorForColumnMeta();
       data_decryptor = file_decryptor_->GetFooterDecryptorForColumnData();
-      CryptoContext ctx(col->has_dictionary_page(), row_group_ordinal_,
+      CryptoContext ctx(col.has_dictionary_page(), row_group_ordinal_,
                         static_cast<int16_t>(i), meta_decryptor, data_decryptor);
-      return PageReader::Open(stream, col->num_values(), col->compression(),
+      return PageReader::Open(stream, num_values, col.compression(),
                               properties_.memory_pool(), &ctx);
     }
 
@@ -193,13 +429,12 @@ class SerializedRowGroup : public RowGroupReader::Contents {
     data_decryptor =
         file_decryptor_->GetColumnDataDecryptor(column_path, column_key_metadata);
 
-    CryptoContext ctx(col->has_dictionary_page(), row_group_ordinal_,
+    CryptoContext ctx(col.has_dictionary_page(), row_group_ordinal_,
                       static_cast<int16_t>(i), meta_decryptor, data_decryptor);
-    return PageReader::Open(stream, col->num_values(), col->compression(),
+    return PageReader::Open(stream, num_values, col.compression(),
                             properties_.memory_pool(), &ctx);
   }
 
- private:
   std::shared_ptr<ArrowInputFile> source_;
   // Will be nullptr if PreBuffer() is not called.
   std::shared_ptr<::arrow::io::internal::ReadRangeCache> cached_source_;
@@ -265,6 +500,13 @@ class SerializedFile : public ParquetFileReader::Contents {
     PARQUET_THROW_NOT_OK(cached_source_->Cache(ranges));
   }
 
+  ::arrow::Future<> WhenBuffered() const {
+    if (!cached_source_) {
+      return ::arrow::Future<>::MakeFinished();
+    }
+    return cached_source_->Wait();
+  }
+
   void ParseMetaData() {
     if (source_size_ == 0) {
       throw ParquetInvalidOrCorruptedFileException("Parquet file size is 0 bytes");
@@ -602,6 +844,13 @@ void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
   file->PreBuffer(row_groups, column_indices, ctx, options);
 }
 
+::arrow::Future<> ParquetFileReader::WhenBuffered() const {
+  // Access private methods here
+  const SerializedFile* file =
+      ::arrow::internal::checked_cast<const SerializedFile*>(contents_.get());
+  return file->WhenBuffered();
+}
+
 // ----------------------------------------------------------------------
 // File metadata helpers
 
@@ -23,12 +23,15 @@
 #include <vector>
 
 #include "arrow/io/caching.h"
+#include "arrow/util/future.h"
 #include "parquet/metadata.h"  // IWYU pragma: keep
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 
 namespace parquet {
 
+class BloomFilter;
 class ColumnReader;
 class FileMetaData;
 class PageReader;
@@ -43,6 +46,13 @@ class PARQUET_EXPORT RowGroupReader {
   struct Contents {
     virtual ~Contents() {}
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
+    virtual std::unique_ptr<PageReader> GetColumnPageReader(
+        int i, const std::vector<RowRange>& row_ranges,
+        const OffsetIndex& offset_index) = 0;
+    virtual std::shared_ptr<ColumnIndex> GetColumnIndex(int i) = 0;
+    virtual std::shared_ptr<OffsetIndex> GetOffsetIndex(int i) = 0;
+    virtual std::shared_ptr<OffsetIndex> ScanOffsetIndex(int i) = 0;
+    virtual std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
   };
@@ -58,6 +68,48 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  /// \brief Construct a PageReader for the indicated column which only yields
+  /// its dictionary page, if any, and the data pages containing a row of
+  /// \a row_ranges. The other data pages are neither read nor decompressed.
+  ///
+  /// This requires an OffsetIndex for the column, see GetOffsetIndex(). Use
+  /// AlignRowRanges() to read the same rows from several columns.
+  ///
+  /// \param[in] i the row group-relative column index
+  /// \param[in] row_ranges sorted, non-overlapping ranges of rows
+  std::unique_ptr<PageReader> GetColumnPageReader(
+      int i, const std::vector<RowRange>& row_ranges);
+
+  /// \brief Like GetColumnPageReader(i, row_ranges), but locating the data
+  /// pages with the given OffsetIndex, e.g. one returned by ScanOffsetIndex().
+  std::unique_ptr<PageReader> GetColumnPageReader(int i,
+                                                  const std::vector<RowRange>& row_ranges,
+                                                  const OffsetIndex& offset_index);
+
+  /// \brief Read the ColumnIndex (per-page statistics) of the indicated column.
+  ///
+  /// Returns nullptr if the file has no ColumnIndex for the column.
+  std::shared_ptr<ColumnIndex> GetColumnIndex(int i);
+
+  /// \brief Read the OffsetIndex (page locations) of the indicated column.
+  ///
+  /// Returns nullptr if the file has no OffsetIndex for the column.
+  std::shared_ptr<OffsetIndex> GetOffsetIndex(int i);
+
+  /// \brief Locate the data pages of the indicated column by reading the
+  /// header of each of its pages, skipping their contents.
+  ///
+  /// This works for files written without page indexes, at the cost of one
+  /// read per page. The column must be neither repeated nor encrypted, as
+  /// the first row of each page could not be found otherwise.
+  std::shared_ptr<OffsetIndex> ScanOffsetIndex(int i);
+
+  /// \brief Read the Bloom filter of the values of the indicated column, see
+  /// parquet/bloom_filter.h.
+  ///
+  /// Returns nullptr if the file has no Bloom filter for the column.
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -141,6 +193,12 @@ class PARQUET_EXPORT ParquetFileReader {
                  const ::arrow::io::AsyncContext& ctx,
                  const ::arrow::io::CacheOptions& options);
 
+  /// Return a Future which completes once the data requested by the last call
+  /// to \a PreBuffer() is in memory, so that reading it does not block on I/O.
+  ///
+  /// If \a PreBuffer() was not called, the returned Future is already finished.
+  ::arrow::Future<> WhenBuffered() const;
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
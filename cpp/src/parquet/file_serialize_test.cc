@@ -18,15 +18,23 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include "arrow/testing/gtest_compat.h"
+#include "arrow/util/bit_util.h"
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_writer.h"
 #include "parquet/file_reader.h"
 #include "parquet/file_writer.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
+#include "parquet/statistics.h"
 #include "parquet/test_util.h"
+#include "parquet/thrift_internal.h"
 #include "parquet/types.h"
+#include "parquet/xxhasher.h"
 
 namespace parquet {
 
@@ -449,6 +457,478 @@ TEST(ParquetRoundtrip, AllNulls) {
   EXPECT_THAT(def_levels, ElementsAre(0, 0, 0));
 }
 
+constexpr int kNumRows = 2000;
+constexpr int kBatchSize = 100;
+
+class TestPageIndex : public ::testing::TestWithParam<bool> {
+ public:
+  // Write a dictionary encoded, sorted INT64 column and a PLAIN encoded INT32
+  // column whose values are null from row 1000 on
+  void WriteFile(bool write_page_index,
+                 const std::string& created_by = DEFAULT_CREATED_BY) {
+    schema::NodeVector fields;
+    fields.push_back(PrimitiveNode::Make("sorted", Repetition::REQUIRED, Type::INT64));
+    fields.push_back(PrimitiveNode::Make("nullable", Repetition::OPTIONAL, Type::INT32));
+    auto schema = std::static_pointer_cast<GroupNode>(
+        GroupNode::Make("schema", Repetition::REQUIRED, fields));
+
+    WriterProperties::Builder builder;
+    // Pages of the INT32 column hold 200 rows
+    builder.write_batch_size(kBatchSize)->data_pagesize(800)->disable_dictionary(
+        "nullable");
+    builder.created_by(created_by);
+    if (write_page_index) builder.enable_write_page_index();
+
+    auto sink = CreateOutputStream();
+    auto file_writer = ParquetFileWriter::Open(sink, schema, builder.build());
+    // buffered_row_group: write pages to a buffer and copy them at Close()
+    bool buffered_row_group = GetParam();
+    auto rg_writer = buffered_row_group ? file_writer->AppendBufferedRowGroup()
+                                        : file_writer->AppendRowGroup();
+    std::vector<int64_t> sorted(kNumRows);
+    std::vector<int32_t> nullable;
+    std::vector<int16_t> def_levels(kNumRows);
+    for (int i = 0; i < kNumRows; ++i) {
+      sorted[i] = i * 10;
+      def_levels[i] = i < 1000;
+      if (def_levels[i]) nullable.push_back(i);
+    }
+    auto sorted_writer = static_cast<Int64Writer*>(
+        buffered_row_group ? rg_writer->column(0) : rg_writer->NextColumn());
+    sorted_writer->WriteBatch(kNumRows, nullptr, nullptr, sorted.data());
+    auto nullable_writer = static_cast<Int32Writer*>(
+        buffered_row_group ? rg_writer->column(1) : rg_writer->NextColumn());
+    nullable_writer->WriteBatch(kNumRows, def_levels.data(), nullptr, nullable.data());
+    rg_writer->Close();
+    file_writer->Close();
+
+    PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+    file_reader_ =
+        ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  }
+
+  // Read all the values of a page reader's pages
+  std::vector<int64_t> ReadSorted(std::unique_ptr<PageReader> pager) {
+    auto column_reader = std::static_pointer_cast<Int64Reader>(ColumnReader::Make(
+        file_reader_->metadata()->schema()->Column(0), std::move(pager)));
+    std::vector<int64_t> values;
+    while (column_reader->HasNext()) {
+      int64_t value, values_read;
+      column_reader->ReadBatch(1, nullptr, nullptr, &value, &values_read);
+      values.push_back(value);
+    }
+    return values;
+  }
+
+ protected:
+  std::unique_ptr<ParquetFileReader> file_reader_;
+};
+
+TEST_P(TestPageIndex, NotWrittenByDefault) {
+  WriteFile(/*write_page_index=*/false);
+  auto rg_reader = file_reader_->RowGroup(0);
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(i)->has_column_index());
+    ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(i)->has_offset_index());
+    ASSERT_EQ(nullptr, rg_reader->GetColumnIndex(i));
+    ASSERT_EQ(nullptr, rg_reader->GetOffsetIndex(i));
+  }
+  ASSERT_THROW(rg_reader->GetColumnPageReader(0, {{0, 1}}), ParquetException);
+}
+
+TEST_P(TestPageIndex, ReadPageIndex) {
+  WriteFile(/*write_page_index=*/true);
+  auto rg_reader = file_reader_->RowGroup(0);
+  auto column_chunk = rg_reader->metadata()->ColumnChunk(0);
+  const int64_t chunk_start =
+      column_chunk->file_offset() - column_chunk->total_compressed_size();
+
+  for (int i = 0; i < 2; ++i) {
+    auto offset_index = rg_reader->GetOffsetIndex(i);
+    auto column_index = rg_reader->GetColumnIndex(i);
+    ASSERT_NE(nullptr, offset_index);
+    ASSERT_NE(nullptr, column_index);
+    ASSERT_GT(offset_index->num_pages(), 1);
+    ASSERT_EQ(offset_index->num_pages(), column_index->num_pages());
+    ASSERT_EQ(0, offset_index->page_locations()[0].first_row_index);
+
+    int64_t num_rows = 0;
+    for (int page = 0; page < offset_index->num_pages(); ++page) {
+      const PageLocation& location = offset_index->page_locations()[page];
+      ASSERT_EQ(num_rows, location.first_row_index);
+      ASSERT_GE(location.offset, chunk_start);
+      num_rows += offset_index->page_num_rows(page, kNumRows);
+    }
+    ASSERT_EQ(kNumRows, num_rows);
+  }
+
+  // The statistics of the sorted column are its first and last values
+  auto offset_index = rg_reader->GetOffsetIndex(0);
+  auto column_index = rg_reader->GetColumnIndex(0);
+  for (int page = 0; page < column_index->num_pages(); ++page) {
+    int64_t first_row = offset_index->page_locations()[page].first_row_index;
+    int64_t page_num_rows = offset_index->page_num_rows(page, kNumRows);
+    auto stats = std::static_pointer_cast<Int64Statistics>(
+        column_index->page_statistics(page, page_num_rows));
+    ASSERT_FALSE(column_index->null_page(page));
+    ASSERT_TRUE(stats->HasMinMax());
+    ASSERT_EQ(first_row * 10, stats->min());
+    ASSERT_EQ((first_row + page_num_rows - 1) * 10, stats->max());
+    ASSERT_EQ(page_num_rows, stats->num_values());
+  }
+
+  // The pages of the nullable column from row 1000 on only hold nulls
+  offset_index = rg_reader->GetOffsetIndex(1);
+  column_index = rg_reader->GetColumnIndex(1);
+  ASSERT_TRUE(column_index->has_null_counts());
+  int num_null_pages = 0;
+  for (int page = 0; page < column_index->num_pages(); ++page) {
+    int64_t first_row = offset_index->page_locations()[page].first_row_index;
+    int64_t page_num_rows = offset_index->page_num_rows(page, kNumRows);
+    if (first_row >= 1000) {
+      ASSERT_TRUE(column_index->null_page(page));
+      ASSERT_EQ(page_num_rows, column_index->null_count(page));
+      ASSERT_FALSE(column_index->page_statistics(page, page_num_rows)->HasMinMax());
+      ++num_null_pages;
+    } else {
+      ASSERT_FALSE(column_index->null_page(page));
+    }
+  }
+  ASSERT_GT(num_null_pages, 0);
+}
+
+TEST_P(TestPageIndex, SelectPages) {
+  WriteFile(/*write_page_index=*/true);
+  auto rg_reader = file_reader_->RowGroup(0);
+  auto offset_index = rg_reader->GetOffsetIndex(0);
+  const auto& locations = offset_index->page_locations();
+
+  // A single row only reads its page
+  std::vector<int> pages = offset_index->SelectPages({{1234, 1}}, kNumRows);
+  ASSERT_EQ(1, pages.size());
+  int64_t first_row = locations[pages[0]].first_row_index;
+  int64_t page_num_rows = offset_index->page_num_rows(pages[0], kNumRows);
+  ASSERT_LE(first_row, 1234);
+  ASSERT_GT(first_row + page_num_rows, 1234);
+
+  std::vector<int64_t> expected;
+  for (int64_t row = first_row; row < first_row + page_num_rows; ++row) {
+    expected.push_back(row * 10);
+  }
+  ASSERT_EQ(expected, ReadSorted(rg_reader->GetColumnPageReader(0, {{1234, 1}})));
+
+  // Ranges spanning several pages, the last one included
+  pages = offset_index->SelectPages({{0, 1}, {1500, 500}}, kNumRows);
+  ASSERT_EQ(0, pages.front());
+  ASSERT_EQ(offset_index->num_pages() - 1, pages.back());
+  auto values = ReadSorted(rg_reader->GetColumnPageReader(0, {{0, 1}, {1500, 500}}));
+  ASSERT_EQ(0, values.front());
+  ASSERT_EQ((kNumRows - 1) * 10, values.back());
+
+  ASSERT_EQ(std::vector<int64_t>{}, ReadSorted(rg_reader->GetColumnPageReader(0, {})));
+}
+
+TEST_P(TestPageIndex, AlignRowRanges) {
+  WriteFile(/*write_page_index=*/true);
+  auto rg_reader = file_reader_->RowGroup(0);
+  std::vector<std::shared_ptr<OffsetIndex>> offset_indexes = {
+      rg_reader->GetOffsetIndex(0), rg_reader->GetOffsetIndex(1)};
+
+  auto aligned = AlignRowRanges({{700, 1}, {1234, 10}}, offset_indexes, kNumRows);
+  ASSERT_FALSE(aligned.empty());
+  ASSERT_LE(aligned.front().offset, 700);
+  ASSERT_GE(aligned.back().end(), 1244);
+  // Both columns read the same rows
+  for (const auto& offset_index : offset_indexes) {
+    int64_t num_rows = 0;
+    for (int page : offset_index->SelectPages(aligned, kNumRows)) {
+      num_rows += offset_index->page_num_rows(page, kNumRows);
+    }
+    int64_t expected_num_rows = 0;
+    for (const auto& range : aligned) expected_num_rows += range.length;
+    ASSERT_EQ(expected_num_rows, num_rows);
+  }
+  auto values = ReadSorted(rg_reader->GetColumnPageReader(0, aligned));
+  ASSERT_EQ(aligned.front().offset * 10, values.front());
+  ASSERT_EQ((aligned.back().end() - 1) * 10, values.back());
+
+  ASSERT_EQ(std::vector<RowRange>{}, AlignRowRanges({}, offset_indexes, kNumRows));
+  ASSERT_EQ(std::vector<RowRange>({{0, kNumRows}}),
+            AlignRowRanges({{0, 1}}, {offset_indexes[0], nullptr}, kNumRows));
+}
+
+TEST_P(TestPageIndex, SkipRecords) {
+  WriteFile(/*write_page_index=*/true);
+  auto rg_reader = file_reader_->RowGroup(0);
+  auto offset_index = rg_reader->GetOffsetIndex(1);
+  const ColumnDescriptor* descr = file_reader_->metadata()->schema()->Column(1);
+  const std::vector<RowRange> row_ranges = {{5, 3}, {150, 100}, {990, 20}, {1990, 10}};
+
+  // Read row_ranges from the whole column chunk, then from the pages holding them
+  for (bool select_pages : {false, true}) {
+    auto record_reader = internal::RecordReader::Make(
+        descr, internal::LevelInfo(1, /*definition_level=*/1, 0, 0));
+    std::vector<RowRange> ranges = row_ranges;
+    if (select_pages) {
+      record_reader->SetPageReader(rg_reader->GetColumnPageReader(1, row_ranges));
+      ranges = offset_index->RowRangesInSelectedPages(row_ranges, kNumRows);
+      ASSERT_LT(ranges.back().end(), kNumRows);
+    } else {
+      record_reader->SetPageReader(rg_reader->GetColumnPageReader(1));
+    }
+
+    int64_t position = 0;
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      record_reader->Reset();
+      ASSERT_EQ(ranges[i].offset - position,
+                record_reader->SkipRecords(ranges[i].offset - position));
+      ASSERT_EQ(ranges[i].length, record_reader->ReadRecords(ranges[i].length));
+      position = ranges[i].end();
+
+      ASSERT_EQ(ranges[i].length, record_reader->values_written());
+      auto values = reinterpret_cast<const int32_t*>(record_reader->values());
+      auto is_valid = record_reader->ReleaseIsValid();
+      for (int64_t j = 0; j < ranges[i].length; ++j) {
+        const int64_t row = row_ranges[i].offset + j;
+        ASSERT_EQ(row < 1000, ::arrow::BitUtil::GetBit(is_valid->data(), j)) << row;
+        if (row < 1000) ASSERT_EQ(row, values[j]);
+      }
+    }
+  }
+}
+
+TEST_P(TestPageIndex, ScanOffsetIndex) {
+  // The column chunk ranges of files written by parquet-mr 1.2.8 and below
+  // are padded into the next column chunk (PARQUET-816)
+  for (const std::string created_by :
+       {std::string(DEFAULT_CREATED_BY), std::string("parquet-mr version 1.2.8")}) {
+    SCOPED_TRACE(created_by);
+    WriteFile(/*write_page_index=*/true, created_by);
+    auto rg_reader = file_reader_->RowGroup(0);
+    for (int i = 0; i < 2; ++i) {
+      auto offset_index = rg_reader->GetOffsetIndex(i);
+      auto scanned = rg_reader->ScanOffsetIndex(i);
+      ASSERT_NE(nullptr, scanned);
+      ASSERT_EQ(offset_index->num_pages(), scanned->num_pages());
+      for (int page = 0; page < offset_index->num_pages(); ++page) {
+        const PageLocation& expected = offset_index->page_locations()[page];
+        const PageLocation& actual = scanned->page_locations()[page];
+        ASSERT_EQ(expected.offset, actual.offset);
+        ASSERT_EQ(expected.compressed_page_size, actual.compressed_page_size);
+        ASSERT_EQ(expected.first_row_index, actual.first_row_index);
+      }
+    }
+  }
+
+  // Files without page index select the pages of the scanned OffsetIndex
+  WriteFile(/*write_page_index=*/false);
+  auto rg_reader = file_reader_->RowGroup(0);
+  auto scanned = rg_reader->ScanOffsetIndex(0);
+  ASSERT_GT(scanned->num_pages(), 1);
+  auto values = ReadSorted(rg_reader->GetColumnPageReader(0, {{1234, 1}}, *scanned));
+  ASSERT_FALSE(values.empty());
+  ASSERT_LE(values.front(), 12340);
+  ASSERT_GT(values.back(), 12340);
+  ASSERT_LT(values.size(), kNumRows);
+}
+
+INSTANTIATE_TEST_SUITE_P(BufferedRowGroup, TestPageIndex, ::testing::Bool());
+
+TEST(TestColumnBloomFilter, WriteAndRead) {
+  schema::NodeVector fields;
+  fields.push_back(PrimitiveNode::Make("id", Repetition::REQUIRED, Type::INT64));
+  fields.push_back(PrimitiveNode::Make("name", Repetition::OPTIONAL, Type::BYTE_ARRAY));
+  fields.push_back(PrimitiveNode::Make("other", Repetition::REQUIRED, Type::INT32));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+
+  auto properties = WriterProperties::Builder()
+                        .enable_bloom_filter("id", /*ndv=*/kNumRows)
+                        ->enable_bloom_filter("name", /*ndv=*/kNumRows, /*fpp=*/0.05)
+                        ->build();
+  ASSERT_TRUE(properties->bloom_filter_enabled(schema::ColumnPath::FromDotString("id")));
+  ASSERT_FALSE(
+      properties->bloom_filter_enabled(schema::ColumnPath::FromDotString("other")));
+  ASSERT_THROW(WriterProperties::Builder().enable_bloom_filter("id", 0),
+               ParquetException);
+  ASSERT_THROW(WriterProperties::Builder().enable_bloom_filter("id", 1, 1.0),
+               ParquetException);
+
+  // Two row groups, the second one holding ids [kNumRows, 2 * kNumRows) and
+  // the names of the odd ids
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema, properties);
+  std::vector<std::string> names;
+  for (int row_group = 0; row_group < 2; ++row_group) {
+    auto rg_writer = file_writer->AppendRowGroup();
+    std::vector<int64_t> ids(kNumRows);
+    std::vector<int16_t> def_levels(kNumRows);
+    std::vector<ByteArray> name_values;
+    for (int i = 0; i < kNumRows; ++i) {
+      ids[i] = row_group * kNumRows + i;
+      def_levels[i] = ids[i] % 2;
+      names.push_back("name" + std::to_string(ids[i]));
+    }
+    for (int i = 0; i < kNumRows; ++i) {
+      if (def_levels[i]) name_values.emplace_back(names[row_group * kNumRows + i]);
+    }
+    static_cast<Int64Writer*>(rg_writer->NextColumn())
+        ->WriteBatch(kNumRows, nullptr, nullptr, ids.data());
+    static_cast<ByteArrayWriter*>(rg_writer->NextColumn())
+        ->WriteBatch(kNumRows, def_levels.data(), nullptr, name_values.data());
+    std::vector<int32_t> others(kNumRows, 0);
+    static_cast<Int32Writer*>(rg_writer->NextColumn())
+        ->WriteBatch(kNumRows, nullptr, nullptr, others.data());
+    rg_writer->Close();
+  }
+  file_writer->Close();
+
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+
+  for (int row_group = 0; row_group < 2; ++row_group) {
+    auto rg_reader = file_reader->RowGroup(row_group);
+    ASSERT_TRUE(rg_reader->metadata()->ColumnChunk(0)->has_bloom_filter());
+    ASSERT_FALSE(rg_reader->metadata()->ColumnChunk(2)->has_bloom_filter());
+    ASSERT_EQ(nullptr, rg_reader->GetColumnBloomFilter(2));
+
+    // The filter is stored after a thrift BloomFilterHeader, as specified by
+    // the Parquet format
+    int64_t bloom_filter_offset =
+        rg_reader->metadata()->ColumnChunk(0)->bloom_filter_offset();
+    format::BloomFilterHeader header;
+    uint32_t header_size = static_cast<uint32_t>(buffer->size() - bloom_filter_offset);
+    DeserializeThriftMsg(buffer->data() + bloom_filter_offset, &header_size, &header);
+    ASSERT_TRUE(header.algorithm.__isset.BLOCK);
+    ASSERT_TRUE(header.hash.__isset.XXHASH);
+    ASSERT_TRUE(header.compression.__isset.UNCOMPRESSED);
+
+    auto id_filter = rg_reader->GetColumnBloomFilter(0);
+    auto name_filter = rg_reader->GetColumnBloomFilter(1);
+    ASSERT_NE(nullptr, id_filter);
+    ASSERT_NE(nullptr, name_filter);
+    ASSERT_EQ(header.numBytes, id_filter->GetBitsetSize());
+
+    // Values are hashed with xxHash
+    XxHasher hasher;
+    int64_t first_id = row_group * kNumRows;
+    ASSERT_EQ(hasher.Hash(first_id), id_filter->Hash(first_id));
+
+    // All the values of the row group are found, and most of the others not
+    int id_false_positives = 0, name_false_positives = 0;
+    for (int64_t id = 0; id < 2 * kNumRows; ++id) {
+      bool in_row_group = id / kNumRows == row_group;
+      bool id_found = id_filter->FindHash(id_filter->Hash(id));
+      if (in_row_group) {
+        ASSERT_TRUE(id_found) << id;
+      } else {
+        id_false_positives += id_found;
+      }
+
+      // Only the names of odd ids are not null
+      ByteArray name(names[id]);
+      bool name_found = name_filter->FindHash(name_filter->Hash(&name));
+      if (in_row_group && id % 2 == 1) {
+        ASSERT_TRUE(name_found) << names[id];
+      } else {
+        name_false_positives += name_found;
+      }
+    }
+    ASSERT_LT(id_false_positives, kNumRows / 20);
+    ASSERT_LT(name_false_positives, 3 * kNumRows / 20);
+  }
+}
+
+TEST(TestDeltaEncodings, WriteAndRead) {
+  schema::NodeVector fields;
+  fields.push_back(PrimitiveNode::Make("id", Repetition::REQUIRED, Type::INT64));
+  fields.push_back(PrimitiveNode::Make("key", Repetition::OPTIONAL, Type::BYTE_ARRAY));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+
+  // The keys fall back from dictionary encoding to their configured encoding,
+  // as the dictionary exceeds its page size limit
+  auto properties = WriterProperties::Builder()
+                        .disable_dictionary("id")
+                        ->encoding("id", Encoding::DELTA_BINARY_PACKED)
+                        ->encoding("key", Encoding::DELTA_BYTE_ARRAY)
+                        ->dictionary_pagesize_limit(1024)
+                        ->data_pagesize(4096)
+                        ->build();
+
+  // Sorted timestamp-like ids and sorted keys, one in ten of which is null
+  std::vector<int64_t> ids(kNumRows);
+  std::vector<std::string> keys(kNumRows);
+  std::vector<int16_t> def_levels(kNumRows);
+  std::vector<ByteArray> key_values;
+  for (int i = 0; i < kNumRows; ++i) {
+    ids[i] = 1600000000000LL + 7 * i + i % 3;
+    keys[i] = "key-" + std::to_string(1000000 + i);
+    def_levels[i] = i % 10 != 0;
+    if (def_levels[i]) key_values.emplace_back(keys[i]);
+  }
+
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema, properties);
+  auto rg_writer = file_writer->AppendRowGroup();
+  static_cast<Int64Writer*>(rg_writer->NextColumn())
+      ->WriteBatch(kNumRows, nullptr, nullptr, ids.data());
+  static_cast<ByteArrayWriter*>(rg_writer->NextColumn())
+      ->WriteBatch(kNumRows, def_levels.data(), nullptr, key_values.data());
+  rg_writer->Close();
+  file_writer->Close();
+
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  auto rg_reader = file_reader->RowGroup(0);
+
+  auto id_metadata = rg_reader->metadata()->ColumnChunk(0);
+  auto key_metadata = rg_reader->metadata()->ColumnChunk(1);
+  auto HasEncoding = [](const std::vector<Encoding::type>& encodings,
+                        Encoding::type encoding) {
+    return std::find(encodings.begin(), encodings.end(), encoding) != encodings.end();
+  };
+  ASSERT_TRUE(HasEncoding(id_metadata->encodings(), Encoding::DELTA_BINARY_PACKED));
+  ASSERT_TRUE(HasEncoding(key_metadata->encodings(), Encoding::DELTA_BYTE_ARRAY));
+  // The ids need less than 8 bits each
+  ASSERT_LT(id_metadata->total_uncompressed_size(), kNumRows);
+
+  auto id_reader = std::static_pointer_cast<Int64Reader>(rg_reader->Column(0));
+  std::vector<int64_t> ids_out(kNumRows);
+  int64_t rows_read = 0;
+  while (id_reader->HasNext()) {
+    int64_t values_read = 0;
+    rows_read += id_reader->ReadBatch(kNumRows, nullptr, nullptr,
+                                      ids_out.data() + rows_read, &values_read);
+  }
+  ASSERT_EQ(kNumRows, rows_read);
+  ASSERT_EQ(ids, ids_out);
+
+  auto key_reader = std::static_pointer_cast<ByteArrayReader>(rg_reader->Column(1));
+  std::vector<int16_t> def_levels_out(kNumRows);
+  std::vector<ByteArray> key_values_out(kNumRows);
+  rows_read = 0;
+  int64_t total_values_read = 0;
+  while (key_reader->HasNext()) {
+    int64_t values_read = 0;
+    int64_t batch_rows = key_reader->ReadBatch(
+        kNumRows, def_levels_out.data() + rows_read, nullptr,
+        key_values_out.data() + total_values_read, &values_read);
+    // The values are only valid until the next page is read
+    for (int64_t i = 0; i < values_read; ++i) {
+      ASSERT_EQ(key_values[total_values_read + i], key_values_out[total_values_read + i])
+          << total_values_read + i;
+    }
+    rows_read += batch_rows;
+    total_values_read += values_read;
+  }
+  ASSERT_EQ(kNumRows, rows_read);
+  ASSERT_EQ(def_levels, def_levels_out);
+  ASSERT_EQ(static_cast<int64_t>(key_values.size()), total_values_read);
+}
+
 }  // namespace test
 
 }  // namespace parquet
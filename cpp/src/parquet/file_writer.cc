@@ -66,6 +66,10 @@ int RowGroupWriter::current_column() { return contents_->current_column(); }
 
 int RowGroupWriter::num_columns() const { return contents_->num_columns(); }
 
+int64_t RowGroupWriter::total_buffered_bytes() const {
+  return contents_->total_buffered_bytes();
+}
+
 int64_t RowGroupWriter::num_rows() const { return contents_->num_rows(); }
 
 inline void ThrowRowsMisMatchError(int col, int64_t prev, int64_t curr) {
@@ -177,6 +181,19 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     return total_bytes_written;
   }
 
+  int64_t total_buffered_bytes() const override {
+    // The size of the columns which were closed already
+    int64_t total_buffered_bytes = total_bytes_written_;
+    for (size_t i = 0; i < column_writers_.size(); i++) {
+      if (column_writers_[i]) {
+        total_buffered_bytes += column_writers_[i]->total_bytes_written() +
+                                column_writers_[i]->total_compressed_bytes() +
+                                column_writers_[i]->estimated_buffered_value_bytes();
+      }
+    }
+    return total_buffered_bytes;
+  }
+
   void Close() override {
     if (!closed_) {
       closed_ = true;
@@ -194,6 +211,11 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
       // Ensures all columns have been written
       metadata_->set_num_rows(num_rows_);
       metadata_->Finish(total_bytes_written_, row_group_ordinal_);
+
+      metadata_->WriteBloomFilters(sink_.get());
+      if (properties_->write_page_index()) {
+        metadata_->WritePageIndex(sink_.get());
+      }
     }
   }
 
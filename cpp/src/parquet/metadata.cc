@@ -26,6 +26,7 @@
 
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
+#include "parquet/bloom_filter.h"
 #include "parquet/encryption_internal.h"
 #include "parquet/exception.h"
 #include "parquet/internal_file_decryptor.h"
@@ -290,6 +291,30 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
     }
   }
 
+  inline bool has_column_index() const {
+    return column_->__isset.column_index_offset && column_->__isset.column_index_length;
+  }
+
+  inline int64_t column_index_offset() const { return column_->column_index_offset; }
+
+  inline int32_t column_index_length() const { return column_->column_index_length; }
+
+  inline bool has_offset_index() const {
+    return column_->__isset.offset_index_offset && column_->__isset.offset_index_length;
+  }
+
+  inline int64_t offset_index_offset() const { return column_->offset_index_offset; }
+
+  inline int32_t offset_index_length() const { return column_->offset_index_length; }
+
+  inline bool has_bloom_filter() const {
+    return column_metadata_->__isset.bloom_filter_offset;
+  }
+
+  inline int64_t bloom_filter_offset() const {
+    return column_metadata_->bloom_filter_offset;
+  }
+
  private:
   mutable std::shared_ptr<Statistics> possible_stats_;
   std::vector<Encoding::type> encodings_;
@@ -378,6 +403,32 @@ int64_t ColumnChunkMetaData::total_uncompressed_size() const {
   return impl_->total_uncompressed_size();
 }
 
+bool ColumnChunkMetaData::has_column_index() const { return impl_->has_column_index(); }
+
+int64_t ColumnChunkMetaData::column_index_offset() const {
+  return impl_->column_index_offset();
+}
+
+int32_t ColumnChunkMetaData::column_index_length() const {
+  return impl_->column_index_length();
+}
+
+bool ColumnChunkMetaData::has_offset_index() const { return impl_->has_offset_index(); }
+
+int64_t ColumnChunkMetaData::offset_index_offset() const {
+  return impl_->offset_index_offset();
+}
+
+int32_t ColumnChunkMetaData::offset_index_length() const {
+  return impl_->offset_index_length();
+}
+
+bool ColumnChunkMetaData::has_bloom_filter() const { return impl_->has_bloom_filter(); }
+
+int64_t ColumnChunkMetaData::bloom_filter_offset() const {
+  return impl_->bloom_filter_offset();
+}
+
 int64_t ColumnChunkMetaData::total_compressed_size() const {
   return impl_->total_compressed_size();
 }
@@ -1329,6 +1380,15 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
     column_chunk_->meta_data.__set_total_uncompressed_size(uncompressed_size);
     column_chunk_->meta_data.__set_total_compressed_size(compressed_size);
 
+    // Make the recorded page offsets relative to the beginning of the file
+    auto& page_locations = offset_index_.page_locations;
+    if (!page_locations.empty()) {
+      int64_t delta = data_page_offset - page_locations[0].offset;
+      for (auto& location : page_locations) {
+        location.offset += delta;
+      }
+    }
+
     std::vector<format::Encoding::type> thrift_encodings;
     if (has_dictionary) {
       thrift_encodings.push_back(ToThrift(properties_->dictionary_index_encoding()));
@@ -1341,10 +1401,9 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
       thrift_encodings.push_back(ToThrift(properties_->encoding(column_->path())));
     }
     thrift_encodings.push_back(ToThrift(Encoding::RLE));
-    // Only PLAIN encoding is supported for fallback in V1
-    // TODO(majetideepak): Use user specified encoding for V2
     if (dictionary_fallback) {
-      thrift_encodings.push_back(ToThrift(Encoding::PLAIN));
+      thrift_encodings.push_back(ToThrift(properties_->dictionary_fallback_encoding(
+          column_->path(), column_->physical_type())));
     }
     column_chunk_->meta_data.__set_encodings(thrift_encodings);
     std::vector<format::PageEncodingStats> thrift_encoding_stats;
@@ -1427,6 +1486,73 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
     serializer.Serialize(column_chunk_, sink);
   }
 
+  void RecordDataPage(int64_t offset, int32_t compressed_page_size, int64_t num_values,
+                      const EncodedStatistics& page_statistics) {
+    if (!write_page_index_) return;
+
+    format::PageLocation location;
+    location.__set_offset(offset);
+    location.__set_compressed_page_size(compressed_page_size);
+    location.__set_first_row_index(num_indexed_rows_);
+    offset_index_.page_locations.push_back(location);
+    // Page indexes are only written for non-repeated columns, which have as
+    // many values as rows
+    num_indexed_rows_ += num_values;
+
+    // A ColumnIndex can only be written if every page has statistics
+    bool null_page = page_statistics.has_null_count &&
+                     page_statistics.null_count == num_values;
+    if (!null_page && !(page_statistics.has_min && page_statistics.has_max)) {
+      has_column_index_ = false;
+    }
+    if (!page_statistics.has_null_count) {
+      has_null_counts_ = false;
+    }
+    if (!has_column_index_) return;
+
+    column_index_.null_pages.push_back(null_page);
+    column_index_.min_values.push_back(null_page ? "" : page_statistics.min());
+    column_index_.max_values.push_back(null_page ? "" : page_statistics.max());
+    column_index_.null_counts.push_back(page_statistics.null_count);
+  }
+
+  void WriteColumnIndex(::arrow::io::OutputStream* sink) {
+    if (!has_column_index_ || offset_index_.page_locations.empty()) return;
+
+    column_index_.__set_boundary_order(format::BoundaryOrder::UNORDERED);
+    column_index_.__isset.null_counts = has_null_counts_;
+    if (!has_null_counts_) column_index_.null_counts.clear();
+
+    PARQUET_ASSIGN_OR_THROW(int64_t offset, sink->Tell());
+    ThriftSerializer serializer;
+    int64_t length = serializer.Serialize(&column_index_, sink);
+    column_chunk_->__set_column_index_offset(offset);
+    column_chunk_->__set_column_index_length(static_cast<int32_t>(length));
+  }
+
+  void WriteOffsetIndex(::arrow::io::OutputStream* sink) {
+    if (offset_index_.page_locations.empty()) return;
+
+    PARQUET_ASSIGN_OR_THROW(int64_t offset, sink->Tell());
+    ThriftSerializer serializer;
+    int64_t length = serializer.Serialize(&offset_index_, sink);
+    column_chunk_->__set_offset_index_offset(offset);
+    column_chunk_->__set_offset_index_length(static_cast<int32_t>(length));
+  }
+
+  void SetBloomFilter(std::unique_ptr<BloomFilter> bloom_filter) {
+    bloom_filter_ = std::move(bloom_filter);
+  }
+
+  void WriteBloomFilter(::arrow::io::OutputStream* sink) {
+    if (bloom_filter_ == nullptr) return;
+
+    PARQUET_ASSIGN_OR_THROW(int64_t offset, sink->Tell());
+    bloom_filter_->WriteTo(sink);
+    column_chunk_->meta_data.__set_bloom_filter_offset(offset);
+    bloom_filter_.reset();
+  }
+
   const ColumnDescriptor* descr() const { return column_; }
   int64_t total_compressed_size() const {
     return column_chunk_->meta_data.total_compressed_size;
@@ -1440,12 +1566,31 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
     column_chunk_->meta_data.__set_path_in_schema(column_->path()->ToDotVector());
     column_chunk_->meta_data.__set_codec(
         ToThrift(properties_->compression(column_->path())));
+
+    // Pages of repeated columns may not start on a row boundary, and the page
+    // indexes of encrypted columns would have to be encrypted as well
+    const auto& encrypt_md =
+        properties_->column_encryption_properties(column_->path()->ToDotString());
+    write_page_index_ = properties_->write_page_index() &&
+                        column_->max_repetition_level() == 0 &&
+                        !(encrypt_md != nullptr && encrypt_md->is_encrypted());
+    has_column_index_ = write_page_index_;
   }
 
   format::ColumnChunk* column_chunk_;
   std::unique_ptr<format::ColumnChunk> owned_column_chunk_;
   const std::shared_ptr<WriterProperties> properties_;
   const ColumnDescriptor* column_;
+
+  // Page index
+  bool write_page_index_ = false;
+  bool has_column_index_ = false;
+  bool has_null_counts_ = true;
+  int64_t num_indexed_rows_ = 0;
+  format::ColumnIndex column_index_;
+  format::OffsetIndex offset_index_;
+
+  std::unique_ptr<BloomFilter> bloom_filter_;
 };
 
 std::unique_ptr<ColumnChunkMetaDataBuilder> ColumnChunkMetaDataBuilder::Make(
@@ -1498,6 +1643,29 @@ void ColumnChunkMetaDataBuilder::WriteTo(::arrow::io::OutputStream* sink) {
   impl_->WriteTo(sink);
 }
 
+void ColumnChunkMetaDataBuilder::RecordDataPage(
+    int64_t offset, int32_t compressed_page_size, int64_t num_values,
+    const EncodedStatistics& page_statistics) {
+  impl_->RecordDataPage(offset, compressed_page_size, num_values, page_statistics);
+}
+
+void ColumnChunkMetaDataBuilder::WriteColumnIndex(::arrow::io::OutputStream* sink) {
+  impl_->WriteColumnIndex(sink);
+}
+
+void ColumnChunkMetaDataBuilder::WriteOffsetIndex(::arrow::io::OutputStream* sink) {
+  impl_->WriteOffsetIndex(sink);
+}
+
+void ColumnChunkMetaDataBuilder::SetBloomFilter(
+    std::unique_ptr<BloomFilter> bloom_filter) {
+  impl_->SetBloomFilter(std::move(bloom_filter));
+}
+
+void ColumnChunkMetaDataBuilder::WriteBloomFilter(::arrow::io::OutputStream* sink) {
+  impl_->WriteBloomFilter(sink);
+}
+
 const ColumnDescriptor* ColumnChunkMetaDataBuilder::descr() const {
   return impl_->descr();
 }
@@ -1566,6 +1734,21 @@ class RowGroupMetaDataBuilder::RowGroupMetaDataBuilderImpl {
     row_group_->__set_ordinal(row_group_ordinal);
   }
 
+  void WritePageIndex(::arrow::io::OutputStream* sink) {
+    for (const auto& column_builder : column_builders_) {
+      column_builder->WriteColumnIndex(sink);
+    }
+    for (const auto& column_builder : column_builders_) {
+      column_builder->WriteOffsetIndex(sink);
+    }
+  }
+
+  void WriteBloomFilters(::arrow::io::OutputStream* sink) {
+    for (const auto& column_builder : column_builders_) {
+      column_builder->WriteBloomFilter(sink);
+    }
+  }
+
   void set_num_rows(int64_t num_rows) { row_group_->num_rows = num_rows; }
 
   int num_columns() { return static_cast<int>(row_group_->columns.size()); }
@@ -1615,6 +1798,14 @@ void RowGroupMetaDataBuilder::Finish(int64_t total_bytes_written,
   impl_->Finish(total_bytes_written, row_group_ordinal);
 }
 
+void RowGroupMetaDataBuilder::WritePageIndex(::arrow::io::OutputStream* sink) {
+  impl_->WritePageIndex(sink);
+}
+
+void RowGroupMetaDataBuilder::WriteBloomFilters(::arrow::io::OutputStream* sink) {
+  impl_->WriteBloomFilters(sink);
+}
+
 // file metadata
 // TODO(PARQUET-595) Support key_value_metadata
 class FileMetaDataBuilder::FileMetaDataBuilderImpl {
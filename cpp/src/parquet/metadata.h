@@ -32,6 +32,7 @@
 
 namespace parquet {
 
+class BloomFilter;
 class ColumnDescriptor;
 class EncodedStatistics;
 class Statistics;
@@ -162,6 +163,18 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t total_uncompressed_size() const;
   std::unique_ptr<ColumnCryptoMetaData> crypto_metadata() const;
 
+  // page index, see parquet/page_index.h
+  bool has_column_index() const;
+  int64_t column_index_offset() const;
+  int32_t column_index_length() const;
+  bool has_offset_index() const;
+  int64_t offset_index_offset() const;
+  int32_t offset_index_length() const;
+
+  // Bloom filter, see RowGroupReader::GetColumnBloomFilter
+  bool has_bloom_filter() const;
+  int64_t bloom_filter_offset() const;
+
  private:
   explicit ColumnChunkMetaData(
       const void* metadata, const ColumnDescriptor* descr, int16_t row_group_ordinal,
@@ -394,6 +407,13 @@ class PARQUET_EXPORT ColumnChunkMetaDataBuilder {
   const ColumnDescriptor* descr() const;
 
   int64_t total_compressed_size() const;
+
+  // Record a data page for the page index of the column chunk. The offset may
+  // be relative to any position, as long as it is consistent with the
+  // data_page_offset later passed to Finish.
+  void RecordDataPage(int64_t offset, int32_t compressed_page_size, int64_t num_values,
+                      const EncodedStatistics& page_statistics);
+
   // commit the metadata
 
   void Finish(int64_t num_values, int64_t dictionary_page_offset,
@@ -410,6 +430,18 @@ class PARQUET_EXPORT ColumnChunkMetaDataBuilder {
   // For writing metadata at end of column chunk
   void WriteTo(::arrow::io::OutputStream* sink);
 
+  // Write the ColumnIndex/OffsetIndex of the column chunk, if any, and record
+  // their location in the metadata
+  void WriteColumnIndex(::arrow::io::OutputStream* sink);
+  void WriteOffsetIndex(::arrow::io::OutputStream* sink);
+
+  // Set the Bloom filter of the values of the column chunk
+  void SetBloomFilter(std::unique_ptr<BloomFilter> bloom_filter);
+
+  // Write the Bloom filter of the column chunk, if any, and record its
+  // location in the metadata
+  void WriteBloomFilter(::arrow::io::OutputStream* sink);
+
  private:
   explicit ColumnChunkMetaDataBuilder(std::shared_ptr<WriterProperties> props,
                                       const ColumnDescriptor* column);
@@ -439,6 +471,13 @@ class PARQUET_EXPORT RowGroupMetaDataBuilder {
   // commit the metadata
   void Finish(int64_t total_bytes_written, int16_t row_group_ordinal = -1);
 
+  // Write the page indexes of all the column chunks, the ColumnIndexes first
+  // and then the OffsetIndexes
+  void WritePageIndex(::arrow::io::OutputStream* sink);
+
+  // Write the Bloom filters of all the column chunks
+  void WriteBloomFilters(::arrow::io::OutputStream* sink);
+
  private:
   explicit RowGroupMetaDataBuilder(std::shared_ptr<WriterProperties> props,
                                    const SchemaDescriptor* schema_, void* contents);
@@ -0,0 +1,245 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "parquet/exception.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/thrift_internal.h"
+
+namespace parquet {
+
+// ----------------------------------------------------------------------
+// OffsetIndex
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(const void* serialized_index,
+                                               uint32_t* inout_index_len) {
+  format::OffsetIndex offset_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index),
+                       inout_index_len, &offset_index);
+
+  std::vector<PageLocation> page_locations;
+  page_locations.reserve(offset_index.page_locations.size());
+  for (const auto& location : offset_index.page_locations) {
+    if (!page_locations.empty() &&
+        location.first_row_index < page_locations.back().first_row_index) {
+      throw ParquetException("OffsetIndex page locations are not sorted by row");
+    }
+    page_locations.push_back(
+        {location.offset, location.compressed_page_size, location.first_row_index});
+  }
+  return std::unique_ptr<OffsetIndex>(new OffsetIndex(std::move(page_locations)));
+}
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(
+    std::vector<PageLocation> page_locations) {
+  return std::unique_ptr<OffsetIndex>(new OffsetIndex(std::move(page_locations)));
+}
+
+OffsetIndex::OffsetIndex(std::vector<PageLocation> page_locations)
+    : page_locations_(std::move(page_locations)) {}
+
+OffsetIndex::~OffsetIndex() = default;
+
+int64_t OffsetIndex::page_num_rows(int i, int64_t row_group_num_rows) const {
+  int64_t end = i + 1 < num_pages() ? page_locations_[i + 1].first_row_index
+                                    : row_group_num_rows;
+  return end - page_locations_[i].first_row_index;
+}
+
+std::vector<int> OffsetIndex::SelectPages(const std::vector<RowRange>& row_ranges,
+                                          int64_t row_group_num_rows) const {
+  std::vector<int> pages;
+  auto range = row_ranges.begin();
+  for (int i = 0; i < num_pages() && range != row_ranges.end(); ++i) {
+    int64_t page_begin = page_locations_[i].first_row_index;
+    int64_t page_end = page_begin + page_num_rows(i, row_group_num_rows);
+    // Skip the ranges ending before this page
+    while (range != row_ranges.end() && range->end() <= page_begin) ++range;
+    if (range != row_ranges.end() && range->offset < page_end) {
+      pages.push_back(i);
+    }
+  }
+  return pages;
+}
+
+std::vector<RowRange> OffsetIndex::RowRangesInSelectedPages(
+    const std::vector<RowRange>& row_ranges, int64_t row_group_num_rows) const {
+  std::vector<RowRange> out;
+  const std::vector<int> pages = SelectPages(row_ranges, row_group_num_rows);
+  auto page = pages.begin();
+  // The number of rows of the pages which were not selected before *page
+  int64_t rows_skipped =
+      page == pages.end() ? 0 : page_locations_[*page].first_row_index;
+  for (const auto& range : row_ranges) {
+    if (range.length == 0) continue;
+    // Every row of the range is held by a selected page, and the pages holding
+    // the range are contiguous
+    while (page + 1 != pages.end() &&
+           page_locations_[*(page + 1)].first_row_index <= range.offset) {
+      int64_t page_end = page_locations_[*page].first_row_index +
+                         page_num_rows(*page, row_group_num_rows);
+      ++page;
+      rows_skipped += page_locations_[*page].first_row_index - page_end;
+    }
+    out.push_back({range.offset - rows_skipped, range.length});
+  }
+  return out;
+}
+
+// ----------------------------------------------------------------------
+// ColumnIndex
+
+class ColumnIndex::ColumnIndexImpl {
+ public:
+  ColumnIndexImpl(const ColumnDescriptor* descr, const void* serialized_index,
+                  uint32_t* inout_index_len, ::arrow::MemoryPool* pool)
+      : descr_(descr), pool_(pool) {
+    DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index),
+                         inout_index_len, &column_index_);
+    size_t num_pages = column_index_.null_pages.size();
+    if (column_index_.min_values.size() != num_pages ||
+        column_index_.max_values.size() != num_pages ||
+        (column_index_.__isset.null_counts &&
+         column_index_.null_counts.size() != num_pages)) {
+      throw ParquetException("ColumnIndex has inconsistent page counts");
+    }
+  }
+
+  int num_pages() const { return static_cast<int>(column_index_.null_pages.size()); }
+
+  bool null_page(int i) const { return column_index_.null_pages[i]; }
+
+  bool has_null_counts() const { return column_index_.__isset.null_counts; }
+
+  int64_t null_count(int i) const { return column_index_.null_counts[i]; }
+
+  const std::string& encoded_min(int i) const { return column_index_.min_values[i]; }
+
+  const std::string& encoded_max(int i) const { return column_index_.max_values[i]; }
+
+  std::shared_ptr<Statistics> page_statistics(int i, int64_t num_values) const {
+    int64_t null_count = 0;
+    if (has_null_counts()) {
+      null_count = column_index_.null_counts[i];
+    } else if (null_page(i)) {
+      null_count = num_values;
+    }
+    // A ColumnIndex only holds min/max values if the sort order of the column
+    // is known
+    bool has_min_max = !null_page(i) && descr_->sort_order() != SortOrder::UNKNOWN;
+    bool has_null_count = has_null_counts() || null_page(i);
+    return Statistics::Make(descr_, encoded_min(i), encoded_max(i),
+                            num_values - null_count, null_count, /*distinct_count=*/0,
+                            has_min_max, has_null_count, /*has_distinct_count=*/false,
+                            pool_);
+  }
+
+ private:
+  format::ColumnIndex column_index_;
+  const ColumnDescriptor* descr_;
+  ::arrow::MemoryPool* pool_;
+};
+
+std::unique_ptr<ColumnIndex> ColumnIndex::Make(const ColumnDescriptor* descr,
+                                               const void* serialized_index,
+                                               uint32_t* inout_index_len,
+                                               ::arrow::MemoryPool* pool) {
+  return std::unique_ptr<ColumnIndex>(
+      new ColumnIndex(descr, serialized_index, inout_index_len, pool));
+}
+
+ColumnIndex::ColumnIndex(const ColumnDescriptor* descr, const void* serialized_index,
+                         uint32_t* inout_index_len, ::arrow::MemoryPool* pool)
+    : impl_(new ColumnIndexImpl(descr, serialized_index, inout_index_len, pool)) {}
+
+ColumnIndex::~ColumnIndex() = default;
+
+int ColumnIndex::num_pages() const { return impl_->num_pages(); }
+
+bool ColumnIndex::null_page(int i) const { return impl_->null_page(i); }
+
+bool ColumnIndex::has_null_counts() const { return impl_->has_null_counts(); }
+
+int64_t ColumnIndex::null_count(int i) const { return impl_->null_count(i); }
+
+const std::string& ColumnIndex::encoded_min(int i) const { return impl_->encoded_min(i); }
+
+const std::string& ColumnIndex::encoded_max(int i) const { return impl_->encoded_max(i); }
+
+std::shared_ptr<Statistics> ColumnIndex::page_statistics(int i,
+                                                         int64_t num_values) const {
+  return impl_->page_statistics(i, num_values);
+}
+
+// ----------------------------------------------------------------------
+// Row ranges
+
+std::vector<RowRange> AlignRowRanges(
+    const std::vector<RowRange>& row_ranges,
+    const std::vector<std::shared_ptr<OffsetIndex>>& offset_indexes,
+    int64_t row_group_num_rows) {
+  std::vector<RowRange> whole_row_group = {{0, row_group_num_rows}};
+  if (offset_indexes.empty()) return whole_row_group;
+
+  // The page boundaries shared by all column chunks
+  std::vector<int64_t> boundaries;
+  for (size_t c = 0; c < offset_indexes.size(); ++c) {
+    if (offset_indexes[c] == nullptr) return whole_row_group;
+
+    std::vector<int64_t> column_boundaries;
+    for (const auto& location : offset_indexes[c]->page_locations()) {
+      column_boundaries.push_back(location.first_row_index);
+    }
+    column_boundaries.push_back(row_group_num_rows);
+
+    if (c == 0) {
+      boundaries = std::move(column_boundaries);
+      continue;
+    }
+    std::vector<int64_t> common;
+    std::set_intersection(boundaries.begin(), boundaries.end(),
+                          column_boundaries.begin(), column_boundaries.end(),
+                          std::back_inserter(common));
+    boundaries = std::move(common);
+  }
+  if (boundaries.empty() || boundaries.front() != 0) return whole_row_group;
+
+  // Select each segment between consecutive boundaries which contains a row of
+  // row_ranges, coalescing adjacent segments
+  std::vector<RowRange> aligned;
+  auto range = row_ranges.begin();
+  for (size_t i = 0; i + 1 < boundaries.size() && range != row_ranges.end(); ++i) {
+    int64_t begin = boundaries[i], end = boundaries[i + 1];
+    while (range != row_ranges.end() && range->end() <= begin) ++range;
+    if (range == row_ranges.end() || range->offset >= end) continue;
+
+    if (!aligned.empty() && aligned.back().end() == begin) {
+      aligned.back().length += end - begin;
+    } else {
+      aligned.push_back({begin, end - begin});
+    }
+  }
+  return aligned;
+}
+
+}  // namespace parquet
@@ -0,0 +1,146 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/platform.h"
+
+namespace parquet {
+
+class ColumnDescriptor;
+class Statistics;
+
+/// \brief The location of a data page within a file, as recorded in an OffsetIndex
+struct PARQUET_EXPORT PageLocation {
+  /// \brief Offset of the page header from the beginning of the file
+  int64_t offset;
+  /// \brief Size of the page, including its header
+  int32_t compressed_page_size;
+  /// \brief Index of the first row of the page within its row group
+  int64_t first_row_index;
+};
+
+/// \brief A contiguous range of rows within a row group
+struct PARQUET_EXPORT RowRange {
+  int64_t offset;
+  int64_t length;
+
+  int64_t end() const { return offset + length; }
+
+  bool operator==(const RowRange& other) const {
+    return offset == other.offset && length == other.length;
+  }
+};
+
+/// \brief OffsetIndex is a proxy around format::OffsetIndex, which locates the
+/// data pages of a column chunk so that they can be read individually.
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  /// \brief Create an OffsetIndex from a serialized thrift message.
+  static std::unique_ptr<OffsetIndex> Make(const void* serialized_index,
+                                           uint32_t* inout_index_len);
+
+  /// \brief Create an OffsetIndex from page locations sorted by row, e.g. found
+  /// by scanning the page headers of a column chunk.
+  static std::unique_ptr<OffsetIndex> Make(std::vector<PageLocation> page_locations);
+
+  ~OffsetIndex();
+
+  int num_pages() const { return static_cast<int>(page_locations_.size()); }
+
+  const std::vector<PageLocation>& page_locations() const { return page_locations_; }
+
+  /// \brief Number of rows in the page at index i, given the number of rows of
+  /// the row group the column chunk belongs to.
+  int64_t page_num_rows(int i, int64_t row_group_num_rows) const;
+
+  /// \brief Return the indices of the pages containing any row of \a row_ranges.
+  ///
+  /// \param[in] row_ranges sorted, non-overlapping ranges of rows
+  /// \param[in] row_group_num_rows the number of rows of the row group
+  std::vector<int> SelectPages(const std::vector<RowRange>& row_ranges,
+                               int64_t row_group_num_rows) const;
+
+  /// \brief Translate \a row_ranges into ranges of the rows held by the pages
+  /// returned by SelectPages(row_ranges), i.e. the rows seen by a reader of
+  /// only those pages.
+  std::vector<RowRange> RowRangesInSelectedPages(const std::vector<RowRange>& row_ranges,
+                                                 int64_t row_group_num_rows) const;
+
+ private:
+  explicit OffsetIndex(std::vector<PageLocation> page_locations);
+
+  std::vector<PageLocation> page_locations_;
+};
+
+/// \brief ColumnIndex is a proxy around format::ColumnIndex, which holds the
+/// min/max statistics of each data page of a column chunk.
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  /// \brief Create a ColumnIndex from a serialized thrift message.
+  static std::unique_ptr<ColumnIndex> Make(
+      const ColumnDescriptor* descr, const void* serialized_index,
+      uint32_t* inout_index_len,
+      ::arrow::MemoryPool* pool = ::arrow::default_memory_pool());
+
+  ~ColumnIndex();
+
+  int num_pages() const;
+
+  /// \brief Whether the page at index i only contains null values, in which
+  /// case it has no min/max.
+  bool null_page(int i) const;
+
+  bool has_null_counts() const;
+  int64_t null_count(int i) const;
+
+  const std::string& encoded_min(int i) const;
+  const std::string& encoded_max(int i) const;
+
+  /// \brief Return the statistics of the page at index i.
+  ///
+  /// \param[in] i the index of the page
+  /// \param[in] num_values the number of values in the page, including nulls,
+  /// e.g. as given by OffsetIndex::page_num_rows for non-repeated columns
+  std::shared_ptr<Statistics> page_statistics(int i, int64_t num_values) const;
+
+ private:
+  ColumnIndex(const ColumnDescriptor* descr, const void* serialized_index,
+              uint32_t* inout_index_len, ::arrow::MemoryPool* pool);
+  // PIMPL Idiom
+  class ColumnIndexImpl;
+  std::unique_ptr<ColumnIndexImpl> impl_;
+};
+
+/// \brief Widen \a row_ranges so that every range starts and ends on a page
+/// boundary of each of the given column chunks.
+///
+/// Reading the pages selected by the returned ranges from each column chunk
+/// then yields exactly the same rows for all of them. If \a offset_indexes is
+/// empty or any of them is null, the whole row group is returned.
+PARQUET_EXPORT
+std::vector<RowRange> AlignRowRanges(
+    const std::vector<RowRange>& row_ranges,
+    const std::vector<std::shared_ptr<OffsetIndex>>& offset_indexes,
+    int64_t row_group_num_rows);
+
+}  // namespace parquet
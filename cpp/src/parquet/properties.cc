@@ -25,6 +25,32 @@
 
 namespace parquet {
 
+Encoding::type WriterProperties::dictionary_fallback_encoding(
+    const std::shared_ptr<schema::ColumnPath>& path, Type::type physical_type) const {
+  const Encoding::type configured = encoding(path);
+  switch (configured) {
+    case Encoding::DELTA_BINARY_PACKED:
+      if (physical_type == Type::INT32 || physical_type == Type::INT64) {
+        return configured;
+      }
+      break;
+    case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+    case Encoding::DELTA_BYTE_ARRAY:
+      if (physical_type == Type::BYTE_ARRAY) {
+        return configured;
+      }
+      break;
+    case Encoding::BYTE_STREAM_SPLIT:
+      if (physical_type == Type::FLOAT || physical_type == Type::DOUBLE) {
+        return configured;
+      }
+      break;
+    default:
+      break;
+  }
+  return Encoding::PLAIN;
+}
+
 std::shared_ptr<ArrowInputStream> ReaderProperties::GetStream(
     std::shared_ptr<ArrowInputFile> source, int64_t start, int64_t num_bytes) {
   if (buffered_stream_enabled_) {
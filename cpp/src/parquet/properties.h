@@ -107,8 +107,11 @@ static constexpr bool DEFAULT_IS_DICTIONARY_ENABLED = true;
 static constexpr int64_t DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT = kDefaultDataPageSize;
 static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 64 * 1024 * 1024;
+static constexpr int64_t DEFAULT_MAX_ROW_GROUP_BYTES = 128 * 1024 * 1024;
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
 static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
+static constexpr bool DEFAULT_IS_BLOOM_FILTER_ENABLED = false;
+static constexpr double DEFAULT_BLOOM_FILTER_FPP = 0.01;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::PLAIN;
 static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
@@ -125,7 +128,10 @@ class PARQUET_EXPORT ColumnProperties {
         dictionary_enabled_(dictionary_enabled),
         statistics_enabled_(statistics_enabled),
         max_stats_size_(max_stats_size),
-        compression_level_(Codec::UseDefaultCompressionLevel()) {}
+        compression_level_(Codec::UseDefaultCompressionLevel()),
+        bloom_filter_enabled_(DEFAULT_IS_BLOOM_FILTER_ENABLED),
+        bloom_filter_ndv_(0),
+        bloom_filter_fpp_(DEFAULT_BLOOM_FILTER_FPP) {}
 
   void set_encoding(Encoding::type encoding) { encoding_ = encoding; }
 
@@ -147,6 +153,14 @@ class PARQUET_EXPORT ColumnProperties {
     compression_level_ = compression_level;
   }
 
+  void set_bloom_filter_enabled(bool bloom_filter_enabled) {
+    bloom_filter_enabled_ = bloom_filter_enabled;
+  }
+
+  void set_bloom_filter_ndv(int64_t ndv) { bloom_filter_ndv_ = ndv; }
+
+  void set_bloom_filter_fpp(double fpp) { bloom_filter_fpp_ = fpp; }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -159,6 +173,12 @@ class PARQUET_EXPORT ColumnProperties {
 
   int compression_level() const { return compression_level_; }
 
+  bool bloom_filter_enabled() const { return bloom_filter_enabled_; }
+
+  int64_t bloom_filter_ndv() const { return bloom_filter_ndv_; }
+
+  double bloom_filter_fpp() const { return bloom_filter_fpp_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -166,6 +186,9 @@ class PARQUET_EXPORT ColumnProperties {
   bool statistics_enabled_;
   size_t max_stats_size_;
   int compression_level_;
+  bool bloom_filter_enabled_;
+  int64_t bloom_filter_ndv_;
+  double bloom_filter_fpp_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -177,10 +200,12 @@ class PARQUET_EXPORT WriterProperties {
           dictionary_pagesize_limit_(DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT),
           write_batch_size_(DEFAULT_WRITE_BATCH_SIZE),
           max_row_group_length_(DEFAULT_MAX_ROW_GROUP_LENGTH),
+          max_row_group_bytes_(DEFAULT_MAX_ROW_GROUP_BYTES),
           pagesize_(kDefaultDataPageSize),
           version_(ParquetVersion::PARQUET_1_0),
           data_page_version_(ParquetDataPageVersion::V1),
-          created_by_(DEFAULT_CREATED_BY) {}
+          created_by_(DEFAULT_CREATED_BY),
+          write_page_index_(false) {}
     virtual ~Builder() {}
 
     Builder* memory_pool(MemoryPool* pool) {
@@ -231,6 +256,15 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// Set the target size in bytes of the row groups written by
+    /// parquet::arrow::FileWriter::WriteRecordBatch, i.e. the encoded and
+    /// compressed size of their column chunks, which are buffered in memory
+    /// until the row group is complete.
+    Builder* max_row_group_bytes(int64_t max_row_group_bytes) {
+      max_row_group_bytes_ = max_row_group_bytes;
+      return this;
+    }
+
     Builder* data_pagesize(int64_t pg_size) {
       pagesize_ = pg_size;
       return this;
@@ -251,11 +285,29 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// Write a ColumnIndex (per-page min/max statistics) and an OffsetIndex
+    /// (page locations) for every column chunk, allowing readers to skip
+    /// individual data pages. Page indexes are only written for columns
+    /// without repetition levels, whose pages always start on a row boundary.
+    /// Disabled by default.
+    Builder* enable_write_page_index() {
+      write_page_index_ = true;
+      return this;
+    }
+
+    Builder* disable_write_page_index() {
+      write_page_index_ = false;
+      return this;
+    }
+
     /**
      * Define the encoding that is used when we don't utilise dictionary encoding.
      *
      * This either apply if dictionary encoding is disabled or if we fallback
      * as the dictionary grew too large.
+     *
+     * DELTA_BINARY_PACKED only supports INT32 and INT64 columns, and
+     * DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY only BYTE_ARRAY columns.
      */
     Builder* encoding(Encoding::type encoding_type) {
       if (encoding_type == Encoding::PLAIN_DICTIONARY ||
@@ -397,6 +449,43 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /// Write a Bloom filter of the values of each column chunk of the column
+    /// specified by path, letting readers skip row groups which cannot hold a
+    /// given value. Bloom filters are not written for BOOLEAN or encrypted
+    /// columns.
+    ///
+    /// \param path the column
+    /// \param ndv the expected number of distinct values per column chunk, which
+    /// sizes the filter
+    /// \param fpp the probability of a false positive for a value which is not
+    /// in the column chunk, given ndv distinct values
+    Builder* enable_bloom_filter(const std::string& path, int64_t ndv,
+                                 double fpp = DEFAULT_BLOOM_FILTER_FPP) {
+      if (ndv <= 0) {
+        throw ParquetException("Bloom filter number of distinct values must be positive");
+      }
+      if (!(fpp > 0.0 && fpp < 1.0)) {
+        throw ParquetException(
+            "Bloom filter false positive probability must be in (0, 1)");
+      }
+      bloom_filters_[path] = std::make_pair(ndv, fpp);
+      return this;
+    }
+
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path,
+                                 int64_t ndv, double fpp = DEFAULT_BLOOM_FILTER_FPP) {
+      return this->enable_bloom_filter(path->ToDotString(), ndv, fpp);
+    }
+
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filters_.erase(path);
+      return this;
+    }
+
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
     std::shared_ptr<WriterProperties> build() {
       std::unordered_map<std::string, ColumnProperties> column_properties;
       auto get = [&](const std::string& key) -> ColumnProperties& {
@@ -415,11 +504,18 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : bloom_filters_) {
+        auto& properties = get(item.first);
+        properties.set_bloom_filter_enabled(true);
+        properties.set_bloom_filter_ndv(item.second.first);
+        properties.set_bloom_filter_fpp(item.second.second);
+      }
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
-          pagesize_, version_, created_by_, std::move(file_encryption_properties_),
-          default_column_properties_, column_properties, data_page_version_));
+          max_row_group_bytes_, pagesize_, version_, created_by_,
+          std::move(file_encryption_properties_), default_column_properties_,
+          column_properties, data_page_version_, write_page_index_));
     }
 
    private:
@@ -427,10 +523,12 @@ class PARQUET_EXPORT WriterProperties {
     int64_t dictionary_pagesize_limit_;
     int64_t write_batch_size_;
     int64_t max_row_group_length_;
+    int64_t max_row_group_bytes_;
     int64_t pagesize_;
     ParquetVersion::type version_;
     ParquetDataPageVersion data_page_version_;
     std::string created_by_;
+    bool write_page_index_;
 
     std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -441,6 +539,9 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, int32_t> codecs_compression_level_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    // The number of distinct values and false positive probability of each
+    // column's Bloom filter
+    std::unordered_map<std::string, std::pair<int64_t, double>> bloom_filters_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -451,6 +552,8 @@ class PARQUET_EXPORT WriterProperties {
 
   inline int64_t max_row_group_length() const { return max_row_group_length_; }
 
+  inline int64_t max_row_group_bytes() const { return max_row_group_bytes_; }
+
   inline int64_t data_pagesize() const { return pagesize_; }
 
   inline ParquetDataPageVersion data_page_version() const {
@@ -461,6 +564,8 @@ class PARQUET_EXPORT WriterProperties {
 
   inline std::string created_by() const { return parquet_created_by_; }
 
+  inline bool write_page_index() const { return write_page_index_; }
+
   inline Encoding::type dictionary_index_encoding() const {
     if (parquet_version_ == ParquetVersion::PARQUET_1_0) {
       return Encoding::PLAIN_DICTIONARY;
@@ -477,6 +582,14 @@ class PARQUET_EXPORT WriterProperties {
     }
   }
 
+  /// \brief The encoding a dictionary-encoded column falls back to once its
+  /// dictionary grows too large
+  ///
+  /// This is the encoding configured for the column if it supports the
+  /// column's physical type, PLAIN otherwise.
+  Encoding::type dictionary_fallback_encoding(
+      const std::shared_ptr<schema::ColumnPath>& path, Type::type physical_type) const;
+
   const ColumnProperties& column_properties(
       const std::shared_ptr<schema::ColumnPath>& path) const {
     auto it = column_properties_.find(path->ToDotString());
@@ -508,6 +621,18 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool bloom_filter_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_enabled();
+  }
+
+  int64_t bloom_filter_ndv(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_ndv();
+  }
+
+  double bloom_filter_fpp(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_fpp();
+  }
+
   inline FileEncryptionProperties* file_encryption_properties() const {
     return file_encryption_properties_.get();
   }
@@ -524,20 +649,22 @@ class PARQUET_EXPORT WriterProperties {
  private:
   explicit WriterProperties(
       MemoryPool* pool, int64_t dictionary_pagesize_limit, int64_t write_batch_size,
-      int64_t max_row_group_length, int64_t pagesize, ParquetVersion::type version,
-      const std::string& created_by,
+      int64_t max_row_group_length, int64_t max_row_group_bytes, int64_t pagesize,
+      ParquetVersion::type version, const std::string& created_by,
       std::shared_ptr<FileEncryptionProperties> file_encryption_properties,
       const ColumnProperties& default_column_properties,
       const std::unordered_map<std::string, ColumnProperties>& column_properties,
-      ParquetDataPageVersion data_page_version)
+      ParquetDataPageVersion data_page_version, bool write_page_index)
       : pool_(pool),
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
         write_batch_size_(write_batch_size),
         max_row_group_length_(max_row_group_length),
+        max_row_group_bytes_(max_row_group_bytes),
         pagesize_(pagesize),
         parquet_data_page_version_(data_page_version),
         parquet_version_(version),
         parquet_created_by_(created_by),
+        write_page_index_(write_page_index),
         file_encryption_properties_(file_encryption_properties),
         default_column_properties_(default_column_properties),
         column_properties_(column_properties) {}
@@ -546,10 +673,12 @@ class PARQUET_EXPORT WriterProperties {
   int64_t dictionary_pagesize_limit_;
   int64_t write_batch_size_;
   int64_t max_row_group_length_;
+  int64_t max_row_group_bytes_;
   int64_t pagesize_;
   ParquetDataPageVersion parquet_data_page_version_;
   ParquetVersion::type parquet_version_;
   std::string parquet_created_by_;
+  bool write_page_index_;
 
   std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -575,7 +704,8 @@ class PARQUET_EXPORT ArrowReaderProperties {
         read_dict_indices_(),
         batch_size_(kArrowDefaultBatchSize),
         pre_buffer_(false),
-        cache_options_(::arrow::io::CacheOptions::Defaults()) {}
+        cache_options_(::arrow::io::CacheOptions::Defaults()),
+        auto_read_dictionary_(false) {}
 
   void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
 
@@ -596,6 +726,19 @@ class PARQUET_EXPORT ArrowReaderProperties {
     }
   }
 
+  /// Read the BYTE_ARRAY columns whose column chunks are all dictionary
+  /// encoded as Arrow dictionaries, as if set_read_dictionary was set for them.
+  /// Column chunks are dictionary encoded when their encoding stats show that
+  /// none of their data pages fell back to another encoding.
+  ///
+  /// The dictionary of each column chunk is then used as is, without decoding
+  /// the column into a dense array nor hashing its values.
+  void set_auto_read_dictionary(bool auto_read_dictionary) {
+    auto_read_dictionary_ = auto_read_dictionary;
+  }
+
+  bool auto_read_dictionary() const { return auto_read_dictionary_; }
+
   void set_batch_size(int64_t batch_size) { batch_size_ = batch_size; }
 
   int64_t batch_size() const { return batch_size_; }
@@ -627,6 +770,7 @@ class PARQUET_EXPORT ArrowReaderProperties {
   bool pre_buffer_;
   ::arrow::io::AsyncContext async_context_;
   ::arrow::io::CacheOptions cache_options_;
+  bool auto_read_dictionary_;
 };
 
 /// EXPERIMENTAL: Constructs the default ArrowReaderProperties
@@ -649,7 +793,8 @@ class PARQUET_EXPORT ArrowWriterProperties {
           store_schema_(false),
           // TODO: At some point we should flip this.
           compliant_nested_types_(false),
-          engine_version_(V2) {}
+          engine_version_(V2),
+          use_threads_(kArrowDefaultUseThreads) {}
     virtual ~Builder() = default;
 
     Builder* disable_deprecated_int96_timestamps() {
@@ -701,11 +846,22 @@ class PARQUET_EXPORT ArrowWriterProperties {
       return this;
     }
 
+    /// \brief Set whether to encode and compress the columns of a row group
+    /// in parallel when writing a Table.
+    ///
+    /// The columns of each row group are then buffered in memory until the
+    /// row group is complete. Not supported when writing encrypted files, in
+    /// which case columns are written sequentially.
+    Builder* set_use_threads(bool use_threads) {
+      use_threads_ = use_threads;
+      return this;
+    }
+
     std::shared_ptr<ArrowWriterProperties> build() {
       return std::shared_ptr<ArrowWriterProperties>(new ArrowWriterProperties(
           write_timestamps_as_int96_, coerce_timestamps_enabled_, coerce_timestamps_unit_,
           truncated_timestamps_allowed_, store_schema_, compliant_nested_types_,
-          engine_version_));
+          engine_version_, use_threads_));
     }
 
    private:
@@ -718,6 +874,7 @@ class PARQUET_EXPORT ArrowWriterProperties {
     bool store_schema_;
     bool compliant_nested_types_;
     EngineVersion engine_version_;
+    bool use_threads_;
   };
 
   bool support_deprecated_int96_timestamps() const { return write_timestamps_as_int96_; }
@@ -744,20 +901,25 @@ class PARQUET_EXPORT ArrowWriterProperties {
   /// place in case there are bugs detected in V2.
   EngineVersion engine_version() const { return engine_version_; }
 
+  /// \brief Whether the columns of a row group are encoded and compressed in
+  /// parallel by FileWriter::WriteTable.
+  bool use_threads() const { return use_threads_; }
+
  private:
   explicit ArrowWriterProperties(bool write_nanos_as_int96,
                                  bool coerce_timestamps_enabled,
                                  ::arrow::TimeUnit::type coerce_timestamps_unit,
                                  bool truncated_timestamps_allowed, bool store_schema,
                                  bool compliant_nested_types,
-                                 EngineVersion engine_version)
+                                 EngineVersion engine_version, bool use_threads)
       : write_timestamps_as_int96_(write_nanos_as_int96),
         coerce_timestamps_enabled_(coerce_timestamps_enabled),
         coerce_timestamps_unit_(coerce_timestamps_unit),
         truncated_timestamps_allowed_(truncated_timestamps_allowed),
         store_schema_(store_schema),
         compliant_nested_types_(compliant_nested_types),
-        engine_version_(engine_version) {}
+        engine_version_(engine_version),
+        use_threads_(use_threads) {}
 
   const bool write_timestamps_as_int96_;
   const bool coerce_timestamps_enabled_;
@@ -766,6 +928,7 @@ class PARQUET_EXPORT ArrowWriterProperties {
   const bool store_schema_;
   const bool compliant_nested_types_;
   const EngineVersion engine_version_;
+  const bool use_threads_;
 };
 
 /// \brief State object used for writing Arrow data directly to a Parquet
@@ -19,6 +19,8 @@ from pyarrow._compute import (  # noqa
     Function,
     FunctionOptions,
     FunctionRegistry,
+    HashAggregateFunction,
+    HashAggregateKernel,
     Kernel,
     ScalarAggregateFunction,
     ScalarAggregateKernel,
@@ -39,6 +41,7 @@ from pyarrow._compute import (  # noqa
     PartitionNthOptions,
     ProjectOptions,
     QuantileOptions,
+    SelectKOptions,
     SetLookupOptions,
     SortOptions,
     StrptimeOptions,
@@ -218,6 +221,10 @@ def _make_global_functions():
     for cpp_name in reg.list_functions():
         name = rewrites.get(cpp_name, cpp_name)
         func = reg.get_function(cpp_name)
+        if func.kind == "hash_aggregate":
+            # Hash aggregate functions are not callable,
+            # so let's not expose them at module level.
+            continue
         assert name not in g, name
         g[cpp_name] = g[name] = _wrap_function(name, func)
 
@@ -134,6 +134,11 @@ def test_get_function_aggregate():
                         pc.ScalarAggregateKernel, 8)
 
 
+def test_get_function_hash_aggregate():
+    _check_get_function("hash_sum", pc.HashAggregateFunction,
+                        pc.HashAggregateKernel, 1)
+
+
 def test_call_function_with_memory_pool():
     arr = pa.array(["foo", "bar", "baz"])
     indices = np.array([2, 2, 1])
@@ -162,6 +167,8 @@ def test_pickle_functions():
 def test_pickle_global_functions():
     # Pickle global wrappers (manual or automatic) of registered functions
     for name in pc.list_functions():
+        if pc.get_function(name).kind == "hash_aggregate":
+            continue
         func = getattr(pc, name)
         reconstructed = pickle.loads(pickle.dumps(func))
         assert reconstructed is func
@@ -1129,6 +1136,24 @@ def test_sort_indices_table():
         pc.sort_indices(table, sort_keys=[("a", "nonscending")])
 
 
+def test_select_k():
+    arr = pa.array([1, 2, None, 0])
+    result = pc.select_k(arr, k=2)
+    assert result.to_pylist() == [3, 0]
+    result = pc.select_k(arr, k=2, sort_keys=[("dummy", "descending")])
+    assert result.to_pylist() == [1, 0]
+
+    table = pa.table({"a": [1, 1, 0], "b": [1, 0, 1]})
+    result = pc.select_k(
+        table, options=pc.SelectKOptions(
+            2, sort_keys=[("a", "ascending"), ("b", "ascending")])
+    )
+    assert result.to_pylist() == [2, 1]
+
+    with pytest.raises(ValueError, match="Must specify one or more sort keys"):
+        pc.select_k(table, k=2)
+
+
 def test_is_in():
     arr = pa.array([1, 2, None, 1, 2, 3])
 